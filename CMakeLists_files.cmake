@@ -30,6 +30,7 @@
 # find dune -name '*.c*' -printf '\t%p\n' | sort
 list (APPEND MAIN_SOURCE_FILES
   opm/grid/cpgrid/Intersection.cpp
+  opm/grid/cpgrid/CpGridCheckpoint.cpp
   opm/grid/cpgrid/CpGridData.cpp
   opm/grid/cpgrid/CpGrid.cpp
   opm/grid/cpgrid/CpGridUtilities.cpp
@@ -39,9 +40,12 @@ list (APPEND MAIN_SOURCE_FILES
   opm/grid/cpgrid/Indexsets.cpp
   opm/grid/cpgrid/PartitionTypeIndicator.cpp
   opm/grid/cpgrid/processEclipseFormat.cpp
+  opm/grid/cpgrid/VtuWriter.cpp
   opm/grid/common/GeometryHelpers.cpp
   opm/grid/common/GridPartitioning.cpp
   opm/grid/common/MetisPartition.cpp
+  opm/grid/common/SubDomains.cpp
+  opm/grid/common/UnstructuredGridPartitioning.cpp
   opm/grid/common/WellConnections.cpp
   opm/grid/common/ZoltanGraphFunctions.cpp
   opm/grid/common/ZoltanPartition.cpp
@@ -50,10 +54,13 @@ list (APPEND MAIN_SOURCE_FILES
   opm/grid/FaceQuadrature.cpp
   opm/grid/GraphOfGrid.cpp
   opm/grid/GraphOfGridWrappers.cpp
+  opm/grid/GridArrays.cpp
   opm/grid/GridHelpers.cpp
   opm/grid/GridManager.cpp
   opm/grid/GridUtilities.cpp
   opm/grid/MinpvProcessor.cpp
+  opm/grid/QuadratureTable.cpp
+  opm/grid/SyntheticCornerPointModel.cpp
   opm/grid/cart_grid.c
   opm/grid/cornerpoint_grid.c
   opm/grid/cpgpreprocess/facetopology.c
@@ -62,16 +69,18 @@ list (APPEND MAIN_SOURCE_FILES
   opm/grid/cpgpreprocess/uniquepoints.c
   opm/grid/UnstructuredGrid.c
   opm/grid/grid_equal.cpp
+  opm/grid/transmissibility/TransTpfa.cpp
+  opm/grid/transmissibility/trans_tpfa.c
   opm/grid/utility/compressedToCartesian.cpp
   opm/grid/utility/cartesianToCompressed.cpp
+  opm/grid/utility/CartesianToCompressedMap.cpp
   opm/grid/utility/StopWatch.cpp
   opm/grid/utility/WachspressCoord.cpp
   )
 
 if (opm-common_FOUND)
   list(APPEND MAIN_SOURCE_FILES
-		opm/grid/utility/VelocityInterpolation.cpp
-		opm/grid/transmissibility/trans_tpfa.c)
+		opm/grid/utility/VelocityInterpolation.cpp)
 endif()
 
 # originally generated with the command:
@@ -95,20 +104,27 @@ list (APPEND TEST_SOURCE_FILES
   tests/cpgrid/logicalCartesianSize_and_refinement_test.cpp
   tests/cpgrid/orientedentitytable_test.cpp
   tests/cpgrid/partition_iterator_test.cpp
+  tests/cpgrid/vtu_writer_test.cpp
   tests/cpgrid/zoltan_test.cpp
   tests/test_cellCentroid_polyhedralGrid.cpp
   tests/test_compressed_cartesian_mapping.cpp
   tests/test_elementchunks.cpp
   tests/test_geom2d.cpp
+  tests/test_grid_arrays.cpp
+  tests/test_grid_binary_io.cpp
   tests/test_gridutilities.cpp
+  tests/test_implicit_cartesian_grid.cpp
   tests/test_lookupdata_polyhedral.cpp
   tests/test_minpvprocessor.cpp
   tests/test_polyhedralgrid.cpp
+  tests/test_polyhedralgrid_distribution.cpp
   tests/test_process_grdecl.cpp
   tests/test_quadratures.cpp
   tests/test_repairzcorn.cpp
   tests/test_sparsetable.cpp
   tests/test_subgridpart.cpp
+  tests/test_synthetic_corner_point_model.cpp
+  tests/test_trans_tpfa.cpp
 	)
 
 if(Boost_VERSION_STRING VERSION_GREATER 1.53)
@@ -136,6 +152,10 @@ if(Boost_VERSION_STRING VERSION_GREATER 1.53)
   )
 endif()
 
+if (opm-common_FOUND)
+  list(APPEND TEST_SOURCE_FILES tests/test_velocityinterpolation.cpp)
+endif()
+
 if(HAVE_ECL_INPUT)
   list(APPEND TEST_SOURCE_FILES
 		tests/test_regionmapping.cpp
@@ -163,13 +183,21 @@ list (APPEND TEST_DATA_FILES
 list (APPEND EXAMPLE_SOURCE_FILES
   examples/finitevolume/finitevolume.cc
   examples/mirror_grid.cpp
+  examples/synthetic_grdecl.cpp
   examples/griditer.cpp
+  examples/grid_binary_io.cpp
+  examples/face_assembly.cpp
+  examples/first_touch.cpp
   )
+if (opm-common_FOUND)
+  list(APPEND EXAMPLE_SOURCE_FILES examples/velocity_interpolation.cpp)
+endif()
 
 # programs listed here will not only be compiled, but also marked for
 # installation
 list (APPEND PROGRAM_SOURCE_FILES
   examples/mirror_grid.cpp
+  examples/synthetic_grdecl.cpp
   )
 if(HAVE_ECL_INPUT)
   list(APPEND EXAMPLE_SOURCE_FILES examples/grdecl2vtu.cpp)
@@ -183,6 +211,7 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/grid/common/GeometryHelpers.hpp
   opm/grid/common/GridAdapter.hpp
   opm/grid/common/GridPartitioning.hpp
+  opm/grid/common/UnstructuredGridPartitioning.hpp
   opm/grid/common/Volumes.hpp
   opm/grid/common/p2pcommunicator.hh
   opm/grid/common/p2pcommunicator_impl.hh
@@ -213,10 +242,12 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/grid/cpgrid/PartitionIteratorRule.hpp
   opm/grid/cpgrid/PartitionTypeIndicator.hpp
   opm/grid/cpgrid/PersistentContainer.hpp
+  opm/grid/cpgrid/VtuWriter.hpp
   opm/grid/common/CartesianIndexMapper.hpp
   opm/grid/common/GridEnums.hpp
   opm/grid/common/LevelCartesianIndexMapper.hpp
   opm/grid/common/MetisPartition.hpp
+  opm/grid/common/SubDomains.hpp
   opm/grid/common/SubGridPart.hpp
   opm/grid/common/ZoltanGraphFunctions.hpp
   opm/grid/common/ZoltanPartition.hpp
@@ -225,6 +256,7 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/grid/polyhedralgrid/declaration.hh
   opm/grid/polyhedralgrid/dgfparser.hh
   opm/grid/polyhedralgrid/entity.hh
+  opm/grid/polyhedralgrid/entity2indexdatahandle.hh
   opm/grid/polyhedralgrid/entitypointer.hh
   opm/grid/polyhedralgrid/entityseed.hh
   opm/grid/polyhedralgrid/geometry.hh
@@ -245,11 +277,16 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/grid/FaceQuadrature.hpp
   opm/grid/GraphOfGrid.hpp
   opm/grid/GraphOfGridWrappers.hpp
+  opm/grid/GridArrays.hpp
   opm/grid/GridHelpers.hpp
   opm/grid/GridManager.hpp
   opm/grid/GridUtilities.hpp
+  opm/grid/ImplicitCartesianGrid.hpp
+  opm/grid/ImplicitCartesianGridHelpers.hpp
   opm/grid/MinpvProcessor.hpp
+  opm/grid/QuadratureTable.hpp
   opm/grid/RepairZCORN.hpp
+  opm/grid/SyntheticCornerPointModel.hpp
   opm/grid/cart_grid.h
   opm/grid/cornerpoint_grid.h
   opm/grid/cpgpreprocess/facetopology.h
@@ -261,8 +298,11 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/grid/transmissibility/TransTpfa_impl.hpp
   opm/grid/utility/compressedToCartesian.hpp
   opm/grid/utility/cartesianToCompressed.hpp
+  opm/grid/utility/CartesianToCompressedMap.hpp
   opm/grid/utility/createThreadIterators.hpp
+  opm/grid/utility/ColouredElementChunks.hpp
   opm/grid/utility/ElementChunks.hpp
+  opm/grid/utility/firstTouch.hpp
   opm/grid/utility/IteratorRange.hpp
   opm/grid/utility/OpmWellType.hpp
   opm/grid/utility/RegionMapping.hpp
@@ -271,6 +311,7 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/grid/utility/VariableSizeCommunicator.hpp
   opm/grid/utility/VelocityInterpolation.hpp
   opm/grid/utility/WachspressCoord.hpp
+  opm/grid/utility/WeightedElementChunks.hpp
   opm/grid/utility/platform_dependent/disable_warnings.h
   opm/grid/utility/platform_dependent/reenable_warnings.h
   )
@@ -0,0 +1,169 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#include <opm/grid/utility/ColouredElementChunks.hpp>
+#include <opm/grid/utility/ElementChunks.hpp>
+#include <opm/grid/utility/StopWatch.hpp>
+#include <opm/grid/CpGrid.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+// Assemble a two-point flux residual over all interior faces, updating
+// both neighbouring cells, in three ways: serially, threaded with atomic
+// updates and threaded over coloured chunks without synchronisation.
+
+namespace
+{
+
+template <class GridView, class Element>
+void assembleElement(const GridView& gv,
+                     const Element& elem,
+                     const std::vector<double>& pressure,
+                     std::vector<double>& residual,
+                     [[maybe_unused]] const bool atomic)
+{
+    const auto& index_set = gv.indexSet();
+    const int in = index_set.index(elem);
+    for (const auto& is : intersections(gv, elem)) {
+        if (!is.neighbor()) {
+            continue;
+        }
+        const int out = index_set.index(is.outside());
+        if (out < in) {
+            continue;
+        }
+        const double flux = is.geometry().volume() * (pressure[in] - pressure[out]);
+        if (atomic) {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+            residual[in] += flux;
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+            residual[out] -= flux;
+        } else {
+            residual[in] += flux;
+            residual[out] -= flux;
+        }
+    }
+}
+
+double maxDifference(const std::vector<double>& a, const std::vector<double>& b)
+{
+    double diff = 0.0;
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        diff = std::max(diff, std::abs(a[i] - b[i]));
+    }
+    return diff;
+}
+
+} // anonymous namespace
+
+
+int main(int argc, char** argv)
+{
+    Dune::MPIHelper::instance(argc, argv);
+
+    std::array<int, 3> dims = { 200, 200, 50 };
+    std::cout << "Creating grid with " << dims[0]*dims[1]*dims[2]/double(1000000) << "M cells." << std::endl;
+    std::array<double, 3> cellsz = { 1.0, 1.0, 1.0 };
+    Dune::CpGrid grid;
+    grid.createCartesian(dims, cellsz);
+    const auto& gv = grid.leafGridView();
+
+    std::vector<double> pressure(grid.size(0));
+    for (std::size_t i = 0; i < pressure.size(); ++i) {
+        pressure[i] = std::sin(0.001 * i);
+    }
+
+    // Serial reference
+    std::vector<double> reference(grid.size(0), 0.0);
+    {
+        std::cout << "Running serial assembly." << std::endl;
+        Opm::time::StopWatch clock;
+        clock.start();
+        for (const auto& elem : elements(gv)) {
+            assembleElement(gv, elem, pressure, reference, false);
+        }
+        clock.stop();
+        std::cout << "Time: " << clock.secsSinceLast() << std::endl;
+    }
+
+#ifdef _OPENMP
+
+    const int num_threads = omp_get_max_threads();
+    const int num_chunks = 8 * num_threads;
+
+    // Threaded with atomic updates
+    {
+        std::cout << "Running atomic assembly with " << num_threads << " threads." << std::endl;
+        std::vector<double> residual(grid.size(0), 0.0);
+        Opm::ElementChunks chunks(gv, Dune::Partitions::all, num_chunks);
+        Opm::time::StopWatch clock;
+        clock.start();
+#pragma omp parallel for
+        for (const auto& chunk : chunks) {
+            for (const auto& elem : chunk) {
+                assembleElement(gv, elem, pressure, residual, true);
+            }
+        }
+        clock.stop();
+        std::cout << "Time: " << clock.secsSinceLast()
+                  << "  max difference: " << maxDifference(residual, reference) << std::endl;
+    }
+
+    // Threaded over coloured chunks
+    {
+        std::cout << "Running coloured assembly with " << num_threads << " threads." << std::endl;
+        std::vector<double> residual(grid.size(0), 0.0);
+        Opm::time::StopWatch setup_clock;
+        setup_clock.start();
+        Opm::ColouredElementChunks chunks(gv, Dune::Partitions::all, num_chunks);
+        setup_clock.stop();
+        std::cout << "Colouring time: " << setup_clock.secsSinceLast()
+                  << "  colours: " << chunks.numColours() << std::endl;
+        Opm::time::StopWatch clock;
+        clock.start();
+        for (std::size_t colour = 0; colour < chunks.numColours(); ++colour) {
+            const auto& colour_chunks = chunks.colour(colour);
+#pragma omp parallel for
+            for (std::size_t c = 0; c < colour_chunks.size(); ++c) {
+                for (const auto& elem : colour_chunks[c]) {
+                    assembleElement(gv, elem, pressure, residual, false);
+                }
+            }
+        }
+        clock.stop();
+        std::cout << "Time: " << clock.secsSinceLast()
+                  << "  max difference: " << maxDifference(residual, reference) << std::endl;
+    }
+
+#endif // _OPENMP
+
+}
@@ -0,0 +1,112 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#include <opm/grid/utility/ElementChunks.hpp>
+#include <opm/grid/utility/StopWatch.hpp>
+#include <opm/grid/CpGrid.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <iostream>
+#include <vector>
+
+// Time a threaded sweep over cell volumes and centroids before and after
+// moving the grid arrays to memory first touched by the sweeping threads.
+// Run on a multi-socket node with threads spread over the sockets, e.g.
+// OMP_PROC_BIND=spread OMP_PLACES=cores, to see the effect.
+
+namespace
+{
+
+template <class GridView, class Chunks>
+double sweep(const GridView& gv, const Chunks& chunks, const int repeats)
+{
+    double moment = 0.0;
+    for (int r = 0; r < repeats; ++r) {
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+:moment)
+#endif
+        for (const auto& chunk : chunks) {
+            for (const auto& elem : chunk) {
+                const auto& geom = elem.geometry();
+                const auto& x = geom.center();
+                moment += geom.volume() * (x[0] + x[1] + x[2]);
+                for (const auto& is : intersections(gv, elem)) {
+                    moment += is.geometry().volume();
+                }
+            }
+        }
+    }
+    return moment;
+}
+
+} // anonymous namespace
+
+
+int main(int argc, char** argv)
+{
+    Dune::MPIHelper::instance(argc, argv);
+
+    std::array<int, 3> dims = { 200, 200, 100 };
+    std::cout << "Creating grid with " << dims[0]*dims[1]*dims[2]/double(1000000) << "M cells." << std::endl;
+    std::array<double, 3> cellsz = { 1.0, 1.0, 1.0 };
+    Dune::CpGrid grid;
+    grid.createCartesian(dims, cellsz);
+    const auto& gv = grid.leafGridView();
+
+#ifdef _OPENMP
+    const int num_threads = omp_get_max_threads();
+#else
+    const int num_threads = 1;
+#endif
+    const int repeats = 10;
+    // One chunk per thread, so that each thread sweeps the cells whose
+    // arrays it touched first.
+    Opm::ElementChunks chunks(gv, Dune::Partitions::all, num_threads);
+
+    {
+        std::cout << "Running sweep with " << num_threads << " threads, serially initialised arrays." << std::endl;
+        Opm::time::StopWatch clock;
+        clock.start();
+        const double moment = sweep(gv, chunks, repeats);
+        clock.stop();
+        std::cout << "Time: " << clock.secsSinceLast() << "  (" << moment << ")" << std::endl;
+    }
+
+    {
+        Opm::time::StopWatch clock;
+        clock.start();
+        grid.firstTouch(num_threads);
+        clock.stop();
+        std::cout << "First touch time: " << clock.secsSinceLast() << std::endl;
+    }
+
+    {
+        std::cout << "Running sweep with " << num_threads << " threads, first-touched arrays." << std::endl;
+        Opm::time::StopWatch clock;
+        clock.start();
+        const double moment = sweep(gv, chunks, repeats);
+        clock.stop();
+        std::cout << "Time: " << clock.secsSinceLast() << "  (" << moment << ")" << std::endl;
+    }
+}
@@ -24,12 +24,8 @@
 
 #include <iostream>
 
-// Warning suppression for Dune includes.
-#include <opm/grid/utility/platform_dependent/disable_warnings.h>
-#include <dune/grid/io/file/vtk/vtkwriter.hh>
-#include <opm/grid/utility/platform_dependent/reenable_warnings.h>
-
 #include <opm/grid/CpGrid.hpp>
+#include <opm/grid/cpgrid/VtuWriter.hpp>
 
 #include <opm/input/eclipse/Parser/Parser.hpp>
 #include <opm/input/eclipse/Deck/Deck.hpp>
@@ -61,7 +57,7 @@ void condWriteDoubleField(std::vector<double>& fieldvector,
                           const OpmDeck& deck,
                           const std::vector<int>& global_cell,
                           const std::array<size_t, 3>& dims,
-                          VTKWriter<CpGrid::LeafGridView>& vtkwriter) {
+                          cpgrid::VtuWriter& vtkwriter) {
     if (deck.hasKeyword(fieldname)) {
         std::cout << "Found " << fieldname << "..." << std::endl;
         std::vector<double> eclVector = deck[fieldname].back().getRawDoubleData();
@@ -90,7 +86,7 @@ void condWriteIntegerField(std::vector<double>& fieldvector,
                            const OpmDeck& deck,
                            const std::vector<int>& global_cell,
                            const std::array<size_t, 3>& dims,
-                           VTKWriter<CpGrid::LeafGridView>& vtkwriter) {
+                           cpgrid::VtuWriter& vtkwriter) {
     if (deck.hasKeyword(fieldname)) {
         std::cout << "Found " << fieldname << "..." << std::endl;
         std::vector<int> eclVector = deck[fieldname].back().getIntData();
@@ -151,7 +147,7 @@ try
         grid.processEclipseFormat(&ecl_grid, nullptr, false);
     }
 
-    VTKWriter<CpGrid::LeafGridView> vtkwriter(grid.leafGridView());
+    cpgrid::VtuWriter vtkwriter(grid);
 
     const std::vector<int>& global_cell = grid.globalCell();
 
@@ -181,7 +177,7 @@ try
     std::string fname(eclipsefilename);
     std::string fnamebase = fname.substr(0, fname.find_last_of('.'));
     std::cout << "Writing to filename " << fnamebase << ".vtu" << std::endl;
-    vtkwriter.write(fnamebase, VTK::ascii);
+    vtkwriter.write(fnamebase);
 }
 catch (const std::exception &e) {
     std::cerr << "Program threw an exception: " << e.what() << "\n";
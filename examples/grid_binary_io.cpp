@@ -0,0 +1,142 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#include <opm/grid/UnstructuredGrid.h>
+#include <opm/grid/cart_grid.h>
+#include <opm/grid/utility/StopWatch.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+
+namespace
+{
+
+    // Write a grid in the text format understood by read_grid().
+    void writeTextGrid(const UnstructuredGrid& g, const std::string& fname)
+    {
+        std::ofstream os(fname);
+        os << std::setprecision(std::numeric_limits<double>::max_digits10);
+
+        const int nd = g.dimensions;
+        const int nc = g.number_of_cells;
+        const int nf = g.number_of_faces;
+        const int nn = g.number_of_nodes;
+        os << nd << ' ' << nc << ' ' << nf << ' ' << nn << ' '
+           << g.face_nodepos[nf] << ' ' << g.cell_facepos[nc] << '\n';
+        os << (g.cell_facetag != nullptr) << ' ' << (g.global_cell != nullptr) << '\n';
+        for (int d = 0; d < nd; ++d) {
+            os << g.cartdims[d] << ' ';
+        }
+        os << '\n';
+
+        auto put = [&os](const auto* data, std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i) {
+                os << data[i] << '\n';
+            }
+        };
+        put(g.node_coordinates, std::size_t(nd) * nn);
+        put(g.face_nodepos, nf + 1);
+        put(g.face_nodes, g.face_nodepos[nf]);
+        put(g.face_cells, 2 * std::size_t(nf));
+        put(g.face_areas, nf);
+        put(g.face_centroids, std::size_t(nd) * nf);
+        put(g.face_normals, std::size_t(nd) * nf);
+        put(g.cell_facepos, nc + 1);
+        for (unsigned i = 0; i < g.cell_facepos[nc]; ++i) {
+            os << g.cell_faces[i];
+            if (g.cell_facetag != nullptr) {
+                os << ' ' << g.cell_facetag[i];
+            }
+            os << '\n';
+        }
+        if (g.global_cell != nullptr) {
+            put(g.global_cell, nc);
+        }
+        put(g.cell_volumes, nc);
+        put(g.cell_centroids, std::size_t(nd) * nc);
+    }
+
+    // Touch all geometry such that lazily mapped pages are counted.
+    double checksum(const UnstructuredGrid& g)
+    {
+        double sum = 0.0;
+        for (int c = 0; c < g.number_of_cells; ++c) {
+            sum += g.cell_volumes[c];
+        }
+        for (int f = 0; f < g.number_of_faces; ++f) {
+            sum += g.face_areas[f];
+        }
+        for (int i = 0; i < g.dimensions * g.number_of_nodes; ++i) {
+            sum += g.node_coordinates[i];
+        }
+        return sum;
+    }
+
+    template <class Load, class Release>
+    void timeLoad(const char* label, Load load, Release release)
+    {
+        Opm::time::StopWatch clock;
+        clock.start();
+        UnstructuredGrid* g = load();
+        const double sum = g != nullptr ? checksum(*g) : 0.0;
+        clock.stop();
+        std::cout << std::left << std::setw(22) << label
+                  << "time: " << clock.secsSinceLast()
+                  << "  (checksum " << sum << ")" << std::endl;
+        release(g);
+    }
+
+} // anonymous namespace
+
+
+int main(int argc, char** argv)
+{
+    const int n = argc > 1 ? std::stoi(argv[1]) : 60;
+    std::cout << "Creating " << n << "x" << n << "x" << n << " grid." << std::endl;
+    UnstructuredGrid* grid = create_grid_hexa3d(n, n, n, 1.0, 1.0, 1.0);
+
+    const std::string textFile = "grid_binary_io_text.grid";
+    const std::string binaryFile = "grid_binary_io_binary.grid";
+    writeTextGrid(*grid, textFile);
+    if (!write_grid_binary(grid, binaryFile.c_str())) {
+        std::cerr << "Failed to write " << binaryFile << std::endl;
+        return EXIT_FAILURE;
+    }
+    destroy_grid(grid);
+
+    timeLoad("read_grid (text)",
+             [&] { return read_grid(textFile.c_str()); },
+             &destroy_grid);
+    timeLoad("read_grid_binary",
+             [&] { return read_grid_binary(binaryFile.c_str()); },
+             &destroy_grid);
+    timeLoad("map_grid_binary",
+             [&] { return map_grid_binary(binaryFile.c_str()); },
+             &unmap_grid_binary);
+
+    std::remove(textFile.c_str());
+    std::remove(binaryFile.c_str());
+}
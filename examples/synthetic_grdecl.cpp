@@ -0,0 +1,133 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#include <opm/grid/SyntheticCornerPointModel.hpp>
+#include <opm/grid/utility/StopWatch.hpp>
+
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <string>
+
+/**
+ * @file synthetic_grdecl.cpp
+ * @brief Write a synthetic corner-point grid of any size to a grdecl file
+ *
+ * The grid has faults, pinched-out layers, thin cells, inactive cells and
+ * sloping pillars as requested, for benchmarking the grid processing.
+ *
+ */
+
+namespace
+{
+
+    void printUsage()
+    {
+        std::cout << "Usage: synthetic_grdecl filename.grdecl [key=value ...]\n"
+                  << "Keys (default):\n"
+                  << "  nx ny nz (10)              number of cells\n"
+                  << "  dx dy (100) dz (10)        cell size\n"
+                  << "  top (2000)                 depth of the top surface at the origin\n"
+                  << "  dipx dipy (0)              depth increase per unit length\n"
+                  << "  slopex slopey (0)          horizontal pillar displacement per unit depth\n"
+                  << "  faulti faultj (0)          cells between faults, 0 for none\n"
+                  << "  throw (0)                  fault throw\n"
+                  << "  pinch (0)                  every pinch-th layer has zero thickness, 0 for none\n"
+                  << "  thin (0)                   fraction of thin cells for MINPV to remove\n"
+                  << "  thickness (0.01)           thickness of thin cells\n"
+                  << "  inactive (0)               fraction of cells with ACTNUM 0\n"
+                  << "  poro (0)                   porosity written as PORO, 0 for none\n"
+                  << "  minpv (0)                  threshold written as MINPV, 0 for none\n"
+                  << "  seed (0)                   seed of the random choices" << std::endl;
+    }
+
+} // anonymous namespace
+
+
+int main(int argc, char** argv)
+try
+{
+    if (argc < 2) {
+        printUsage();
+        return EXIT_FAILURE;
+    }
+
+    Opm::SyntheticCornerPointParameters param;
+    auto& p = param;
+    const std::map<std::string, std::function<void(const std::string&)>> setters = {
+        { "nx", [&p](const std::string& v) { p.dims[0] = std::stoi(v); } },
+        { "ny", [&p](const std::string& v) { p.dims[1] = std::stoi(v); } },
+        { "nz", [&p](const std::string& v) { p.dims[2] = std::stoi(v); } },
+        { "dx", [&p](const std::string& v) { p.cellSize[0] = std::stod(v); } },
+        { "dy", [&p](const std::string& v) { p.cellSize[1] = std::stod(v); } },
+        { "dz", [&p](const std::string& v) { p.cellSize[2] = std::stod(v); } },
+        { "top", [&p](const std::string& v) { p.top = std::stod(v); } },
+        { "dipx", [&p](const std::string& v) { p.dip[0] = std::stod(v); } },
+        { "dipy", [&p](const std::string& v) { p.dip[1] = std::stod(v); } },
+        { "slopex", [&p](const std::string& v) { p.pillarSlope[0] = std::stod(v); } },
+        { "slopey", [&p](const std::string& v) { p.pillarSlope[1] = std::stod(v); } },
+        { "faulti", [&p](const std::string& v) { p.faultSpacing[0] = std::stoi(v); } },
+        { "faultj", [&p](const std::string& v) { p.faultSpacing[1] = std::stoi(v); } },
+        { "throw", [&p](const std::string& v) { p.faultThrow = std::stod(v); } },
+        { "pinch", [&p](const std::string& v) { p.pinchOutInterval = std::stoi(v); } },
+        { "thin", [&p](const std::string& v) { p.thinFraction = std::stod(v); } },
+        { "thickness", [&p](const std::string& v) { p.thinThickness = std::stod(v); } },
+        { "inactive", [&p](const std::string& v) { p.inactiveFraction = std::stod(v); } },
+        { "poro", [&p](const std::string& v) { p.porosity = std::stod(v); } },
+        { "minpv", [&p](const std::string& v) { p.minPoreVolume = std::stod(v); } },
+        { "seed", [&p](const std::string& v) { p.seed = std::stoull(v); } },
+    };
+    for (int arg = 2; arg < argc; ++arg) {
+        const std::string option(argv[arg]);
+        const auto eq = option.find('=');
+        const auto setter = eq == std::string::npos ? setters.end() : setters.find(option.substr(0, eq));
+        if (setter == setters.end()) {
+            std::cerr << "Unrecognized option '" << option << "'." << std::endl;
+            printUsage();
+            return EXIT_FAILURE;
+        }
+        setter->second(option.substr(eq + 1));
+    }
+
+    const char* filename = argv[1];
+    std::ofstream outfile(filename, std::ios::out | std::ios::trunc);
+    if (!outfile) {
+        std::cerr << "Can't open output file " << filename << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "Writing " << double(p.dims[0]) * p.dims[1] * p.dims[2] / 1e6
+              << "M cells to '" << filename << "' ..." << std::endl;
+    Opm::time::StopWatch clock;
+    clock.start();
+    Opm::writeCornerPointModel(param, outfile);
+    outfile.close();
+    clock.stop();
+    std::cout << "Done in " << clock.secsSinceStart() << " s." << std::endl;
+    return EXIT_SUCCESS;
+}
+catch (const std::exception& e) {
+    std::cerr << "Error: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,124 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#include <opm/grid/utility/StopWatch.hpp>
+#include <opm/grid/utility/VelocityInterpolation.hpp>
+#include <opm/grid/GridManager.hpp>
+#include <opm/grid/UnstructuredGrid.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+// Interpolate a linear velocity field with the extended CVI scheme at
+// random points, as a streamline tracer would, comparing the per-point
+// interface with the batched one.
+
+int main()
+{
+    const int nx = 100;
+    const int ny = 100;
+    const int nz = 20;
+    Opm::GridManager gm(nx, ny, nz, 1.0, 1.0, 1.0);
+    const UnstructuredGrid& grid = *gm.c_grid();
+    const int dim = grid.dimensions;
+    std::cout << "Grid with " << grid.number_of_cells << " cells." << std::endl;
+
+    // Fluxes of the field v = (1 + x, 2 - y, 0.5 z).
+    std::vector<double> flux(grid.number_of_faces);
+    for (int face = 0; face < grid.number_of_faces; ++face) {
+        const double* c = grid.face_centroids + dim*face;
+        const double* n = grid.face_normals + dim*face;
+        flux[face] = (1.0 + c[0])*n[0] + (2.0 - c[1])*n[1] + 0.5*c[2]*n[2];
+    }
+
+    Opm::time::StopWatch setup_clock;
+    setup_clock.start();
+    Opm::VelocityInterpolationECVI ecvi(grid);
+    ecvi.setupFluxes(flux.data());
+    setup_clock.stop();
+    std::cout << "Setup time: " << setup_clock.secsSinceLast() << std::endl;
+    const Opm::VelocityInterpolationInterface& interp = ecvi;
+
+    // Random points inside random cells, sorted by cell.
+    const int num_points = 10000000;
+    std::mt19937 gen(1234);
+    std::uniform_int_distribution<int> random_cell(0, grid.number_of_cells - 1);
+    std::uniform_real_distribution<double> offset(-0.5, 0.5);
+    std::vector<int> cells(num_points);
+    for (int& cell : cells) {
+        cell = random_cell(gen);
+    }
+    std::sort(cells.begin(), cells.end());
+    std::vector<double> x(dim*num_points);
+    for (int p = 0; p < num_points; ++p) {
+        for (int dd = 0; dd < dim; ++dd) {
+            x[dim*p + dd] = grid.cell_centroids[dim*cells[p] + dd] + offset(gen);
+        }
+    }
+
+    std::vector<double> v_point(dim*num_points);
+    {
+        std::cout << "Interpolating " << num_points << " points one at a time." << std::endl;
+        Opm::time::StopWatch clock;
+        clock.start();
+        for (int p = 0; p < num_points; ++p) {
+            interp.interpolate(cells[p], &x[dim*p], &v_point[dim*p]);
+        }
+        clock.stop();
+        std::cout << "Time: " << clock.secsSinceLast() << std::endl;
+    }
+
+#ifdef _OPENMP
+    const int num_threads = omp_get_max_threads();
+#else
+    const int num_threads = 1;
+#endif
+    std::vector<double> v_batch(dim*num_points);
+    {
+        std::cout << "Interpolating " << num_points << " points in a batch with "
+                  << num_threads << " threads." << std::endl;
+        Opm::time::StopWatch clock;
+        clock.start();
+        interp.interpolateBatch(num_points, dim, cells.data(), x.data(), v_batch.data());
+        clock.stop();
+        std::cout << "Time: " << clock.secsSinceLast() << std::endl;
+    }
+
+    double diff = 0.0;
+    double error = 0.0;
+    for (int p = 0; p < num_points; ++p) {
+        const double* xp = &x[dim*p];
+        const double exact[3] = { 1.0 + xp[0], 2.0 - xp[1], 0.5*xp[2] };
+        for (int dd = 0; dd < dim; ++dd) {
+            diff = std::max(diff, std::abs(v_batch[dim*p + dd] - v_point[dim*p + dd]));
+            error = std::max(error, std::abs(v_batch[dim*p + dd] - exact[dd]));
+        }
+    }
+    std::cout << "Max difference: " << diff << "  max error: " << error << std::endl;
+}
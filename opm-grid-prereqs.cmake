@@ -33,6 +33,7 @@ set (opm-grid_DEPS
   "PTScotch"
   "Scotch"
   "METIS"
+  "ZLIB"
   )
 
 find_package_deps(opm-grid)
@@ -20,9 +20,15 @@
 #include <opm/grid/ColumnExtract.hpp>
 
 #include <opm/grid/UnstructuredGrid.h>
+#include <opm/grid/CpGrid.hpp>
+#include <opm/grid/GridHelpers.hpp>
+#include <opm/grid/cpgrid/GridHelpers.hpp>
+
+#include <dune/grid/common/partitionset.hh>
 
 #include <algorithm>
 #include <map>
+#include <numeric>
 
 namespace {
 
@@ -63,11 +69,145 @@ bool neighbours(const UnstructuredGrid& grid, const int c0, const int c1)
     return false;
 }
 
+/// Columns in compressed row storage for grids with the UgGridHelpers
+/// interface.
+template <class Grid>
+void extractColumnsImpl(const Grid& grid, Opm::GridColumns& columns)
+{
+    namespace UgGridHelpers = Opm::UgGridHelpers;
+    const int num_cells = UgGridHelpers::numCells(grid);
+    const int* dims = UgGridHelpers::cartDims(grid);
+    const int* global_cell = UgGridHelpers::globalCell(grid);
+    const int num_pillars = dims[0] * dims[1];
+
+    // Pillar and k index of each cell.
+    std::vector<int> pillar(num_cells);
+    std::vector<int> k(num_cells);
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for (int cell = 0; cell < num_cells; ++cell) {
+        const int index = global_cell ? global_cell[cell] : cell; // If null, assume mapping is identity.
+        pillar[cell] = index % num_pillars;
+        k[cell] = index / num_pillars;
+    }
+
+    // Bucket the cells by pillar.
+    std::vector<int> pillar_start(num_pillars + 1, 0);
+    for (int cell = 0; cell < num_cells; ++cell) {
+        ++pillar_start[pillar[cell] + 1];
+    }
+    std::partial_sum(pillar_start.begin(), pillar_start.end(), pillar_start.begin());
+    std::vector<int> cells(num_cells);
+    {
+        std::vector<int> pos(pillar_start.begin(), pillar_start.end() - 1);
+        for (int cell = 0; cell < num_cells; ++cell) {
+            cells[pos[pillar[cell]]++] = cell;
+        }
+    }
+    std::vector<int> used_pillars;
+    for (int p = 0; p < num_pillars; ++p) {
+        if (pillar_start[p + 1] > pillar_start[p]) {
+            used_pillars.push_back(p);
+        }
+    }
+    const int num_used = used_pillars.size();
+
+    const auto cell_faces = UgGridHelpers::cell2Faces(grid);
+    const auto face_cells = UgGridHelpers::faceCells(grid);
+    const auto connected = [&](const int c0, const int c1) {
+        for (const int f : cell_faces[c0]) {
+            if (face_cells(f, 0) == c1 || face_cells(f, 1) == c1) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    // Sort each pillar by k and count its connected parts.
+    std::vector<int> part_start(num_used + 1, 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 64)
+#endif
+    for (int i = 0; i < num_used; ++i) {
+        const auto begin = cells.begin() + pillar_start[used_pillars[i]];
+        const auto end = cells.begin() + pillar_start[used_pillars[i] + 1];
+        std::sort(begin, end, [&k](const int c0, const int c1) { return k[c0] < k[c1]; });
+        int parts = 1;
+        for (auto it = begin + 1; it < end; ++it) {
+            if (!connected(*(it - 1), *it)) {
+                ++parts;
+            }
+        }
+        part_start[i + 1] = parts;
+    }
+    std::partial_sum(part_start.begin(), part_start.end(), part_start.begin());
+
+    // Split the pillars into columns.
+    const int num_columns = part_start.back();
+    columns.start.resize(num_columns + 1);
+    columns.pillar.resize(num_columns);
+    columns.spans_ranks.clear();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 64)
+#endif
+    for (int i = 0; i < num_used; ++i) {
+        const int p = used_pillars[i];
+        int col = part_start[i];
+        columns.start[col] = pillar_start[p];
+        columns.pillar[col] = p;
+        for (int pos = pillar_start[p] + 1; pos < pillar_start[p + 1]; ++pos) {
+            if (!connected(cells[pos - 1], cells[pos])) {
+                ++col;
+                columns.start[col] = pos;
+                columns.pillar[col] = p;
+            }
+        }
+    }
+    columns.start[num_columns] = num_cells;
+    columns.cells.swap(cells);
+}
+
 } // anonymous namespace
 
 
 namespace Opm {
 
+void extractColumns(const UnstructuredGrid& grid, GridColumns& columns)
+{
+    extractColumnsImpl(grid, columns);
+}
+
+void extractColumns(const Dune::CpGrid& grid, GridColumns& columns)
+{
+    extractColumnsImpl(grid, columns);
+    if (grid.comm().size() == 1) {
+        return;
+    }
+
+    // Mark the pillars with interior cells on this rank.
+    const auto& dims = grid.logicalCartesianSize();
+    const int num_pillars = dims[0] * dims[1];
+    const auto& global_cell = grid.globalCell();
+    std::vector<int> ranks(num_pillars, 0);
+    int num_interior = 0;
+    for (const auto& elem : elements(grid.leafGridView(), Dune::Partitions::interior)) {
+        ranks[global_cell[elem.index()] % num_pillars] = 1;
+        ++num_interior;
+    }
+    // A grid that has not been distributed has only interior cells, and
+    // all ranks hold all of them.
+    if (grid.comm().max(grid.size(0) - num_interior) == 0) {
+        return;
+    }
+    grid.comm().sum(ranks.data(), num_pillars);
+
+    columns.spans_ranks.resize(columns.size());
+    for (int col = 0; col < columns.size(); ++col) {
+        columns.spans_ranks[col] = ranks[columns.pillar[col]] > 1;
+    }
+}
+
 void extractColumn(const UnstructuredGrid& grid, std::vector<std::vector<int> >& columns)
 {
     const int* dims = grid.cartdims;
@@ -17,11 +17,19 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#ifndef OPM_COLUMNEXTRACT_HEADER_INCLUDED
+#define OPM_COLUMNEXTRACT_HEADER_INCLUDED
+
 #include <opm/grid/UnstructuredGrid.h>
+#include <opm/grid/utility/IteratorRange.hpp>
 #include <vector>
 
 struct UnstructuredGrid;
 
+namespace Dune {
+class CpGrid;
+}
+
 namespace Opm {
 
 /// Extract each column of the grid.
@@ -32,4 +40,53 @@ namespace Opm {
 ///         centered at (i, j) in the second variable, and i+jN in the first variable.
 void extractColumn(const UnstructuredGrid& grid, std::vector<std::vector<int> >& columns);
 
+/// Columns of a grid in compressed row storage.
+struct GridColumns
+{
+    /// Column c consists of cells[start[c]], ..., cells[start[c + 1] - 1],
+    /// ordered by increasing k.
+    std::vector<int> start;
+    /// Cells of all columns.
+    std::vector<int> cells;
+    /// Cartesian pillar index i + j*nx of each column.
+    std::vector<int> pillar;
+    /// For distributed grids: whether interior cells of the pillar of each
+    /// column exist on more than one rank. Empty for serial grids.
+    std::vector<char> spans_ranks;
+
+    /// Number of columns.
+    int size() const
+    {
+        return start.empty() ? 0 : static_cast<int>(start.size()) - 1;
+    }
+
+    /// Cells of a column.
+    iterator_range_pod<int> operator[](int c) const
+    {
+        return { cells.data() + start[c], cells.data() + start[c + 1] };
+    }
+};
+
+/// Extract each column of the grid in compressed row storage.
+///
+/// Finds the same columns as extractColumn(), but numbers them by
+/// increasing (i, j), with the connected parts of a pillar split at gaps
+/// following each other from top to bottom. The k index of every cell is
+/// computed once and the columns are sorted and split in parallel.
+///  \note Assumes the pillars of the grid are all vertically aligned.
+///  \param grid The grid from which to extract the columns.
+///  \param columns The columns of the grid.
+void extractColumns(const UnstructuredGrid& grid, GridColumns& columns);
+
+/// Extract each column of the local cells of a CpGrid.
+///
+/// Works as for UnstructuredGrid on the current view. On distributed grids
+/// the columns consist of the cells on this rank, including overlap cells,
+/// and columns.spans_ranks marks the columns whose pillar has interior
+/// cells on other ranks as well. That is a collective operation. A grid
+/// is taken to be distributed if some rank has overlap cells.
+void extractColumns(const Dune::CpGrid& grid, GridColumns& columns);
+
 } // namespace Opm
+
+#endif // OPM_COLUMNEXTRACT_HEADER_INCLUDED
@@ -49,9 +49,12 @@
 #include <opm/grid/cpgpreprocess/preprocess.h>
 #include <opm/grid/utility/platform_dependent/reenable_warnings.h> //  Not really needed it seems, but alas.
 #include "common/GridEnums.hpp"
+#include <opm/grid/utility/CartesianToCompressedMap.hpp>
 #include <opm/grid/utility/OpmWellType.hpp>
 
+#include <cstdint>
 #include <set>
+#include <string>
 
 namespace Opm
 {
@@ -334,6 +337,21 @@ namespace Dune
         /// Set whether we want to have unique boundary ids.
         /// \param uids if true, each boundary intersection will have a unique boundary id.
         void setUniqueBoundaryIds(bool uids);
+
+        /// Move the geometry and topology arrays of the current view to
+        /// memory first touched in parallel.
+        ///
+        /// The arrays are filled by a single thread during construction
+        /// and distribution, so with a first-touch page placement policy
+        /// they all reside on one NUMA node. This copies them such that the
+        /// part of each array belonging to the elements of chunk t of an
+        /// ElementChunks object with num_threads chunks is placed on the
+        /// NUMA node of OpenMP thread t. Faces and points are split into
+        /// num_threads equal blocks. globalCell() is not moved. Call after
+        /// the grid is constructed and distributed, before threaded loops
+        /// with a static schedule.
+        /// \param num_threads Number of threads, 0 for omp_get_max_threads().
+        void firstTouch(int num_threads = 0);
        
 
         // --- Dune interface below ---
@@ -349,6 +367,14 @@ namespace Dune
         /// Return maximum level defined in this grid. Levels are 0 and 1,  maxlevel = 1 (not counting leafview), 0 = the coarsest level.
         int maxLevel() const;
 
+        /// \brief Counter that changes whenever the grid is modified.
+        ///
+        /// Incremented when the grid is (re)built, load balanced, adapted,
+        /// restarted from a checkpoint, or switched between the global and
+        /// distributed view. Caches of per-element data can compare it to
+        /// detect that they are stale.
+        std::uint64_t generation() const;
+
         /// Iterator to first entity of given codim on level
         template<int codim>
         typename Traits::template Codim<codim>::LevelIterator lbegin (int level) const;
@@ -795,7 +821,7 @@ namespace Dune
 
         /// @brief Define the cells, cell_to_point_, global_cell_, cell_to_face_, face_to_cell_, for each refined level grid.
         void populateRefinedCells(std::vector<Dune::cpgrid::EntityVariableBase<cpgrid::Geometry<3,3>>>& refined_cells_vec,
-                                  std::vector<std::vector<std::array<int,8>>>& refined_cell_to_point_vec,
+                                  std::vector<cpgrid::CellToPointTable>& refined_cell_to_point_vec,
                                   std::vector<std::vector<int>>& refined_global_cell_vec,
                                   const std::vector<int>& refined_cell_count_vec,
                                   std::vector<cpgrid::OrientedEntityTable<0,1>>& refined_cell_to_face_vec,
@@ -825,7 +851,7 @@ namespace Dune
                                              const std::vector<int>& refined_face_count_vec,
                                              /* Refined cell argumets */
                                              std::vector<Dune::cpgrid::EntityVariableBase<cpgrid::Geometry<3,3>>>& refined_cells_vec,
-                                             std::vector<std::vector<std::array<int,8>>>& refined_cell_to_point_vec,
+                                             std::vector<cpgrid::CellToPointTable>& refined_cell_to_point_vec,
                                              std::vector<std::vector<int>>& refined_global_cell_vec,
                                              const std::vector<int>& refined_cell_count_vec,
                                              std::vector<cpgrid::OrientedEntityTable<0,1>>& refined_cell_to_face_vec,
@@ -870,7 +896,7 @@ namespace Dune
 
         /// @brief Define the cells, cell_to_point_, cell_to_face_, face_to_cell_, for the leaf grid view (or adapted grid).
         void populateLeafGridCells(Dune::cpgrid::EntityVariableBase<cpgrid::Geometry<3,3>>& adapted_cells,
-                                   std::vector<std::array<int,8>>& adapted_cell_to_point,
+                                   cpgrid::CellToPointTable& adapted_cell_to_point,
                                    const int& cell_count,
                                    cpgrid::OrientedEntityTable<0,1>& adapted_cell_to_face,
                                    cpgrid::OrientedEntityTable<1,0>& adapted_face_to_cell,
@@ -899,7 +925,7 @@ namespace Dune
                                            const int& face_count,
                                            /* Leaf grid View Cells argumemts  */
                                            Dune::cpgrid::EntityVariableBase<cpgrid::Geometry<3,3>>& adapted_cells,
-                                           std::vector<std::array<int,8>>& adapted_cell_to_point,
+                                           cpgrid::CellToPointTable& adapted_cell_to_point,
                                            const int& cell_count,
                                            cpgrid::OrientedEntityTable<0,1>& adapted_cell_to_face,
                                            cpgrid::OrientedEntityTable<1,0>& adapted_face_to_cell,
@@ -1204,8 +1230,16 @@ namespace Dune
         ///        on the leaf grid view.
         ///        Notice that cells that vanished and do not appear on the leaf grid view will not be considered.
         ///        global_cell_[ cell index in level grid ] coincide with (local) Cartesian Index.
+        /// \deprecated Use mapLocalCartesianIndicesToLeafIndices(), which has O(1) lookup and is built in parallel.
+        [[deprecated("Use mapLocalCartesianIndicesToLeafIndices()")]]
         std::vector<std::unordered_map<std::size_t, std::size_t>> mapLocalCartesianIndexSetsToLeafIndexSet() const;
 
+        /// @brief Same as mapLocalCartesianIndexSetsToLeafIndexSet(), but each level map is an
+        ///        Opm::CartesianToCompressedMap (dense array or bitmap, O(1) lookup) built in parallel,
+        ///        instead of a hash map. For cells not on the leaf grid view, operator[] returns -1 and
+        ///        at() throws std::out_of_range.
+        std::vector<Opm::CartesianToCompressedMap> mapLocalCartesianIndicesToLeafIndices() const;
+
         /// @brief Reverse map: from leaf index cell to { level, local/level Cartesian index of the cell }
         std::vector<std::array<int,2>> mapLeafIndexSetToLocalCartesianIndexSets() const;
 
@@ -1735,6 +1769,29 @@ namespace Dune
 
         const Vector faceAreaNormalEcl(int face) const;
 
+        /// \brief ECL geometry of all cells and faces of the current view.
+        struct EclGeometry
+        {
+            /// cellCenterDepth() of each cell.
+            std::vector<double> cell_center_depth;
+            /// Position in face_center of the first intersection of each
+            /// cell. Size number of cells + 1.
+            std::vector<int> cell_face_start;
+            /// faceCenterEcl() of each intersection, by cell and then in
+            /// the order of intersection iteration.
+            std::vector<Vector> face_center;
+            /// faceAreaNormalEcl() of each face.
+            std::vector<Vector> face_area_normal;
+        };
+
+        /// \brief Get cellCenterDepth(), faceCenterEcl() and
+        /// faceAreaNormalEcl() for all cells and faces.
+        ///
+        /// Computed in one threaded pass over the grid on first use, and
+        /// cached until generation() changes. Do not make the first call
+        /// concurrently with other calls to this function.
+        const EclGeometry& eclGeometry() const;
+
 
         // Geometry
         /// \brief Get the Position of a vertex.
@@ -1905,6 +1962,42 @@ namespace Dune
 
         /// \brief Switch to the distributed view.
         void switchToDistributedView();
+
+        /// \brief Free the topology and geometry of the global view.
+        ///
+        /// After load balancing, the rank that read the grid still holds
+        /// the whole global grid. This releases everything except what
+        /// scatterData() and gatherData() need: the number of cells and
+        /// points, the global cell ids and the communication interfaces.
+        /// Afterwards switchToGlobalView() throws. Needs the distributed
+        /// view to be current, and does no communication.
+        void releaseGlobalView();
+
+        /// \brief Whether releaseGlobalView() has been called.
+        bool globalViewReleased() const;
+
+        /// \brief Write the distributed view to one checkpoint file per process.
+        ///
+        /// Each process writes its local topology, geometry, global ids and
+        /// cell index set to <basename>.<rank>. Collective.
+        /// \param basename The name of the files without the rank suffix.
+        /// \return The hash of the grid and partitioning of all processes.
+        std::uint64_t writeDistributedCheckpoint(const std::string& basename) const;
+
+        /// \brief Set up the distributed view from checkpoint files.
+        ///
+        /// Each process reads <basename>.<rank> as written by
+        /// writeDistributedCheckpoint() with the same number of processes
+        /// and recomputes the partition types and communication interfaces
+        /// itself, without the root rank and without a global grid. There
+        /// is no global view afterwards, so switchToGlobalView(),
+        /// scatterData() and gatherData() are not available. Needs a grid
+        /// that has not been load balanced. Collective: throws on all
+        /// processes if any of the files is invalid or the files are not
+        /// from the same checkpoint.
+        /// \param basename The name of the files without the rank suffix.
+        /// \return The hash of the grid and partitioning of all processes.
+        std::uint64_t readDistributedCheckpoint(const std::string& basename);
         //@}
 
 #if HAVE_MPI
@@ -1991,6 +2084,11 @@ namespace Dune
         std::vector<std::shared_ptr<cpgrid::CpGridData>> distributed_data_;
         /** @brief A pointer to the current data used. */
         std::vector<std::shared_ptr<cpgrid::CpGridData>>* current_data_;
+        /** @brief Cached ECL geometry, and the generation() it was computed for. */
+        mutable std::shared_ptr<const EclGeometry> ecl_geometry_;
+        mutable std::uint64_t ecl_geometry_generation_ = 0;
+        /** @brief Incremented on every modification, see generation(). */
+        std::uint64_t generation_ = 0;
         /** @brief To get the level given the lgr-name. Default, {"GLOBAL", 0}. */
         std::map<std::string,int> lgr_names_ = {{"GLOBAL", 0}};
         /**
@@ -186,7 +186,7 @@ void addWellConnections(GraphOfGrid<Dune::CpGrid>& gog,
 {
     for (const auto& w : wells)
     {
-        gog.addWell(w, checkWellIntersections);
+        gog.addWell(std::set<int>(w.begin(), w.end()), checkWellIntersections);
     }
 }
 
@@ -0,0 +1,154 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#include <opm/grid/GridArrays.hpp>
+
+#include <opm/grid/CpGrid.hpp>
+#include <opm/grid/cpgrid/CpGridData.hpp>
+#include <opm/grid/cpgrid/GridHelpers.hpp>
+
+#include <cstddef>
+
+namespace Opm
+{
+namespace UgGridHelpers
+{
+
+namespace
+{
+
+/// Common row length of a compressed row table, or zero if rows differ.
+int uniformRowLength(const unsigned* pos, int rows)
+{
+    if (rows == 0) {
+        return 0;
+    }
+    const unsigned len = pos[1] - pos[0];
+    for (int r = 1; r < rows; ++r) {
+        if (pos[r + 1] - pos[r] != len) {
+            return 0;
+        }
+    }
+    return static_cast<int>(len);
+}
+
+} // anonymous namespace
+
+GridArrays::GridArrays(const UnstructuredGrid& grid)
+    : dimensions_(grid.dimensions)
+    , num_cells_(grid.number_of_cells)
+    , num_faces_(grid.number_of_faces)
+    , num_vertices_(grid.number_of_nodes)
+    , cell_faces_(grid.cell_faces)
+    , cell_facepos_(grid.cell_facepos)
+    , face_nodes_(grid.face_nodes)
+    , face_nodepos_(grid.face_nodepos)
+    , face_cells_(grid.face_cells)
+    , cell_centroids_(grid.cell_centroids, grid.dimensions)
+    , cell_volumes_(grid.cell_volumes)
+    , face_centroids_(grid.face_centroids, grid.dimensions)
+    , face_normals_(grid.face_normals, grid.dimensions)
+    , face_areas_(grid.face_areas)
+    , node_coordinates_(grid.node_coordinates, grid.dimensions)
+{
+    computeArities();
+}
+
+GridArrays::GridArrays(const Dune::CpGrid& grid)
+    : dimensions_(Dune::CpGrid::dimension)
+    , num_cells_(grid.numCells())
+    , num_faces_(grid.numFaces())
+    , num_vertices_(grid.numVertices())
+{
+    using Data = Dune::cpgrid::CpGridData;
+    const Data& data = *grid.currentData().back();
+    const std::size_t nd = dimensions_;
+    const std::size_t nc = num_cells_;
+    const std::size_t nf = num_faces_;
+
+    // The row starts of the tables are non-negative ints, which may be
+    // accessed as unsigned.
+    cell_facepos_ = reinterpret_cast<const unsigned*>(data.cellFacePos());
+    face_nodes_ = data.faceVertices();
+    face_nodepos_ = reinterpret_cast<const unsigned*>(data.faceVertexPos());
+    cell_centroids_ = CoordinateView(data.centroids<0>(), Data::centroidStride<0>());
+    face_centroids_ = CoordinateView(data.centroids<1>(), Data::centroidStride<1>());
+    node_coordinates_ = CoordinateView(data.centroids<3>(), Data::centroidStride<3>());
+
+    // CpGrid stores face indices with orientation, face cells as
+    // variable length rows, unit normals and the volumes inside the
+    // geometries. Layout: cell_faces, face_cells.
+    const std::size_t num_cell_faces = nc > 0 ? cell_facepos_[nc] : 0;
+    int_storage_.resize(num_cell_faces + 2*nf);
+    // Layout: cell_volumes, face_normals, face_areas.
+    double_storage_.resize(nc + nd*nf + nf);
+
+    int* cell_faces = int_storage_.data();
+    int* face_cells = cell_faces + num_cell_faces;
+    double* cell_volumes = double_storage_.data();
+    double* face_normals = cell_volumes + nc;
+    double* face_areas = face_normals + nd*nf;
+
+    const auto c2f = cell2Faces(grid);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int c = 0; c < num_cells_; ++c) {
+        unsigned i = cell_facepos_[c];
+        for (const int f : c2f[c]) {
+            cell_faces[i++] = f;
+        }
+        cell_volumes[c] = grid.cellVolume(c);
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int f = 0; f < num_faces_; ++f) {
+        face_cells[2*f + 0] = grid.faceCell(f, 0);
+        face_cells[2*f + 1] = grid.faceCell(f, 1);
+
+        // CpGrid stores unit normals, UnstructuredGrid area weighted ones.
+        const double area = grid.faceArea(f);
+        const auto& normal = grid.faceNormal(f);
+        for (std::size_t d = 0; d < nd; ++d) {
+            face_normals[nd*f + d] = area * normal[d];
+        }
+        face_areas[f] = area;
+    }
+
+    cell_faces_ = cell_faces;
+    face_cells_ = face_cells;
+    cell_volumes_ = cell_volumes;
+    face_normals_ = CoordinateView(face_normals, nd);
+    face_areas_ = face_areas;
+
+    computeArities();
+}
+
+void GridArrays::computeArities()
+{
+    cell_face_arity_ = uniformRowLength(cell_facepos_, num_cells_);
+    face_vertex_arity_ = uniformRowLength(face_nodepos_, num_faces_);
+}
+
+} // end namespace UgGridHelpers
+} // end namespace Opm
@@ -0,0 +1,214 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef OPM_GRIDARRAYS_HEADER_INCLUDED
+#define OPM_GRIDARRAYS_HEADER_INCLUDED
+
+#include <opm/grid/GridHelpers.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace Dune
+{
+class CpGrid;
+}
+
+namespace Opm
+{
+namespace UgGridHelpers
+{
+
+/// \brief Non-owning view of dimensions() doubles per entity, such as
+/// centroids, those of entity i starting stride() doubles after those of
+/// entity i - 1.
+class CoordinateView
+{
+public:
+    CoordinateView() = default;
+
+    CoordinateView(const double* data, std::size_t stride)
+        : data_(data), stride_(stride)
+    {}
+
+    const double* operator[](int i) const { return data_ + stride_*i; }
+    const double* data() const { return data_; }
+    std::size_t stride() const { return stride_; }
+
+private:
+    const double* data_ = nullptr;
+    std::size_t stride_ = 0;
+};
+
+/// \brief Arrays describing the topology and geometry of a grid.
+///
+/// The per-entity accessors of UgGridHelpers dispatch per call and, for
+/// CpGrid, go through OrientedEntityTable rows and EntityRep conversions.
+/// This class exposes the same information as raw arrays in the layout of
+/// UnstructuredGrid, such that kernels can loop over them directly:
+///   - cell to faces and face to vertices as compressed rows,
+///   - face to cells as two entries per face, -1 on the boundary,
+///   - centroids, normals and vertex coordinates as CoordinateView,
+///     normals being area weighted.
+///
+/// For an UnstructuredGrid the arrays are those of the grid and nothing is
+/// copied. For a CpGrid the face to vertices table, the cell face
+/// positions, the centroids and the vertex coordinates are views of the
+/// storage of the leaf view. The cell faces, face cells, volumes, areas
+/// and area weighted normals are computed in parallel on construction.
+///
+/// The free functions below model the UgGridHelpers interface used by
+/// grid kernels, so templates written against it accept a GridArrays.
+class GridArrays
+{
+public:
+    /// \brief Refer to the arrays of an UnstructuredGrid.
+    ///
+    /// The grid must outlive this object.
+    explicit GridArrays(const UnstructuredGrid& grid);
+
+    /// \brief Refer to the leaf view of a CpGrid, computing the arrays it
+    /// does not store.
+    ///
+    /// The grid must outlive this object and not be modified meanwhile.
+    explicit GridArrays(const Dune::CpGrid& grid);
+
+    GridArrays(GridArrays&&) = default;
+    GridArrays& operator=(GridArrays&&) = default;
+    GridArrays(const GridArrays&) = delete;
+    GridArrays& operator=(const GridArrays&) = delete;
+
+    int dimensions() const { return dimensions_; }
+    int numCells() const { return num_cells_; }
+    int numFaces() const { return num_faces_; }
+    int numVertices() const { return num_vertices_; }
+
+    /// \brief The cell to faces mapping.
+    SparseTableView cellFaces() const
+    { return SparseTableView(cell_faces_, cell_facepos_, num_cells_); }
+
+    /// \brief The face to vertices mapping.
+    SparseTableView faceVertices() const
+    { return SparseTableView(face_nodes_, face_nodepos_, num_faces_); }
+
+    const int* cellFacesData() const { return cell_faces_; }
+    const unsigned* cellFacePos() const { return cell_facepos_; }
+    const int* faceVerticesData() const { return face_nodes_; }
+    const unsigned* faceVertexPos() const { return face_nodepos_; }
+
+    /// \brief Face to cells, two entries per face.
+    const int* faceCells() const { return face_cells_; }
+    int faceCell(int face, int side) const { return face_cells_[2*face + side]; }
+
+    CoordinateView cellCentroids() const { return cell_centroids_; }
+    const double* cellVolumes() const { return cell_volumes_; }
+    CoordinateView faceCentroids() const { return face_centroids_; }
+    CoordinateView faceNormals() const { return face_normals_; }
+    const double* faceAreas() const { return face_areas_; }
+    CoordinateView vertexCoordinates() const { return node_coordinates_; }
+
+    const double* cellCentroid(int cell) const { return cell_centroids_[cell]; }
+    const double* faceCentroid(int face) const { return face_centroids_[face]; }
+    const double* faceNormal(int face) const { return face_normals_[face]; }
+
+    /// \brief Number of faces of every cell if that is the same for all
+    /// cells (e.g. six for hexahedral grids), otherwise zero.
+    int cellFaceArity() const { return cell_face_arity_; }
+
+    /// \brief Number of vertices of every face if that is the same for
+    /// all faces, otherwise zero.
+    int faceVertexArity() const { return face_vertex_arity_; }
+
+    /// \brief Call f(cell, face, half_face) for each face of each cell.
+    ///
+    /// half_face is the position of the face in cellFacesData(). Grids
+    /// with six faces per cell use a loop with fixed trip count that the
+    /// compiler can unroll and vectorise.
+    template<class F>
+    void forEachCellFace(F&& f) const
+    {
+        if (cell_face_arity_ == 6) {
+            forEachCellFaceImpl<6>(f);
+        } else {
+            forEachCellFaceImpl<0>(f);
+        }
+    }
+
+private:
+    template<int Arity, class F>
+    void forEachCellFaceImpl(F& f) const
+    {
+        for (int c = 0; c < num_cells_; ++c) {
+            if constexpr (Arity > 0) {
+                const int begin = Arity*c;
+                for (int k = 0; k < Arity; ++k) {
+                    f(c, cell_faces_[begin + k], begin + k);
+                }
+            } else {
+                for (unsigned i = cell_facepos_[c]; i < cell_facepos_[c + 1]; ++i) {
+                    f(c, cell_faces_[i], static_cast<int>(i));
+                }
+            }
+        }
+    }
+
+    void computeArities();
+
+    int dimensions_ = 0;
+    int num_cells_ = 0;
+    int num_faces_ = 0;
+    int num_vertices_ = 0;
+    int cell_face_arity_ = 0;
+    int face_vertex_arity_ = 0;
+
+    const int* cell_faces_ = nullptr;
+    const unsigned* cell_facepos_ = nullptr;
+    const int* face_nodes_ = nullptr;
+    const unsigned* face_nodepos_ = nullptr;
+    const int* face_cells_ = nullptr;
+    CoordinateView cell_centroids_;
+    const double* cell_volumes_ = nullptr;
+    CoordinateView face_centroids_;
+    CoordinateView face_normals_;
+    const double* face_areas_ = nullptr;
+    CoordinateView node_coordinates_;
+
+    // Storage for arrays the grid does not store in this layout.
+    std::vector<int> int_storage_;
+    std::vector<double> double_storage_;
+};
+
+inline int dimensions(const GridArrays& grid) { return grid.dimensions(); }
+inline int numCells(const GridArrays& grid) { return grid.numCells(); }
+inline int numFaces(const GridArrays& grid) { return grid.numFaces(); }
+inline SparseTableView cell2Faces(const GridArrays& grid) { return grid.cellFaces(); }
+inline SparseTableView face2Vertices(const GridArrays& grid) { return grid.faceVertices(); }
+inline FaceCellsProxy faceCells(const GridArrays& grid) { return FaceCellsProxy(grid.faceCells()); }
+inline const double* cellCentroid(const GridArrays& grid, int cell) { return grid.cellCentroid(cell); }
+inline double cellVolume(const GridArrays& grid, int cell) { return grid.cellVolumes()[cell]; }
+inline const double* faceCentroid(const GridArrays& grid, int face) { return grid.faceCentroid(face); }
+/// \brief The area weighted normal, as for UnstructuredGrid.
+inline const double* faceNormal(const GridArrays& grid, int face) { return grid.faceNormal(face); }
+inline double faceArea(const GridArrays& grid, int face) { return grid.faceAreas()[face]; }
+inline const double* vertexCoordinates(const GridArrays& grid, int vertex)
+{ return grid.vertexCoordinates()[vertex]; }
+
+} // end namespace UgGridHelpers
+} // end namespace Opm
+
+#endif // OPM_GRIDARRAYS_HEADER_INCLUDED
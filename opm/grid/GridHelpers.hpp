@@ -55,6 +55,11 @@ public:
         : data_(data), offset_(offset), size_(size_arg)
     {}
 
+    /// \brief Creates a sparse table view of read-only arrays.
+    SparseTableView(const int* data, const unsigned *offset, std::size_t size_arg)
+        : data_(data), offset_(offset), size_(size_arg)
+    {}
+
     /// \brief Get a row of the the table.
     /// \param row The row index.
     /// \return The corresponding row.
@@ -320,6 +325,10 @@ public:
     explicit FaceCellsProxy(const UnstructuredGrid& grid)
     : face_cells_(grid.face_cells)
     {}
+    /// \brief Refer to an array with two cells per face, -1 on the boundary.
+    explicit FaceCellsProxy(const int* face_cells)
+    : face_cells_(face_cells)
+    {}
     int operator()(int face_index, int local_index) const
     {
         return face_cells_[2*face_index+local_index];
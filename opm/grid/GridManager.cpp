@@ -33,11 +33,224 @@
 
 #include <array>
 #include <algorithm>
+#include <cstdint>
+#include <list>
+#include <mutex>
 #include <numeric>
+#include <unordered_map>
+#include <utility>
 
 namespace Opm
 {
 
+namespace
+{
+
+    /// Approximate memory footprint of a grid.
+    std::size_t gridBytes(const UnstructuredGrid& g)
+    {
+        const std::size_t nd = g.dimensions;
+        const std::size_t nc = g.number_of_cells;
+        const std::size_t nf = g.number_of_faces;
+        const std::size_t nn = g.number_of_nodes;
+        const std::size_t nfn = g.face_nodepos[nf];
+        const std::size_t ncf = g.cell_facepos[nc];
+
+        std::size_t bytes = sizeof g;
+        bytes += (nf + 1 + nc + 1) * sizeof *g.face_nodepos;
+        bytes += (nfn + 2*nf + ncf) * sizeof(int);
+        bytes += (nd*nn + nd*nf*2 + nf + nd*nc + nc) * sizeof(double);
+        if (g.cell_facetag != nullptr) {
+            bytes += ncf * sizeof(int);
+        }
+        if (g.global_cell != nullptr) {
+            bytes += nc * sizeof(int);
+        }
+        if (g.zcorn != nullptr) {
+            bytes += std::size_t(8) * g.cartdims[0] * g.cartdims[1] * g.cartdims[2] * sizeof(double);
+        }
+        return bytes;
+    }
+
+    /// 64-bit FNV-1a hash over the bytes of the grid input.
+    class GridInputHash
+    {
+    public:
+        template <class T>
+        void add(const T* data, std::size_t n)
+        {
+            const auto* bytes = reinterpret_cast<const unsigned char*>(data);
+            for (std::size_t i = 0; i < n * sizeof(T); ++i) {
+                value_ = (value_ ^ bytes[i]) * 0x100000001b3ULL;
+            }
+        }
+
+        template <class T>
+        void add(const std::vector<T>& v)
+        {
+            add(v.size());
+            add(v.data(), v.size());
+        }
+
+        template <class T>
+        void add(const T& value)
+        {
+            add(&value, 1);
+        }
+
+        std::uint64_t value() const
+        {
+            return value_;
+        }
+
+    private:
+        std::uint64_t value_ = 0xcbf29ce484222325ULL;
+    };
+
+    /// The input a cached grid was processed from. The hash only selects
+    /// the candidate entry, a hit requires the whole input to be equal.
+    struct GridCacheInput
+    {
+        std::array<int, 3> dims = { 0, 0, 0 };
+        std::vector<double> coord;
+        std::vector<double> zcorn;
+        std::vector<int> actnum;
+        double z_tolerance = 0.0;
+        int minpv_mode = 0;
+        std::vector<double> pore_volumes;
+        std::vector<double> minpv;
+        double max_empty_gap = 0.0;
+
+        std::uint64_t hash() const
+        {
+            GridInputHash hash;
+            hash.add(dims.data(), dims.size());
+            hash.add(coord);
+            hash.add(zcorn);
+            hash.add(actnum);
+            hash.add(z_tolerance);
+            hash.add(minpv_mode);
+            hash.add(pore_volumes);
+            hash.add(minpv);
+            hash.add(max_empty_gap);
+            return hash.value();
+        }
+
+        std::size_t bytes() const
+        {
+            return sizeof(*this)
+                + (coord.size() + zcorn.size() + pore_volumes.size() + minpv.size()) * sizeof(double)
+                + actnum.size() * sizeof(int);
+        }
+
+        bool operator==(const GridCacheInput& other) const
+        {
+            return dims == other.dims
+                && z_tolerance == other.z_tolerance
+                && minpv_mode == other.minpv_mode
+                && max_empty_gap == other.max_empty_gap
+                && actnum == other.actnum
+                && coord == other.coord
+                && zcorn == other.zcorn
+                && pore_volumes == other.pore_volumes
+                && minpv == other.minpv;
+        }
+    };
+
+    /// Process-wide LRU cache of processed grids.
+    class GridCache
+    {
+    public:
+        static GridCache& instance()
+        {
+            static GridCache cache;
+            return cache;
+        }
+
+        bool enabled()
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return limit_ > 0;
+        }
+
+        std::shared_ptr<const UnstructuredGrid> find(std::uint64_t key, const GridCacheInput& input)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = index_.find(key);
+            if (it == index_.end() || !(*it->second->input == input)) {
+                return {};
+            }
+            // Move to the front of the LRU list.
+            lru_.splice(lru_.begin(), lru_, it->second);
+            return it->second->grid;
+        }
+
+        void insert(std::uint64_t key, std::shared_ptr<const GridCacheInput> input,
+                    const std::shared_ptr<const UnstructuredGrid>& grid)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (limit_ == 0) {
+                return;
+            }
+            auto it = index_.find(key);
+            if (it != index_.end()) {
+                if (*it->second->input == *input) {
+                    return;
+                }
+                // Hash collision, the newer grid replaces the older one.
+                bytes_ -= it->second->bytes;
+                lru_.erase(it->second);
+                index_.erase(it);
+            }
+            const std::size_t bytes = gridBytes(*grid) + input->bytes();
+            lru_.push_front({ key, std::move(input), grid, bytes });
+            index_[key] = lru_.begin();
+            bytes_ += bytes;
+            evict();
+        }
+
+        void setLimit(std::size_t max_bytes)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            limit_ = max_bytes;
+            evict();
+        }
+
+        void clear()
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            lru_.clear();
+            index_.clear();
+            bytes_ = 0;
+        }
+
+    private:
+        struct Entry
+        {
+            std::uint64_t key;
+            std::shared_ptr<const GridCacheInput> input;
+            std::shared_ptr<const UnstructuredGrid> grid;
+            std::size_t bytes;
+        };
+
+        void evict()
+        {
+            while (!lru_.empty() && bytes_ > limit_) {
+                bytes_ -= lru_.back().bytes;
+                index_.erase(lru_.back().key);
+                lru_.pop_back();
+            }
+        }
+
+        std::mutex mutex_;
+        std::list<Entry> lru_;
+        std::unordered_map<std::uint64_t, std::list<Entry>::iterator> index_;
+        std::size_t limit_ = 0;
+        std::size_t bytes_ = 0;
+    };
+
+} // anonymous namespace
+
 #if HAVE_ECL_INPUT
     /// Construct a 3d corner-point grid from a deck.
     GridManager::GridManager(const Opm::EclipseGrid& inputGrid)
@@ -104,7 +317,17 @@ namespace Opm
     /// and is therefore only suited for internal use.
     GridManager::GridManager(const std::string& input_filename)
     {
-        ug_ = read_grid(input_filename.c_str());
+        const char* fname = input_filename.c_str();
+        if (is_grid_binary_file(fname)) {
+            ug_ = map_grid_binary(fname);
+            mapped_ = (ug_ != nullptr);
+            if (!ug_) {
+                // Foreign byte order or no mmap() support.
+                ug_ = read_grid_binary(fname);
+            }
+        } else {
+            ug_ = read_grid(fname);
+        }
         if (!ug_) {
             OPM_THROW(std::runtime_error,
                       "Failed to read grid from file " + input_filename);
@@ -114,7 +337,11 @@ namespace Opm
     /// Destructor.
     GridManager::~GridManager()
     {
-        destroy_grid(ug_);
+        if (mapped_) {
+            unmap_grid_binary(ug_);
+        } else if (!shared_) {
+            destroy_grid(ug_);
+        }
     }
 
 
@@ -130,6 +357,20 @@ namespace Opm
 
 
 
+    void GridManager::setCacheLimit(std::size_t max_bytes)
+    {
+        GridCache::instance().setLimit(max_bytes);
+    }
+
+
+
+    void GridManager::clearCache()
+    {
+        GridCache::instance().clear();
+    }
+
+
+
 #if HAVE_ECL_INPUT
     // Construct corner-point grid from EclipseGrid.
     void GridManager::initFromEclipseGrid(const Opm::EclipseGrid& inputGrid,
@@ -150,8 +391,35 @@ namespace Opm
         g.actnum = actnum.data();
 
         const double z_tolerance = inputGrid.isPinchActive() ? inputGrid.getPinchThresholdThickness() : 0.0;
+        const bool apply_minpv = !poreVolumes.empty() && (inputGrid.getMinpvMode() != MinpvMode::Inactive);
+
+        auto& cache = GridCache::instance();
+        const bool use_cache = cache.enabled();
+        std::uint64_t key = 0;
+        std::shared_ptr<GridCacheInput> input;
+        if (use_cache) {
+            input = std::make_shared<GridCacheInput>();
+            std::copy(g.dims, g.dims + 3, input->dims.begin());
+            input->coord = coord;
+            input->zcorn = zcorn;
+            input->actnum = actnum;
+            input->z_tolerance = z_tolerance;
+            if (apply_minpv) {
+                input->minpv_mode = static_cast<int>(inputGrid.getMinpvMode());
+                input->pore_volumes = poreVolumes;
+                input->minpv = inputGrid.getMinpvVector();
+                input->max_empty_gap = inputGrid.getPinchMaxEmptyGap();
+            }
+            key = input->hash();
 
-        if (!poreVolumes.empty() && (inputGrid.getMinpvMode() != MinpvMode::Inactive)) {
+            shared_ = cache.find(key, *input);
+            if (shared_) {
+                ug_ = const_cast<UnstructuredGrid*>(shared_.get());
+                return;
+            }
+        }
+
+        if (apply_minpv) {
             MinpvProcessor mp(g.dims[0], g.dims[1], g.dims[2]);
             const std::vector<double>& minpvv  = inputGrid.getMinpvVector();
             const size_t cartGridSize = g.dims[0] * g.dims[1] * g.dims[2];
@@ -173,6 +441,10 @@ namespace Opm
 
         attach_zcorn_copy( ug_ , zcorn.data() );
 
+        if (use_cache) {
+            shared_.reset(ug_, &destroy_grid);
+            cache.insert(key, std::move(input), shared_);
+        }
     }
 
 #endif
@@ -20,6 +20,8 @@
 #ifndef OPM_GRIDMANAGER_HEADER_INCLUDED
 #define OPM_GRIDMANAGER_HEADER_INCLUDED
 
+#include <cstddef>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -74,6 +76,8 @@ class EclipseGrid;
         /// Construct a grid from an input file.
         /// The file format used is currently undocumented,
         /// and is therefore only suited for internal use.
+        /// Files written by write_grid_binary() are detected and
+        /// memory mapped rather than parsed.
         explicit GridManager(const std::string& input_filename);
 
         /// Destructor.
@@ -84,6 +88,27 @@ class EclipseGrid;
         /// to make it clear that we are returning a C-compatible struct.
         const UnstructuredGrid* c_grid() const;
 
+        /// Enable or disable the process-wide cache of grids constructed
+        /// from an EclipseGrid.
+        ///
+        /// When enabled, grids are looked up by a hash of COORD, ZCORN,
+        /// ACTNUM, the MINPV input and the processing options, and a
+        /// construction from input equal to one seen before shares the
+        /// already processed grid instead of building it again. The cache
+        /// keeps a copy of the input of each grid to compare on a hit, so
+        /// a hash collision never returns the wrong grid. Shared grids are
+        /// const and must not be modified through c_grid(). The cache
+        /// keeps the least recently used grids whose total size, input
+        /// included, is at most max_bytes; grids evicted from the cache
+        /// stay alive as long as a GridManager refers to them.
+        ///
+        /// \param[in] max_bytes  Memory limit of the cache. Zero, the
+        ///                       default, disables the cache and clears it.
+        static void setCacheLimit(std::size_t max_bytes);
+
+        /// Remove all grids from the process-wide cache.
+        static void clearCache();
+
     private:
         // Disable copying and assignment.
         GridManager(const GridManager& other) = delete;
@@ -97,6 +122,12 @@ class EclipseGrid;
 
         // The managed UnstructuredGrid.
         UnstructuredGrid* ug_;
+
+        // Whether ug_ was created by map_grid_binary().
+        bool mapped_ = false;
+
+        // Owner of ug_ if the grid is shared through the cache.
+        std::shared_ptr<const UnstructuredGrid> shared_;
     };
 
 } // namespace Opm
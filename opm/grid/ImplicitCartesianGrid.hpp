@@ -0,0 +1,368 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_IMPLICITCARTESIANGRID_HEADER_INCLUDED
+#define OPM_IMPLICITCARTESIANGRID_HEADER_INCLUDED
+
+#include <opm/common/ErrorMacros.hpp>
+#include <opm/grid/common/CartesianIndexMapper.hpp>
+
+#include <array>
+#include <cassert>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace Opm
+{
+
+    /// A uniform 3D Cartesian grid without stored topology or geometry.
+    ///
+    /// All connectivity and geometry is computed arithmetically from the
+    /// dimensions, cell size and origin, so the grid uses O(1) memory
+    /// regardless of the number of cells. Cells, faces and nodes are
+    /// numbered exactly as by create_grid_hexa3d():
+    ///   - cells and nodes in natural (i fastest) order,
+    ///   - first all faces with normal in x direction, then y, then z,
+    ///   - the six faces of a cell ordered I-, I+, J-, J+, K-, K+, which
+    ///     is also the face tag.
+    /// A grid stored this way can therefore be used interchangeably with
+    /// a materialised UnstructuredGrid in algorithms indexed by cell and
+    /// face numbers.
+    class ImplicitCartesianGrid
+    {
+    public:
+        static constexpr int dimension = 3;
+
+        /// Construct a grid of dims[0] x dims[1] x dims[2] cells of size
+        /// cellsz, with the lower corner of the first cell at origin.
+        /// \throw std::invalid_argument if a dimension is not positive, or
+        ///        if the cell-face pairs or vertices cannot be indexed by int.
+        ImplicitCartesianGrid(const std::array<int, 3>& dims,
+                              const std::array<double, 3>& cellsz,
+                              const std::array<double, 3>& origin = { 0.0, 0.0, 0.0 })
+            : dims_(dims), cellsz_(cellsz), origin_(origin)
+        {
+            const std::string dims_str = std::to_string(dims[0]) + "x" + std::to_string(dims[1])
+                + "x" + std::to_string(dims[2]);
+            if (dims[0] < 1 || dims[1] < 1 || dims[2] < 1) {
+                OPM_THROW(std::invalid_argument,
+                          "Grid dimensions must be positive, got " + dims_str);
+            }
+            // a * b * c <= limit, without computing the product.
+            auto fits = [](long long a, long long b, long long c, long long limit)
+            {
+                return a <= limit / b / c;
+            };
+            // The 6 * numCells() cell-face pairs bound the number of faces.
+            const long long max_index = std::numeric_limits<int>::max();
+            if (!fits(dims[0], dims[1], dims[2], max_index / 6)
+                || !fits(dims[0] + 1LL, dims[1] + 1LL, dims[2] + 1LL, max_index)) {
+                OPM_THROW(std::invalid_argument,
+                          "A " + dims_str + " grid has more cell faces or vertices"
+                          " than can be indexed by int");
+            }
+            nfaces_[0] = (dims_[0] + 1) * dims_[1] * dims_[2];
+            nfaces_[1] = dims_[0] * (dims_[1] + 1) * dims_[2];
+            nfaces_[2] = dims_[0] * dims_[1] * (dims_[2] + 1);
+        }
+
+        // ----------------------------------------------------------------
+        // Sizes
+        // ----------------------------------------------------------------
+
+        int numCells() const { return dims_[0] * dims_[1] * dims_[2]; }
+        int numFaces() const { return nfaces_[0] + nfaces_[1] + nfaces_[2]; }
+        int numVertices() const { return (dims_[0] + 1) * (dims_[1] + 1) * (dims_[2] + 1); }
+        /// Total number of cell-face pairs.
+        int numCellFaces() const { return 6 * numCells(); }
+        /// Number of faces of a cell, always six.
+        int numCellFaces(int /* cell */) const { return 6; }
+        /// Number of vertices of a face, always four.
+        int numFaceVertices(int /* face */) const { return 4; }
+
+        const std::array<int, 3>& logicalCartesianSize() const { return dims_; }
+        const std::array<double, 3>& cellSize() const { return cellsz_; }
+        const std::array<double, 3>& origin() const { return origin_; }
+
+        // ----------------------------------------------------------------
+        // Topology
+        // ----------------------------------------------------------------
+
+        /// Logical coordinates of a cell.
+        std::array<int, 3> cellIJK(int cell) const
+        {
+            return { cell % dims_[0], (cell / dims_[0]) % dims_[1], cell / (dims_[0] * dims_[1]) };
+        }
+
+        /// Cell index of logical coordinates.
+        int cellIndex(int i, int j, int k) const
+        {
+            return i + dims_[0] * (j + dims_[1] * k);
+        }
+
+        /// The local_index'th face of a cell, ordered I-, I+, J-, J+, K-, K+.
+        int cellFace(int cell, int local_index) const
+        {
+            const auto [i, j, k] = cellIJK(cell);
+            const int nx = dims_[0], ny = dims_[1];
+            switch (local_index) {
+            case 0: return i     + (nx + 1) * (j + ny * k);
+            case 1: return i + 1 + (nx + 1) * (j + ny * k);
+            case 2: return nfaces_[0] + i + nx * (j     + (ny + 1) * k);
+            case 3: return nfaces_[0] + i + nx * (j + 1 + (ny + 1) * k);
+            case 4: return nfaces_[0] + nfaces_[1] + i + nx * (j + ny * k);
+            default:
+                assert(local_index == 5);
+                return nfaces_[0] + nfaces_[1] + i + nx * (j + ny * (k + 1));
+            }
+        }
+
+        /// Face tag of the local_index'th face of a cell, i.e. local_index.
+        int faceTag(int /* cell */, int local_index) const
+        {
+            return local_index;
+        }
+
+        /// Normal direction (0, 1 or 2) of a face.
+        int faceDirection(int face) const
+        {
+            return face < nfaces_[0] ? 0 : (face < nfaces_[0] + nfaces_[1] ? 1 : 2);
+        }
+
+        /// Cell on side 0 (low coordinate) or 1 (high coordinate) of a
+        /// face, or -1 on the boundary.
+        int faceCell(int face, int side) const
+        {
+            const int dir = faceDirection(face);
+            auto ijk = faceIJK(face, dir);
+            if (side == 0) {
+                if (ijk[dir] == 0) {
+                    return -1;
+                }
+                --ijk[dir];
+            } else if (ijk[dir] == dims_[dir]) {
+                return -1;
+            }
+            return cellIndex(ijk[0], ijk[1], ijk[2]);
+        }
+
+        /// The local_index'th vertex of a face, ordered as in
+        /// create_grid_hexa3d().
+        int faceVertex(int face, int local_index) const
+        {
+            static constexpr int offsets[3][4][3] = {
+                { { 0, 0, 0 }, { 0, 1, 0 }, { 0, 1, 1 }, { 0, 0, 1 } },
+                { { 0, 0, 0 }, { 0, 0, 1 }, { 1, 0, 1 }, { 1, 0, 0 } },
+                { { 0, 0, 0 }, { 1, 0, 0 }, { 1, 1, 0 }, { 0, 1, 0 } },
+            };
+            const int dir = faceDirection(face);
+            const auto ijk = faceIJK(face, dir);
+            const int* o = offsets[dir][local_index];
+            return vertexIndex(ijk[0] + o[0], ijk[1] + o[1], ijk[2] + o[2]);
+        }
+
+        /// Vertex index of logical vertex coordinates.
+        int vertexIndex(int i, int j, int k) const
+        {
+            return i + (dims_[0] + 1) * (j + (dims_[1] + 1) * k);
+        }
+
+        // ----------------------------------------------------------------
+        // Geometry
+        // ----------------------------------------------------------------
+
+        std::array<double, 3> vertexPosition(int vertex) const
+        {
+            const int nx = dims_[0] + 1, ny = dims_[1] + 1;
+            return { origin_[0] + cellsz_[0] * (vertex % nx),
+                     origin_[1] + cellsz_[1] * ((vertex / nx) % ny),
+                     origin_[2] + cellsz_[2] * (vertex / (nx * ny)) };
+        }
+
+        std::array<double, 3> cellCentroid(int cell) const
+        {
+            const auto ijk = cellIJK(cell);
+            std::array<double, 3> x;
+            for (int d = 0; d < 3; ++d) {
+                x[d] = origin_[d] + cellsz_[d] * (ijk[d] + 0.5);
+            }
+            return x;
+        }
+
+        double cellVolume(int /* cell */) const
+        {
+            return cellsz_[0] * cellsz_[1] * cellsz_[2];
+        }
+
+        std::array<double, 3> faceCentroid(int face) const
+        {
+            const int dir = faceDirection(face);
+            const auto ijk = faceIJK(face, dir);
+            std::array<double, 3> x;
+            for (int d = 0; d < 3; ++d) {
+                x[d] = origin_[d] + cellsz_[d] * (ijk[d] + (d == dir ? 0.0 : 0.5));
+            }
+            return x;
+        }
+
+        double faceArea(int face) const
+        {
+            const int dir = faceDirection(face);
+            return cellsz_[(dir + 1) % 3] * cellsz_[(dir + 2) % 3];
+        }
+
+        /// Area weighted normal of a face, pointing from side 0 to side 1,
+        /// as the face_normals of an UnstructuredGrid.
+        std::array<double, 3> faceNormal(int face) const
+        {
+            const int dir = faceDirection(face);
+            std::array<double, 3> n = { 0.0, 0.0, 0.0 };
+            n[dir] = faceArea(face);
+            return n;
+        }
+
+        // ----------------------------------------------------------------
+        // Partitioning
+        // ----------------------------------------------------------------
+
+        /// Split the grid into num_parts logically Cartesian blocks,
+        /// choosing the block counts per direction that minimise the
+        /// total area of the block interfaces. Every block has at least
+        /// one cell in each direction.
+        /// \throw std::invalid_argument if num_parts is not positive or
+        ///        cannot be factored into block counts that fit the grid.
+        std::array<int, 3> partitionBlocks(int num_parts) const
+        {
+            if (num_parts < 1) {
+                OPM_THROW(std::invalid_argument,
+                          "Number of parts must be positive, got " + std::to_string(num_parts));
+            }
+            std::array<int, 3> best = { 0, 0, 0 };
+            double best_area = std::numeric_limits<double>::max();
+            for (int px = 1; px <= num_parts; ++px) {
+                if (num_parts % px != 0) {
+                    continue;
+                }
+                for (int py = 1; py <= num_parts / px; ++py) {
+                    if ((num_parts / px) % py != 0) {
+                        continue;
+                    }
+                    const int pz = num_parts / (px * py);
+                    const double area
+                        = (px - 1) * faceArea(0) * nfaces_[0] / (dims_[0] + 1)
+                        + (py - 1) * faceArea(nfaces_[0]) * nfaces_[1] / (dims_[1] + 1)
+                        + (pz - 1) * faceArea(nfaces_[0] + nfaces_[1]) * nfaces_[2] / (dims_[2] + 1);
+                    if (px <= dims_[0] && py <= dims_[1] && pz <= dims_[2] && area < best_area) {
+                        best = { px, py, pz };
+                        best_area = area;
+                    }
+                }
+            }
+            if (best[0] == 0) {
+                OPM_THROW(std::invalid_argument,
+                          "Cannot split a " + std::to_string(dims_[0]) + "x" + std::to_string(dims_[1])
+                          + "x" + std::to_string(dims_[2]) + " grid into " + std::to_string(num_parts)
+                          + " non-empty Cartesian blocks");
+            }
+            return best;
+        }
+
+        /// Part number of a cell for the block counts returned by
+        /// partitionBlocks(), numbering the blocks in natural order.
+        int cellPart(int cell, const std::array<int, 3>& blocks) const
+        {
+            const auto ijk = cellIJK(cell);
+            std::array<int, 3> b;
+            for (int d = 0; d < 3; ++d) {
+                // Block sizes differ by at most one cell.
+                b[d] = static_cast<int>((static_cast<long long>(ijk[d]) * blocks[d]) / dims_[d]);
+            }
+            return b[0] + blocks[0] * (b[1] + blocks[1] * b[2]);
+        }
+
+    private:
+        /// Logical coordinates of a face within the lattice of faces with
+        /// normal direction dir, which has one more entry in that direction.
+        std::array<int, 3> faceIJK(int face, int dir) const
+        {
+            std::array<int, 3> n = dims_;
+            n[dir] += 1;
+            for (int d = 0; d < dir; ++d) {
+                face -= nfaces_[d];
+            }
+            return { face % n[0], (face / n[0]) % n[1], face / (n[0] * n[1]) };
+        }
+
+        std::array<int, 3> dims_;
+        std::array<double, 3> cellsz_;
+        std::array<double, 3> origin_;
+        std::array<int, 3> nfaces_;
+    };
+
+} // namespace Opm
+
+namespace Dune
+{
+
+    /// The cells of an ImplicitCartesianGrid are all active and numbered
+    /// as in the logical Cartesian grid.
+    template<>
+    class CartesianIndexMapper<Opm::ImplicitCartesianGrid>
+    {
+    public:
+        static const int dimension = Opm::ImplicitCartesianGrid::dimension;
+
+        explicit CartesianIndexMapper(const Opm::ImplicitCartesianGrid& grid)
+            : grid_(grid)
+        {}
+
+        const std::array<int, dimension>& cartesianDimensions() const
+        {
+            return grid_.logicalCartesianSize();
+        }
+
+        int cartesianSize() const
+        {
+            return grid_.numCells();
+        }
+
+        int compressedSize() const
+        {
+            return grid_.numCells();
+        }
+
+        int cartesianIndex(const int compressedElementIndex) const
+        {
+            assert(compressedElementIndex >= 0 && compressedElementIndex < compressedSize());
+            return compressedElementIndex;
+        }
+
+        void cartesianCoordinate(const int compressedElementIndex, std::array<int, dimension>& coords) const
+        {
+            coords = grid_.cellIJK(compressedElementIndex);
+        }
+
+    private:
+        const Opm::ImplicitCartesianGrid& grid_;
+    };
+
+} // namespace Dune
+
+#endif // OPM_IMPLICITCARTESIANGRID_HEADER_INCLUDED
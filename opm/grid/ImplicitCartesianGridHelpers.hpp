@@ -0,0 +1,299 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_IMPLICITCARTESIANGRIDHELPERS_HEADER_INCLUDED
+#define OPM_IMPLICITCARTESIANGRIDHELPERS_HEADER_INCLUDED
+
+#include <opm/grid/GridHelpers.hpp>
+#include <opm/grid/ImplicitCartesianGrid.hpp>
+
+#include <opm/grid/utility/platform_dependent/disable_warnings.h>
+#include <dune/common/iteratorfacades.hh>
+#include <opm/grid/utility/platform_dependent/reenable_warnings.h>
+
+#include <array>
+
+namespace Opm
+{
+namespace ImplicitCartesian
+{
+
+/// \brief A row of a fixed-size mapping of an ImplicitCartesianGrid, e.g.
+///        the faces of a cell, computed on access.
+/// \tparam AccessMethod Method returning the local_index'th entry of a row.
+/// \tparam Size         Number of entries of each row.
+template<int (ImplicitCartesianGrid::*AccessMethod)(int,int)const, int Size>
+class LocalIndexRow
+{
+public:
+    class iterator
+        : public Dune::RandomAccessIteratorFacade<iterator, int, int, int>
+    {
+    public:
+        iterator(const ImplicitCartesianGrid* grid, int outer_index, int inner_index)
+            : grid_(grid), outer_index_(outer_index), index_(inner_index)
+        {}
+        int dereference() const
+        {
+            return (grid_->*AccessMethod)(outer_index_, index_);
+        }
+        int elementAt(int n) const
+        {
+            return (grid_->*AccessMethod)(outer_index_, index_ + n);
+        }
+        void increment()
+        {
+            ++index_;
+        }
+        void decrement()
+        {
+            --index_;
+        }
+        void advance(int n)
+        {
+            index_ += n;
+        }
+        int distanceTo(const iterator& o) const
+        {
+            return o.index_ - index_;
+        }
+        bool equals(const iterator& o) const
+        {
+            return index_ == o.index_;
+        }
+        /// \brief Position within the row.
+        int localIndex() const
+        {
+            return index_;
+        }
+    private:
+        const ImplicitCartesianGrid* grid_;
+        int outer_index_;
+        int index_;
+    };
+
+    typedef iterator const_iterator;
+
+    LocalIndexRow(const ImplicitCartesianGrid* grid, int outer_index)
+        : grid_(grid), outer_index_(outer_index)
+    {}
+    int operator[](int local_index) const
+    {
+        return (grid_->*AccessMethod)(outer_index_, local_index);
+    }
+    int size() const
+    {
+        return Size;
+    }
+    const_iterator begin() const
+    {
+        return const_iterator(grid_, outer_index_, 0);
+    }
+    const_iterator end() const
+    {
+        return const_iterator(grid_, outer_index_, Size);
+    }
+private:
+    const ImplicitCartesianGrid* grid_;
+    int outer_index_;
+};
+
+/// \brief A fixed-size mapping of an ImplicitCartesianGrid, used like the
+///        SparseTableView of an UnstructuredGrid.
+template<int (ImplicitCartesianGrid::*AccessMethod)(int,int)const, int Size>
+class LocalIndexTable
+{
+public:
+    typedef LocalIndexRow<AccessMethod, Size> row_type;
+
+    explicit LocalIndexTable(const ImplicitCartesianGrid* grid)
+        : grid_(grid)
+    {}
+    row_type operator[](int outer_index) const
+    {
+        return row_type(grid_, outer_index);
+    }
+    int operator()(int outer_index, int local_index) const
+    {
+        return (grid_->*AccessMethod)(outer_index, local_index);
+    }
+private:
+    const ImplicitCartesianGrid* grid_;
+};
+
+typedef LocalIndexTable<&ImplicitCartesianGrid::cellFace, 6> Cell2Faces;
+typedef LocalIndexTable<&ImplicitCartesianGrid::faceVertex, 4> Face2Vertices;
+
+/// \brief The face to cell mapping, with -1 for missing neighbours.
+class FaceCells
+{
+public:
+    explicit FaceCells(const ImplicitCartesianGrid* grid)
+        : grid_(grid)
+    {}
+    int operator()(int face_index, int local_index) const
+    {
+        return grid_->faceCell(face_index, local_index);
+    }
+private:
+    const ImplicitCartesianGrid* grid_;
+};
+
+} // namespace ImplicitCartesian
+
+namespace UgGridHelpers
+{
+
+inline int numCells(const ImplicitCartesianGrid& grid)
+{
+    return grid.numCells();
+}
+
+inline int numFaces(const ImplicitCartesianGrid& grid)
+{
+    return grid.numFaces();
+}
+
+inline int dimensions(const ImplicitCartesianGrid&)
+{
+    return ImplicitCartesianGrid::dimension;
+}
+
+inline int numCellFaces(const ImplicitCartesianGrid& grid)
+{
+    return grid.numCellFaces();
+}
+
+inline const int* cartDims(const ImplicitCartesianGrid& grid)
+{
+    return grid.logicalCartesianSize().data();
+}
+
+/// \brief All cells are active and numbered as in the Cartesian grid, which
+///        is represented by a null pointer as for an UnstructuredGrid.
+inline const int* globalCell(const ImplicitCartesianGrid&)
+{
+    return nullptr;
+}
+
+template<>
+struct CellCentroidTraits<ImplicitCartesianGrid>
+{
+    typedef std::array<double, 3> ValueType;
+};
+
+inline std::array<double, 3> cellCentroid(const ImplicitCartesianGrid& grid, int cell_index)
+{
+    return grid.cellCentroid(cell_index);
+}
+
+inline double cellCentroidCoordinate(const ImplicitCartesianGrid& grid, int cell_index,
+                                     int coordinate)
+{
+    return grid.cellCentroid(cell_index)[coordinate];
+}
+
+inline double cellCenterDepth(const ImplicitCartesianGrid& grid, int cell_index)
+{
+    return grid.cellCentroid(cell_index)[2];
+}
+
+inline double cellVolume(const ImplicitCartesianGrid& grid, int cell_index)
+{
+    return grid.cellVolume(cell_index);
+}
+
+template<>
+struct FaceCentroidTraits<ImplicitCartesianGrid>
+{
+    typedef std::array<double, 3> ValueType;
+};
+
+inline FaceCentroidTraits<ImplicitCartesianGrid>::ValueType
+faceCentroid(const ImplicitCartesianGrid& grid, int face_index)
+{
+    return grid.faceCentroid(face_index);
+}
+
+/// \brief The area weighted normal, as for an UnstructuredGrid.
+inline std::array<double, 3> faceNormal(const ImplicitCartesianGrid& grid, int face_index)
+{
+    return grid.faceNormal(face_index);
+}
+
+inline double faceArea(const ImplicitCartesianGrid& grid, int face_index)
+{
+    return grid.faceArea(face_index);
+}
+
+template<>
+struct Cell2FacesTraits<ImplicitCartesianGrid>
+{
+    typedef ImplicitCartesian::Cell2Faces Type;
+};
+
+template<>
+struct Face2VerticesTraits<ImplicitCartesianGrid>
+{
+    typedef ImplicitCartesian::Face2Vertices Type;
+};
+
+inline Cell2FacesTraits<ImplicitCartesianGrid>::Type
+cell2Faces(const ImplicitCartesianGrid& grid)
+{
+    return Cell2FacesTraits<ImplicitCartesianGrid>::Type(&grid);
+}
+
+inline Face2VerticesTraits<ImplicitCartesianGrid>::Type
+face2Vertices(const ImplicitCartesianGrid& grid)
+{
+    return Face2VerticesTraits<ImplicitCartesianGrid>::Type(&grid);
+}
+
+inline std::array<double, 3> vertexCoordinates(const ImplicitCartesianGrid& grid, int index)
+{
+    return grid.vertexPosition(index);
+}
+
+template<>
+struct FaceCellTraits<ImplicitCartesianGrid>
+{
+    typedef ImplicitCartesian::FaceCells Type;
+};
+
+inline FaceCellTraits<ImplicitCartesianGrid>::Type
+faceCells(const ImplicitCartesianGrid& grid)
+{
+    return FaceCellTraits<ImplicitCartesianGrid>::Type(&grid);
+}
+
+/// \brief Get Eclipse Cartesian tag of a face
+/// \param grid The grid that the face is part of.
+/// \param cell_face The face attached to a cell, obtained from cell2Faces.
+/// \return 0, 1, 2, 3, 4, 5 for I-, I+, J-, J+, K-, K+
+inline int faceTag(const ImplicitCartesianGrid& grid,
+                   const ImplicitCartesian::Cell2Faces::row_type::iterator& cell_face)
+{
+    return grid.faceTag(-1, cell_face.localIndex());
+}
+
+} // namespace UgGridHelpers
+} // namespace Opm
+
+#endif // OPM_IMPLICITCARTESIANGRIDHELPERS_HEADER_INCLUDED
@@ -39,9 +39,14 @@
 #include <opm/input/eclipse/EclipseState/Grid/FieldPropsManager.hpp>
 #include <opm/grid/cpgrid/Entity.hpp>
 
+#include <cassert>
+#include <cstdint>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace Dune
@@ -100,6 +105,40 @@ public:
                                                    const bool& needsTranslation,
                                                    std::function<void(IntType, int)> valueCheck = [](IntType, int){}) const;
 
+    /// \brief: Get several field properties of type double from field properties manager, in one pass.
+    ///
+    ///         Equivalent to calling assignFieldPropsDoubleOnLeaf() once per name, but the leaf-to-field-property
+    ///         index map (and, for PORV with LGRs, the child/parent volume ratios) is computed only once and
+    ///         shared among all properties. The gathering itself is threaded.
+    ///
+    /// \param [in] fieldPropsManager
+    /// \param [in] propStrings        Names of the field properties, e.g. {"PORO", "PERMX", "NTG"}.
+    /// \return                        One vector per name, in the same order as propStrings.
+    std::vector<std::vector<double>> bulkAssignFieldPropsDoubleOnLeaf(const FieldPropsManager& fieldPropsManager,
+                                                                      const std::vector<std::string>& propStrings) const;
+
+    /// \brief: Get several field properties of type int from field properties manager, in one pass.
+    ///
+    ///         Equivalent to calling assignFieldPropsIntOnLeaf() once per name. The valueCheck callback is
+    ///         invoked serially, for each property in turn, with the same arguments as in the single property case.
+    template<typename IntType>
+    std::vector<std::vector<IntType>> bulkAssignFieldPropsIntOnLeaf(const FieldPropsManager& fieldPropsManager,
+                                                                    const std::vector<std::string>& propStrings,
+                                                                    const bool& needsTranslation,
+                                                                    std::function<void(IntType, int)> valueCheck = [](IntType, int){}) const;
+
+    /// \brief: Return, for each element index in the leaf grid view, the index used for retrieving field properties.
+    ///
+    ///         The map is computed on first use and cached, under a lock such that concurrent calls are safe.
+    ///         For CpGrid, it is recomputed whenever CpGrid::generation() has changed, i.e. after any
+    ///         modification of the grid (adapt(), loadBalance(), ...). Other grids have no such counter and
+    ///         only the number of leaf elements is compared; call invalidateFieldPropIdxCache() after
+    ///         modifying them. Returned by value, as another thread may rebuild the cache.
+    std::vector<int> fieldPropIdxOnLeaf() const;
+
+    /// \brief: Discard the cached leaf-to-field-property index map and volume ratios.
+    void invalidateFieldPropIdxCache() const;
+
     /// \brief: Get property of type double from field properties manager by name, via element or its index.
     template<typename ElemOrIndex>
     double fieldPropDouble(const FieldPropsManager& fieldPropsManager,
@@ -153,9 +192,43 @@ public:
     auto getFieldPropIdx(const ElementType& elem) const;
 
 protected:
+    /// \brief: Leaf-to-field-property data, see fieldPropIdxOnLeaf(). Never modified once built.
+    struct FieldPropIdxData
+    {
+        std::vector<int> fieldPropIdx;
+        // Ratio leafCellVolume / parentCellVolume for each leaf element, 1.0 for elements without father.
+        // Only computed when the grid has LGRs, empty otherwise.
+        std::vector<double> volumeRatio;
+    };
+
+    /// \brief: The current FieldPropIdxData, replaced as a whole when the grid changes.
+    struct FieldPropIdxCache
+    {
+        FieldPropIdxCache() = default;
+        // Copies get their own mutex.
+        FieldPropIdxCache(const FieldPropIdxCache& other)
+        {
+            std::lock_guard<std::mutex> lock(other.mutex);
+            data = other.data;
+            key = other.key;
+        }
+
+        mutable std::mutex mutex;
+        std::shared_ptr<const FieldPropIdxData> data;
+        std::uint64_t key = 0;
+    };
+
+    /// \brief: Value that changes whenever the grid is modified, as far as it can be detected.
+    std::uint64_t gridModificationKey() const;
+
+    /// \brief: Return the cached data, after recomputing it if stale. Callers keep the returned
+    ///         snapshot alive while using it, so a concurrent rebuild does not affect them.
+    std::shared_ptr<const FieldPropIdxData> fieldPropIdxCache() const;
+
     const GridView& gridView_;
     Dune::MultipleCodimMultipleGeomTypeMapper<GridView> elemMapper_;
     bool isFieldPropInLgr_;
+    mutable FieldPropIdxCache fieldPropIdxCache_;
 }; // end LookUpData class
 
 /// LookUpCartesianData - To search field properties of leaf grid view elements via CartesianIndex (cartesianMapper)
@@ -291,56 +364,171 @@ template<typename Grid, typename GridView>
 std::vector<double> Opm::LookUpData<Grid,GridView>::assignFieldPropsDoubleOnLeaf(const FieldPropsManager& fieldPropsManager,
                                                                                  const std::string& propString) const
 {
-    std::vector<double> fieldPropOnLeaf;
-    unsigned int numElements = gridView_.size(0);
-    fieldPropOnLeaf.resize(numElements);
-    const auto& fieldProp = fieldPropsManager.get_double(propString);
-    if ( (propString == "PORV") && (gridView_.grid().maxLevel() > 0)) {
-        // PORV poreVolume. LGRs supported (so far) only for CpGrid.
-        // For CpGrid with LGRs, poreVolume of a cell on the leaf grid view which has a parent cell on level 0,
-        // is computed as  porv[parent] * leafCellVolume / parentCellVolume. In this way, the sum of the pore
-        // volume of a parent cell coincides with the sum of the pore volume of its children.
-        for (const auto& element : elements(gridView_)) {
-            const auto& elemIdx = this-> elemMapper_.index(element);
-            const auto& fieldPropIdx = this->getFieldPropIdx<Grid>(elemIdx); // gets parentIdx (or (lgr)levelIdx) for CpGrid with LGRs
-            if (element.hasFather()) {
-                const auto fatherVolume = element.father().geometry().volume();
-                const auto& elemVolume = element.geometry().volume();
-                fieldPropOnLeaf[elemIdx] = fieldProp[fieldPropIdx] * elemVolume / fatherVolume;
+    return std::move(this->bulkAssignFieldPropsDoubleOnLeaf(fieldPropsManager, {propString}).front());
+}
+
+template<typename Grid, typename GridView>
+template<typename IntType>
+std::vector<IntType> Opm::LookUpData<Grid,GridView>::assignFieldPropsIntOnLeaf(const FieldPropsManager& fieldPropsManager,
+                                                                               const std::string& propString,
+                                                                               const bool& needsTranslation,
+                                                                               std::function<void(IntType, int)> valueCheck) const
+{
+    return std::move(this->template bulkAssignFieldPropsIntOnLeaf<IntType>(fieldPropsManager, {propString},
+                                                                           needsTranslation, valueCheck).front());
+}
+
+template<typename Grid, typename GridView>
+std::vector<std::vector<double>>
+Opm::LookUpData<Grid,GridView>::bulkAssignFieldPropsDoubleOnLeaf(const FieldPropsManager& fieldPropsManager,
+                                                                 const std::vector<std::string>& propStrings) const
+{
+    const auto cache = this->fieldPropIdxCache();
+    const auto& fieldPropIdx = cache->fieldPropIdx;
+    const int numElements = fieldPropIdx.size();
+    const bool hasLgrs = !cache->volumeRatio.empty();
+
+    std::vector<std::vector<double>> fieldPropsOnLeaf(propStrings.size());
+    for (std::size_t prop = 0; prop < propStrings.size(); ++prop) {
+        // FieldPropsManager may (re)compute properties on access, hence fetching them serially.
+        const auto& fieldProp = fieldPropsManager.get_double(propStrings[prop]);
+        auto& fieldPropOnLeaf = fieldPropsOnLeaf[prop];
+        fieldPropOnLeaf.resize(numElements);
+        const int* idx = fieldPropIdx.data();
+        const double* in = fieldProp.data();
+        double* out = fieldPropOnLeaf.data();
+        if ( (propStrings[prop] == "PORV") && hasLgrs) {
+            // PORV poreVolume. LGRs supported (so far) only for CpGrid.
+            // For CpGrid with LGRs, poreVolume of a cell on the leaf grid view which has a parent cell on level 0,
+            // is computed as  porv[parent] * leafCellVolume / parentCellVolume. In this way, the sum of the pore
+            // volume of a parent cell coincides with the sum of the pore volume of its children.
+            const double* ratio = cache->volumeRatio.data();
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for (int elemIdx = 0; elemIdx < numElements; ++elemIdx) {
+                out[elemIdx] = in[idx[elemIdx]] * ratio[elemIdx];
             }
-            else {
-                fieldPropOnLeaf[elemIdx] = fieldProp[fieldPropIdx];
+        }
+        else {
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for (int elemIdx = 0; elemIdx < numElements; ++elemIdx) {
+                out[elemIdx] = in[idx[elemIdx]];
             }
         }
     }
-    else {
-        for (const auto& element : elements(gridView_)) {
-            const auto& elemIdx = this-> elemMapper_.index(element);
-            const auto& fieldPropIdx = this->getFieldPropIdx<Grid>(elemIdx); // gets parentIdx (or (lgr)levelIdx) for CpGrid with LGRs
-            fieldPropOnLeaf[elemIdx] = fieldProp[fieldPropIdx];
+    return fieldPropsOnLeaf;
+}
+
+template<typename Grid, typename GridView>
+template<typename IntType>
+std::vector<std::vector<IntType>>
+Opm::LookUpData<Grid,GridView>::bulkAssignFieldPropsIntOnLeaf(const FieldPropsManager& fieldPropsManager,
+                                                              const std::vector<std::string>& propStrings,
+                                                              const bool& needsTranslation,
+                                                              std::function<void(IntType, int)> valueCheck) const
+{
+    const auto cache = this->fieldPropIdxCache();
+    const auto& fieldPropIdx = cache->fieldPropIdx;
+    const int numElements = fieldPropIdx.size();
+
+    std::vector<std::vector<IntType>> fieldPropsOnLeaf(propStrings.size());
+    for (std::size_t prop = 0; prop < propStrings.size(); ++prop) {
+        const auto& fieldProp = fieldPropsManager.get_int(propStrings[prop]);
+        auto& fieldPropOnLeaf = fieldPropsOnLeaf[prop];
+        fieldPropOnLeaf.resize(numElements);
+        const int* idx = fieldPropIdx.data();
+        const int* in = fieldProp.data();
+        IntType* out = fieldPropOnLeaf.data();
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (int elemIdx = 0; elemIdx < numElements; ++elemIdx) {
+            out[elemIdx] = in[idx[elemIdx]] - needsTranslation;
+        }
+        // The callback is user supplied and not necessarily thread safe.
+        for (int elemIdx = 0; elemIdx < numElements; ++elemIdx) {
+            valueCheck(fieldProp[idx[elemIdx]], idx[elemIdx]);
         }
     }
-    return fieldPropOnLeaf;
+    return fieldPropsOnLeaf;
 }
 
 template<typename Grid, typename GridView>
-template<typename IntType>
-std::vector<IntType> Opm::LookUpData<Grid,GridView>::assignFieldPropsIntOnLeaf(const FieldPropsManager& fieldPropsManager,
-                                                                               const std::string& propString,
-                                                                               const bool& needsTranslation,
-                                                                               std::function<void(IntType, int)> valueCheck) const
+std::vector<int> Opm::LookUpData<Grid,GridView>::fieldPropIdxOnLeaf() const
 {
-    std::vector<IntType> fieldPropOnLeaf;
-    unsigned int numElements = gridView_.size(0);
-    fieldPropOnLeaf.resize(numElements);
-    const auto& fieldProp = fieldPropsManager.get_int(propString);
-    for (const auto& element : elements(gridView_)) {
-        const auto& elemIdx = this-> elemMapper_.index(element);
-        const auto& fieldPropIdx = this->getFieldPropIdx(elemIdx); // gets parentIdx (or (lgr)levelIdx) for CpGrid with LGRs
-        fieldPropOnLeaf[elemIdx] = fieldProp[fieldPropIdx] - needsTranslation;
-        valueCheck(fieldProp[fieldPropIdx], fieldPropIdx);
+    return this->fieldPropIdxCache()->fieldPropIdx;
+}
+
+template<typename Grid, typename GridView>
+void Opm::LookUpData<Grid,GridView>::invalidateFieldPropIdxCache() const
+{
+    std::lock_guard<std::mutex> lock(fieldPropIdxCache_.mutex);
+    fieldPropIdxCache_.data.reset();
+}
+
+template<typename Grid, typename GridView>
+std::uint64_t Opm::LookUpData<Grid,GridView>::gridModificationKey() const
+{
+    if constexpr (std::is_same_v<Grid, Dune::CpGrid>) {
+        return gridView_.grid().generation();
     }
-    return fieldPropOnLeaf;
+    else {
+        return gridView_.size(0);
+    }
+}
+
+template<typename Grid, typename GridView>
+std::shared_ptr<const typename Opm::LookUpData<Grid,GridView>::FieldPropIdxData>
+Opm::LookUpData<Grid,GridView>::fieldPropIdxCache() const
+{
+    auto& cache = fieldPropIdxCache_;
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    const std::uint64_t key = this->gridModificationKey();
+    if (cache.data && (cache.key == key)) {
+        return cache.data;
+    }
+    const int numElements = gridView_.size(0);
+    const int maxLevel = gridView_.grid().maxLevel();
+    auto data = std::make_shared<FieldPropIdxData>();
+    data->fieldPropIdx.resize(numElements);
+    if (maxLevel > 0) {
+        data->volumeRatio.resize(numElements);
+    }
+    if constexpr (std::is_same_v<Grid, Dune::CpGrid>) {
+        // Leaf elements of CpGrid can be created directly from their index, hence random access.
+        const auto& leafData = *(gridView_.grid().currentData().back());
+        int* fieldPropIdx = data->fieldPropIdx.data();
+        double* volumeRatio = data->volumeRatio.data();
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (int elemIdx = 0; elemIdx < numElements; ++elemIdx) {
+            const auto elem = Dune::cpgrid::Entity<0>(leafData, elemIdx, true);
+            fieldPropIdx[elemIdx] = this->getFieldPropIdx<Grid>(elem);
+            if (maxLevel > 0) {
+                volumeRatio[elemIdx] = elem.hasFather()
+                    ? elem.geometry().volume() / elem.father().geometry().volume()
+                    : 1.0;
+            }
+        }
+    }
+    else {
+        for (const auto& element : elements(gridView_)) {
+            const auto& elemIdx = this-> elemMapper_.index(element);
+            data->fieldPropIdx[elemIdx] = this->getFieldPropIdx<Grid>(elemIdx);
+            if (maxLevel > 0) {
+                data->volumeRatio[elemIdx] = element.hasFather()
+                    ? element.geometry().volume() / element.father().geometry().volume()
+                    : 1.0;
+            }
+        }
+    }
+    cache.data = std::move(data);
+    cache.key = key;
+    return cache.data;
 }
 
 template<typename Grid, typename GridView>
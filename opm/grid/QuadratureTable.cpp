@@ -0,0 +1,358 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+#include <opm/grid/QuadratureTable.hpp>
+
+#include <opm/grid/UnstructuredGrid.h>
+#include <opm/common/ErrorMacros.hpp>
+
+#include <cmath>
+#include <numeric>
+
+namespace {
+
+/// Calculates the determinant of a 3 x 3 matrix, represented as
+/// three three-dimensional arrays.
+inline double determinantOf(const double* a0,
+                            const double* a1,
+                            const double* a2)
+{
+    return
+        a0[0] * (a1[1] * a2[2] - a2[1] * a1[2]) -
+        a0[1] * (a1[0] * a2[2] - a2[0] * a1[2]) +
+        a0[2] * (a1[0] * a2[1] - a2[0] * a1[1]);
+}
+
+/// Computes the volume of a tetrahedron consisting of 4 vertices
+/// with 3-dimensional coordinates
+inline double tetVolume(const double* p0,
+                        const double* p1,
+                        const double* p2,
+                        const double* p3)
+{
+    const double a[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+    const double b[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+    const double c[3] = { p3[0] - p0[0], p3[1] - p0[1], p3[2] - p0[2] };
+    return std::fabs(determinantOf(a, b, c) / 6.0);
+}
+
+/// Calculates the area of a triangle consisting of 3 vertices
+/// with 2-dimensional coordinates
+inline double triangleArea2d(const double* p0,
+                             const double* p1,
+                             const double* p2)
+{
+    const double a[2] = { p1[0] - p0[0], p1[1] - p0[1] };
+    const double b[2] = { p2[0] - p0[0], p2[1] - p0[1] };
+    const double a_cross_b = a[0]*b[1] - a[1]*b[0];
+    return 0.5*std::fabs(a_cross_b);
+}
+
+/// Calculates the area of a triangle consisting of 3 vertices
+/// with 3-dimensional coordinates
+inline double triangleArea3d(const double* p0,
+                             const double* p1,
+                             const double* p2)
+{
+    const double a[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+    const double b[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+    const double cr[3] = { a[1]*b[2] - a[2]*b[1],
+                           a[2]*b[0] - a[0]*b[2],
+                           a[0]*b[1] - a[1]*b[0] };
+    return 0.5*std::sqrt(cr[0]*cr[0] + cr[1]*cr[1] + cr[2]*cr[2]);
+}
+
+/// Writes quadrature points into the tables, point after point.
+class PointWriter
+{
+public:
+    PointWriter(double* coord, double* weight, const int num_pts, const int dim, const int first)
+        : coord_(coord), weight_(weight), num_pts_(num_pts), dim_(dim), pos_(first)
+    {
+    }
+
+    /// Add a point with coordinates sum_i c_i p_i.
+    template <int N>
+    void add(const double (&c)[N], const double* const (&p)[N], const double weight)
+    {
+        for (int dd = 0; dd < dim_; ++dd) {
+            double x = 0.0;
+            for (int i = 0; i < N; ++i) {
+                x += c[i]*p[i][dd];
+            }
+            coord_[dd*num_pts_ + pos_] = x;
+        }
+        weight_[pos_] = weight;
+        ++pos_;
+    }
+
+private:
+    double* coord_;
+    double* weight_;
+    int num_pts_;
+    int dim_;
+    int pos_;
+};
+
+} // anonymous namespace
+
+
+namespace Opm
+{
+
+    /// Tables for all cells of the grid.
+    QuadratureTable QuadratureTable::cells(const UnstructuredGrid& grid, const int degree)
+    {
+        const int dim = grid.dimensions;
+        if (dim > 3) {
+            OPM_THROW(std::runtime_error, "QuadratureTable only implemented for up to 3 dimensions.");
+        }
+        if (degree > 2) {
+            OPM_THROW(std::runtime_error, "QuadratureTable exact for polynomial degrees > 2 not implemented.");
+        }
+        const int num_cells = grid.number_of_cells;
+        const bool midpoint = degree < 2 || dim == 1;
+
+        QuadratureTable table;
+        table.offset_.assign(num_cells + 1, 0);
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (int cell = 0; cell < num_cells; ++cell) {
+            int n = 1;
+            if (!midpoint && dim == 2) {
+                n = 3*(grid.cell_facepos[cell + 1] - grid.cell_facepos[cell]);
+            } else if (!midpoint) {
+                n = 0;
+                for (int hf = grid.cell_facepos[cell]; hf < grid.cell_facepos[cell + 1]; ++hf) {
+                    const int face = grid.cell_faces[hf];
+                    n += 4*(grid.face_nodepos[face + 1] - grid.face_nodepos[face]);
+                }
+            }
+            table.offset_[cell + 1] = n;
+        }
+        table.allocate(dim);
+
+        const double* nc = grid.node_coordinates;
+        const double a = 0.138196601125010515179541316563436;
+        const double b = 1.0 - 3.0*a;
+        const double tet_bary[4][4] = { { b, a, a, a }, { a, b, a, a }, { a, a, b, a }, { a, a, a, b } };
+        const int num_pts = table.numQuadPts();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int cell = 0; cell < num_cells; ++cell) {
+            PointWriter pts(table.coord_.data(), table.weight_.data(), num_pts, dim, table.offset_[cell]);
+            const double* cc = grid.cell_centroids + dim*cell;
+            if (midpoint) {
+                pts.add({ 1.0 }, { cc }, grid.cell_volumes[cell]);
+                continue;
+            }
+            for (int hf = grid.cell_facepos[cell]; hf < grid.cell_facepos[cell + 1]; ++hf) {
+                const int face = grid.cell_faces[hf];
+                const double* fc = grid.face_centroids + dim*face;
+                const int* fnodes = grid.face_nodes + grid.face_nodepos[face];
+                if (dim == 2) {
+                    // Face centroid and the midpoints between the cell
+                    // centroid and the face nodes.
+                    const double* n0c = nc + dim*fnodes[0];
+                    const double* n1c = nc + dim*fnodes[1];
+                    const double w = triangleArea2d(n0c, n1c, cc)/3.0;
+                    pts.add({ 1.0 }, { fc }, w);
+                    pts.add({ 0.5, 0.5 }, { n0c, cc }, w);
+                    pts.add({ 0.5, 0.5 }, { n1c, cc }, w);
+                    continue;
+                }
+                // The tetrahedra given by the cell centroid, the face
+                // centroid and each edge of the face.
+                const int nfn = grid.face_nodepos[face + 1] - grid.face_nodepos[face];
+                for (int i = 0; i < nfn; ++i) {
+                    const double* n0c = nc + dim*fnodes[i];
+                    const double* n1c = nc + dim*fnodes[(i + 1) % nfn];
+                    const double w = 0.25*tetVolume(cc, fc, n0c, n1c);
+                    for (const auto& bary : tet_bary) {
+                        pts.add(bary, { cc, fc, n0c, n1c }, w);
+                    }
+                }
+            }
+        }
+        return table;
+    }
+
+
+
+    /// Tables for all faces of the grid.
+    QuadratureTable QuadratureTable::faces(const UnstructuredGrid& grid, const int degree)
+    {
+        const int dim = grid.dimensions;
+        if (dim > 3) {
+            OPM_THROW(std::runtime_error, "QuadratureTable only implemented for up to 3 dimensions.");
+        }
+        if (degree > 2) {
+            OPM_THROW(std::runtime_error, "QuadratureTable exact for polynomial degrees > 2 not implemented.");
+        }
+        const int num_faces = grid.number_of_faces;
+        const bool midpoint = degree < 2 || dim < 2;
+
+        QuadratureTable table;
+        table.offset_.assign(num_faces + 1, 0);
+        for (int face = 0; face < num_faces; ++face) {
+            int n = 1;
+            if (!midpoint) {
+                n = (dim == 2) ? 3 : 2*(grid.face_nodepos[face + 1] - grid.face_nodepos[face]);
+            }
+            table.offset_[face + 1] = n;
+        }
+        table.allocate(dim);
+
+        const double* nc = grid.node_coordinates;
+        const int num_pts = table.numQuadPts();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int face = 0; face < num_faces; ++face) {
+            PointWriter pts(table.coord_.data(), table.weight_.data(), num_pts, dim, table.offset_[face]);
+            const double* fc = grid.face_centroids + dim*face;
+            const double area = grid.face_areas[face];
+            if (midpoint) {
+                pts.add({ 1.0 }, { fc }, area);
+                continue;
+            }
+            const int* fnodes = grid.face_nodes + grid.face_nodepos[face];
+            if (dim == 2) {
+                // Simpson's rule.
+                pts.add({ 1.0 }, { nc + dim*fnodes[0] }, area/6.0);
+                pts.add({ 1.0 }, { fc }, 4.0*area/6.0);
+                pts.add({ 1.0 }, { nc + dim*fnodes[1] }, area/6.0);
+                continue;
+            }
+            // Boundary edge midpoints, then the midpoints between the face
+            // centroid and each node. Triangle i is given by the face
+            // centroid and nodes i and i + 1.
+            const int nn = grid.face_nodepos[face + 1] - grid.face_nodepos[face];
+            const auto triangleArea = [&](const int i) {
+                return triangleArea3d(nc + dim*fnodes[(i + 1) % nn], nc + dim*fnodes[i], fc);
+            };
+            for (int i = 0; i < nn; ++i) {
+                pts.add({ 0.5, 0.5 }, { nc + dim*fnodes[i], nc + dim*fnodes[(i + 1) % nn] },
+                        triangleArea(i)/3.0);
+            }
+            for (int i = 0; i < nn; ++i) {
+                pts.add({ 0.5, 0.5 }, { nc + dim*fnodes[i], fc },
+                        (triangleArea((i + nn - 1) % nn) + triangleArea(i))/3.0);
+            }
+        }
+        return table;
+    }
+
+
+
+    int QuadratureTable::size() const
+    {
+        return offset_.size() - 1;
+    }
+
+
+
+    int QuadratureTable::dimensions() const
+    {
+        return dim_;
+    }
+
+
+
+    int QuadratureTable::numQuadPts() const
+    {
+        return offset_.back();
+    }
+
+
+
+    int QuadratureTable::numQuadPts(const int entity) const
+    {
+        return offset_[entity + 1] - offset_[entity];
+    }
+
+
+
+    int QuadratureTable::offset(const int entity) const
+    {
+        return offset_[entity];
+    }
+
+
+
+    const double* QuadratureTable::coordinates(const int dd) const
+    {
+        return coord_.data() + dd*numQuadPts();
+    }
+
+
+
+    const double* QuadratureTable::weights() const
+    {
+        return weight_.data();
+    }
+
+
+
+    iterator_range_pod<double> QuadratureTable::coordinates(const int entity, const int dd) const
+    {
+        const double* x = coordinates(dd);
+        return { x + offset_[entity], x + offset_[entity + 1] };
+    }
+
+
+
+    iterator_range_pod<double> QuadratureTable::weights(const int entity) const
+    {
+        return { weight_.data() + offset_[entity], weight_.data() + offset_[entity + 1] };
+    }
+
+
+
+    void QuadratureTable::integrate(const double* values, double* result) const
+    {
+        const int num = size();
+        const double* w = weight_.data();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int entity = 0; entity < num; ++entity) {
+            double sum = 0.0;
+            for (int q = offset_[entity]; q < offset_[entity + 1]; ++q) {
+                sum += w[q]*values[q];
+            }
+            result[entity] = sum;
+        }
+    }
+
+
+
+    /// Turn the point counts in offset_ into offsets and size the tables.
+    void QuadratureTable::allocate(const int dim)
+    {
+        dim_ = dim;
+        std::partial_sum(offset_.begin(), offset_.end(), offset_.begin());
+        coord_.resize(dim*numQuadPts());
+        weight_.resize(numQuadPts());
+    }
+
+} // namespace Opm
@@ -0,0 +1,109 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_QUADRATURETABLE_HEADER_INCLUDED
+#define OPM_QUADRATURETABLE_HEADER_INCLUDED
+
+#include <opm/grid/utility/IteratorRange.hpp>
+
+#include <vector>
+
+struct UnstructuredGrid;
+
+namespace Opm
+{
+
+    /// Precomputed quadrature points and weights for all cells or all
+    /// faces of a grid.
+    ///
+    /// The points and weights are those of CellQuadrature and
+    /// FaceQuadrature, in the same order, but computed once for the whole
+    /// grid (threaded with OpenMP) and stored in flat tables. The points
+    /// of entity e are [offset(e), offset(e + 1)) in the tables, and the
+    /// coordinates are stored by direction, so that a function can be
+    /// evaluated at all points with a simple loop:
+    ///
+    ///     const auto table = QuadratureTable::cells(grid, 2);
+    ///     std::vector<double> values(table.numQuadPts());
+    ///     const double* x = table.coordinates(0);
+    ///     const double* y = table.coordinates(1);
+    ///     for (int q = 0; q < table.numQuadPts(); ++q) {
+    ///         values[q] = f(x[q], y[q]);
+    ///     }
+    ///     std::vector<double> integrals(table.size());
+    ///     table.integrate(values.data(), integrals.data());
+    class QuadratureTable
+    {
+    public:
+        /// Tables for all cells of the grid. \see CellQuadrature
+        static QuadratureTable cells(const UnstructuredGrid& grid, const int degree);
+
+        /// Tables for all faces of the grid. \see FaceQuadrature
+        static QuadratureTable faces(const UnstructuredGrid& grid, const int degree);
+
+        /// Number of cells or faces.
+        int size() const;
+
+        /// Number of space dimensions.
+        int dimensions() const;
+
+        /// Total number of quadrature points.
+        int numQuadPts() const;
+
+        /// Number of quadrature points of a cell or face.
+        int numQuadPts(const int entity) const;
+
+        /// Position of the first quadrature point of a cell or face in the
+        /// tables. offset(size()) == numQuadPts().
+        int offset(const int entity) const;
+
+        /// Coordinate in direction dd of all quadrature points.
+        const double* coordinates(const int dd) const;
+
+        /// Weights of all quadrature points. The weights of each cell or
+        /// face sum to its volume or area.
+        const double* weights() const;
+
+        /// Coordinates in direction dd of the quadrature points of a cell
+        /// or face.
+        iterator_range_pod<double> coordinates(const int entity, const int dd) const;
+
+        /// Weights of the quadrature points of a cell or face.
+        iterator_range_pod<double> weights(const int entity) const;
+
+        /// Integrate over every cell or face.
+        /// \param[in]  values   Function values at all quadrature points.
+        ///                      Must be array of length numQuadPts().
+        /// \param[out] result   Integral over each cell or face.
+        ///                      Must be array of length size().
+        void integrate(const double* values, double* result) const;
+
+    private:
+        QuadratureTable() = default;
+        void allocate(const int dim);
+
+        int dim_ = 0;
+        std::vector<int> offset_;
+        std::vector<double> coord_; // dim_ arrays of length numQuadPts()
+        std::vector<double> weight_;
+    };
+
+} // namespace Opm
+
+#endif // OPM_QUADRATURETABLE_HEADER_INCLUDED
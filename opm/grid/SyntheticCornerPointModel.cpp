@@ -0,0 +1,360 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <config.h>
+#include <opm/grid/SyntheticCornerPointModel.hpp>
+
+#include <opm/common/ErrorMacros.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+
+namespace Opm
+{
+
+namespace
+{
+
+std::uint64_t splitmix64(std::uint64_t x)
+{
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+void checkParameters(const SyntheticCornerPointParameters& param)
+{
+    const auto& dims = param.dims;
+    if (dims[0] <= 0 || dims[1] <= 0 || dims[2] <= 0) {
+        OPM_THROW(std::invalid_argument, "Synthetic corner-point model needs positive dimensions.");
+    }
+    if (double(dims[0]) * dims[1] * dims[2] > std::numeric_limits<int>::max()) {
+        OPM_THROW(std::invalid_argument, "Synthetic corner-point model has too many cells for int indices.");
+    }
+    if (param.cellSize[0] <= 0.0 || param.cellSize[1] <= 0.0 || param.cellSize[2] <= 0.0) {
+        OPM_THROW(std::invalid_argument, "Synthetic corner-point model needs positive cell sizes.");
+    }
+    if (param.faultSpacing[0] < 0 || param.faultSpacing[1] < 0 || param.pinchOutInterval < 0) {
+        OPM_THROW(std::invalid_argument, "Fault spacing and pinch-out interval must not be negative.");
+    }
+    if (param.thinThickness < 0.0 || param.thinThickness > param.cellSize[2]) {
+        OPM_THROW(std::invalid_argument, "Thickness of thin cells must be between zero and the layer thickness.");
+    }
+    for (const double fraction : { param.thinFraction, param.inactiveFraction }) {
+        if (fraction < 0.0 || fraction > 1.0) {
+            OPM_THROW(std::invalid_argument, "Fractions of thin and inactive cells must be between zero and one.");
+        }
+    }
+    if (param.porosity < 0.0 || param.porosity > 1.0 || param.minPoreVolume < 0.0) {
+        OPM_THROW(std::invalid_argument, "Porosity must be between zero and one and MINPV must not be negative.");
+    }
+}
+
+/// Computes the arrays one row at a time, a row being one line of pillars
+/// for COORD, one line of corners for ZCORN and one line of cells for
+/// ACTNUM. Rows are independent, so they can be computed in any order.
+/// The parameters must have been checked with checkParameters().
+class Generator
+{
+public:
+    enum Salt : std::uint64_t { Thin = 1, Inactive = 2 };
+
+    explicit Generator(const SyntheticCornerPointParameters& param)
+        : param_(param)
+        , nx_(param.dims[0])
+        , ny_(param.dims[1])
+        , nz_(param.dims[2])
+        , seed_hash_(splitmix64(param.seed))
+        , interface_depth_(nz_ + 1, 0.0)
+    {
+        for (std::size_t k = 0; k < nz_; ++k) {
+            interface_depth_[k + 1] = interface_depth_[k] + (pinched(k) ? 0.0 : param.cellSize[2]);
+        }
+
+        // The top surface is linear, so its extremes are at the corners.
+        double base_min = std::numeric_limits<double>::max();
+        double base_max = std::numeric_limits<double>::lowest();
+        for (const std::size_t pi : { std::size_t(0), nx_ }) {
+            for (const std::size_t pj : { std::size_t(0), ny_ }) {
+                base_min = std::min(base_min, pillarBase(pi, pj));
+                base_max = std::max(base_max, pillarBase(pi, pj));
+            }
+        }
+        zmin_ = base_min + std::min(0.0, param.faultThrow);
+        zmax_ = base_max + std::max(0.0, param.faultThrow) + interface_depth_[nz_];
+        // Keep the pillars from degenerating if all layers are pinched out.
+        zmax_ = std::max(zmax_, zmin_ + param.cellSize[2]);
+    }
+
+    std::size_t numCoordRows() const { return ny_ + 1; }
+    std::size_t coordRowSize() const { return 6 * (nx_ + 1); }
+    std::size_t numZcornRows() const { return 4 * ny_ * nz_; }
+    std::size_t zcornRowSize() const { return 2 * nx_; }
+    std::size_t numActnumRows() const { return ny_ * nz_; }
+    std::size_t actnumRowSize() const { return nx_; }
+
+    void coordRow(std::size_t pj, double* out) const
+    {
+        for (std::size_t pi = 0; pi <= nx_; ++pi) {
+            const double x = pi * param_.cellSize[0];
+            const double y = pj * param_.cellSize[1];
+            for (const double z : { zmin_, zmax_ }) {
+                *out++ = x + param_.pillarSlope[0] * (z - param_.top);
+                *out++ = y + param_.pillarSlope[1] * (z - param_.top);
+                *out++ = z;
+            }
+        }
+    }
+
+    void zcornRow(std::size_t row, double* out) const
+    {
+        // ZCORN runs over layers, then top and bottom corners of the layer,
+        // then lines of cells and finally the front and back corners of a line.
+        const std::size_t k = row / (4 * ny_);
+        const bool bottom = row % (4 * ny_) >= 2 * ny_;
+        const std::size_t j = (row % (2 * ny_)) / 2;
+        const std::size_t dj = row % 2;
+        for (std::size_t i = 0; i < nx_; ++i) {
+            double depth = blockOffset(i, j);
+            if (bottom) {
+                depth += interface_depth_[k + 1];
+            } else if (thin(i, j, k)) {
+                depth += interface_depth_[k + 1] - param_.thinThickness;
+            } else {
+                depth += interface_depth_[k];
+            }
+            out[2 * i] = depth + pillarBase(i, j + dj);
+            out[2 * i + 1] = depth + pillarBase(i + 1, j + dj);
+        }
+    }
+
+    void actnumRow(std::size_t row, int* out) const
+    {
+        const std::size_t first_cell = row * nx_;
+        for (std::size_t i = 0; i < nx_; ++i) {
+            out[i] = uniform(first_cell + i, Inactive) >= param_.inactiveFraction;
+        }
+    }
+
+private:
+    double uniform(std::size_t cell, Salt salt) const
+    {
+        const std::uint64_t h = splitmix64(seed_hash_ ^ ((std::uint64_t(cell) << 2) | salt));
+        return (h >> 11) * 0x1.0p-53;
+    }
+
+    bool pinched(std::size_t k) const
+    {
+        const std::size_t interval = param_.pinchOutInterval;
+        return interval > 0 && (k + 1) % interval == 0;
+    }
+
+    bool thin(std::size_t i, std::size_t j, std::size_t k) const
+    {
+        return !pinched(k)
+            && param_.thinFraction > 0.0
+            && uniform(i + nx_ * (j + ny_ * k), Thin) < param_.thinFraction;
+    }
+
+    double pillarBase(std::size_t pi, std::size_t pj) const
+    {
+        return param_.top
+            + param_.dip[0] * (pi * param_.cellSize[0])
+            + param_.dip[1] * (pj * param_.cellSize[1]);
+    }
+
+    double blockOffset(std::size_t i, std::size_t j) const
+    {
+        const std::size_t bi = param_.faultSpacing[0] > 0 ? i / param_.faultSpacing[0] : 0;
+        const std::size_t bj = param_.faultSpacing[1] > 0 ? j / param_.faultSpacing[1] : 0;
+        return (bi + bj) % 2 == 1 ? param_.faultThrow : 0.0;
+    }
+
+    SyntheticCornerPointParameters param_;
+    std::size_t nx_;
+    std::size_t ny_;
+    std::size_t nz_;
+    std::uint64_t seed_hash_;
+    std::vector<double> interface_depth_;
+    double zmin_ = 0.0;
+    double zmax_ = 0.0;
+};
+
+template <class T, class Fill>
+void fillRows(std::vector<T>& values, std::size_t num_rows, std::size_t row_size, Fill fill)
+{
+    values.resize(num_rows * row_size);
+    T* data = values.data();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (std::int64_t row = 0; row < std::int64_t(num_rows); ++row) {
+        fill(row, data + row * row_size);
+    }
+}
+
+// Formatting dominates the time for writing, so use the shortest round-trip
+// representation from to_chars where the library has it.
+void appendValues(std::string& text, const double* values, std::size_t n, std::size_t per_line)
+{
+    char buffer[32];
+    for (std::size_t i = 0; i < n; ++i) {
+#if __cpp_lib_to_chars >= 201611L
+        const auto length = std::to_chars(buffer, buffer + sizeof(buffer), values[i]).ptr - buffer;
+#else
+        const int length = std::snprintf(buffer, sizeof(buffer), "%.17g", values[i]);
+#endif
+        text.append(buffer, length);
+        text.push_back((i + 1) % per_line == 0 || i + 1 == n ? '\n' : ' ');
+    }
+}
+
+// Run-length encoded as N*v, which Eclipse input accepts for repeated values.
+void appendRuns(std::string& text, const int* values, std::size_t n)
+{
+    std::size_t begin = 0;
+    int runs = 0;
+    while (begin < n) {
+        std::size_t end = begin + 1;
+        while (end < n && values[end] == values[begin]) {
+            ++end;
+        }
+        if (end - begin > 1) {
+            text += std::to_string(end - begin);
+            text.push_back('*');
+        }
+        text += std::to_string(values[begin]);
+        text.push_back(++runs % 16 == 0 || end == n ? '\n' : ' ');
+        begin = end;
+    }
+}
+
+/// Generate and format batches of rows in parallel, and write them in order.
+template <class T, class Fill, class Format>
+void writeRows(std::ostream& os, const std::string& keyword,
+               std::size_t num_rows, std::size_t row_size,
+               Fill fill, Format format)
+{
+    os << keyword << '\n';
+    const std::size_t batch_size = std::max<std::size_t>(1, (std::size_t(1) << 20) / row_size);
+    std::vector<std::string> texts(std::min(batch_size, num_rows));
+    for (std::size_t first = 0; first < num_rows; first += batch_size) {
+        const std::int64_t count = std::min(batch_size, num_rows - first);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            std::vector<T> values(row_size);
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+            for (std::int64_t b = 0; b < count; ++b) {
+                fill(first + b, values.data());
+                texts[b].clear();
+                format(texts[b], values.data(), row_size);
+            }
+        }
+        for (std::int64_t b = 0; b < count; ++b) {
+            os << texts[b];
+        }
+    }
+    os << "/\n\n";
+}
+
+} // anonymous namespace
+
+
+grdecl CornerPointArrays::asGrdecl() const
+{
+    grdecl g;
+    std::copy(dims.begin(), dims.end(), g.dims);
+    g.coord = coord.data();
+    g.zcorn = zcorn.data();
+    g.actnum = actnum.empty() ? nullptr : actnum.data();
+    return g;
+}
+
+
+CornerPointArrays generateCornerPointModel(const SyntheticCornerPointParameters& param)
+{
+    checkParameters(param);
+    const Generator gen(param);
+    CornerPointArrays arrays;
+    arrays.dims = param.dims;
+    fillRows(arrays.coord, gen.numCoordRows(), gen.coordRowSize(),
+             [&gen](std::size_t row, double* out) { gen.coordRow(row, out); });
+    fillRows(arrays.zcorn, gen.numZcornRows(), gen.zcornRowSize(),
+             [&gen](std::size_t row, double* out) { gen.zcornRow(row, out); });
+    fillRows(arrays.actnum, gen.numActnumRows(), gen.actnumRowSize(),
+             [&gen](std::size_t row, int* out) { gen.actnumRow(row, out); });
+    return arrays;
+}
+
+
+void writeCornerPointModel(const SyntheticCornerPointParameters& param, std::ostream& os)
+{
+    checkParameters(param);
+    const Generator gen(param);
+    const auto& p = param;
+
+    os << "-- Synthetic corner-point model\n"
+       << "--   dims " << p.dims[0] << ' ' << p.dims[1] << ' ' << p.dims[2]
+       << ", cell size " << p.cellSize[0] << ' ' << p.cellSize[1] << ' ' << p.cellSize[2]
+       << ", top " << p.top << '\n'
+       << "--   dip " << p.dip[0] << ' ' << p.dip[1]
+       << ", pillar slope " << p.pillarSlope[0] << ' ' << p.pillarSlope[1] << '\n'
+       << "--   fault spacing " << p.faultSpacing[0] << ' ' << p.faultSpacing[1]
+       << ", fault throw " << p.faultThrow
+       << ", pinch-out interval " << p.pinchOutInterval << '\n'
+       << "--   thin fraction " << p.thinFraction << ", thin thickness " << p.thinThickness
+       << ", inactive fraction " << p.inactiveFraction << ", seed " << p.seed << '\n'
+       << "--   porosity " << p.porosity << ", MINPV " << p.minPoreVolume << '\n'
+       << "-- Thin cells have a bulk volume of "
+       << p.cellSize[0] * p.cellSize[1] * p.thinThickness
+       << ", a larger MINPV/PORO removes them.\n\n";
+
+    os << "SPECGRID\n" << p.dims[0] << ' ' << p.dims[1] << ' ' << p.dims[2] << " 1 F /\n\n";
+
+    writeRows<double>(os, "COORD", gen.numCoordRows(), gen.coordRowSize(),
+                      [&gen](std::size_t row, double* out) { gen.coordRow(row, out); },
+                      [](std::string& text, const double* values, std::size_t n) { appendValues(text, values, n, 6); });
+    writeRows<double>(os, "ZCORN", gen.numZcornRows(), gen.zcornRowSize(),
+                      [&gen](std::size_t row, double* out) { gen.zcornRow(row, out); },
+                      [](std::string& text, const double* values, std::size_t n) { appendValues(text, values, n, 8); });
+    writeRows<int>(os, "ACTNUM", gen.numActnumRows(), gen.actnumRowSize(),
+                   [&gen](std::size_t row, int* out) { gen.actnumRow(row, out); },
+                   &appendRuns);
+    if (p.porosity > 0.0) {
+        os << "PORO\n"
+           << std::size_t(p.dims[0]) * p.dims[1] * p.dims[2] << '*' << p.porosity << "\n/\n\n";
+    }
+    if (p.minPoreVolume > 0.0) {
+        os << "MINPV\n" << p.minPoreVolume << " /\n\n";
+    }
+    if (!os) {
+        OPM_THROW(std::runtime_error, "Could not write synthetic corner-point model.");
+    }
+}
+
+} // namespace Opm
@@ -0,0 +1,110 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_SYNTHETICCORNERPOINTMODEL_HEADER_INCLUDED
+#define OPM_SYNTHETICCORNERPOINTMODEL_HEADER_INCLUDED
+
+#include <opm/grid/cpgpreprocess/preprocess.h>
+
+#include <array>
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+namespace Opm
+{
+
+    /// \brief Parameters of a synthetic corner-point model.
+    ///
+    /// The model is a stack of layers below a dipping top surface, cut into
+    /// fault blocks and laid out along straight, possibly sloping, pillars.
+    /// All random choices are made by hashing the seed with the Cartesian
+    /// cell index, so the result depends neither on the number of threads
+    /// nor on whether the model is generated in memory or streamed.
+    struct SyntheticCornerPointParameters
+    {
+        /// Number of cells in each direction.
+        std::array<int, 3> dims = { 10, 10, 10 };
+        /// Cell size in each direction, the last one being the layer thickness.
+        std::array<double, 3> cellSize = { 100.0, 100.0, 10.0 };
+        /// Depth of the top surface at the origin.
+        double top = 2000.0;
+        /// Increase of depth per unit length in x and y direction.
+        std::array<double, 2> dip = { 0.0, 0.0 };
+        /// Horizontal displacement of the pillars per unit depth in x and y direction.
+        std::array<double, 2> pillarSlope = { 0.0, 0.0 };
+        /// Number of cells between faults in i and j direction, zero for no faults.
+        std::array<int, 2> faultSpacing = { 0, 0 };
+        /// Vertical displacement across a fault. Fault blocks alternate between
+        /// being shifted down by this amount and not at all.
+        double faultThrow = 0.0;
+        /// Every pinchOutInterval-th layer has zero thickness, zero for none.
+        int pinchOutInterval = 0;
+        /// Fraction of cells that are made thinThickness thick, such that a
+        /// MINPV threshold removes them.
+        double thinFraction = 0.0;
+        /// Thickness of the thin cells.
+        double thinThickness = 0.01;
+        /// Fraction of cells with ACTNUM zero.
+        double inactiveFraction = 0.0;
+        /// Porosity of all cells written as PORO, zero for no PORO keyword.
+        double porosity = 0.0;
+        /// Pore volume threshold written as MINPV, zero for no MINPV keyword.
+        double minPoreVolume = 0.0;
+        /// Seed of the random choices.
+        std::uint64_t seed = 0;
+    };
+
+    /// \brief The COORD, ZCORN and ACTNUM arrays of a corner-point model.
+    struct CornerPointArrays
+    {
+        std::array<int, 3> dims = { 0, 0, 0 };
+        std::vector<double> coord;
+        std::vector<double> zcorn;
+        std::vector<int> actnum;
+
+        /// \brief Refer to the arrays as grdecl input.
+        ///
+        /// The arrays must outlive the returned object.
+        grdecl asGrdecl() const;
+    };
+
+    /// \brief Generate a synthetic corner-point model in memory.
+    ///
+    /// The arrays are filled in parallel with OpenMP. They take about 68 bytes per
+    /// cell, so use writeCornerPointModel() for the largest models.
+    /// \param[in] param   parameters of the model
+    /// \return the arrays in the usual Eclipse order
+    CornerPointArrays generateCornerPointModel(const SyntheticCornerPointParameters& param);
+
+    /// \brief Write a synthetic corner-point model as a grdecl file.
+    ///
+    /// Writes SPECGRID, COORD, ZCORN and ACTNUM, the latter run-length encoded,
+    /// preceded by comments listing the parameters, and PORO and MINPV if
+    /// requested. The values are the same as
+    /// those of generateCornerPointModel(), but are generated and formatted in
+    /// batches of rows with OpenMP, so the memory use does not grow with the
+    /// number of layers.
+    /// \param[in]  param   parameters of the model
+    /// \param[out] os      stream to write to
+    void writeCornerPointModel(const SyntheticCornerPointParameters& param, std::ostream& os);
+
+} // namespace Opm
+
+#endif // OPM_SYNTHETICCORNERPOINTMODEL_HEADER_INCLUDED
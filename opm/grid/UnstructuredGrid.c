@@ -17,14 +17,32 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+/* fseeko() with a 64-bit off_t, also on 32-bit POSIX systems. */
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+#if !defined(_FILE_OFFSET_BITS)
+#define _FILE_OFFSET_BITS 64
+#endif
+
 #include <opm/grid/UnstructuredGrid.h>
 
 #include <assert.h>
 #include <errno.h>
+#include <limits.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(__unix__) || defined(__APPLE__)
+#define GRID_BINARY_HAVE_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 
 void
 destroy_grid(struct UnstructuredGrid *g)
@@ -556,3 +574,556 @@ read_grid(const char *fname)
 
     return G;
 }
+
+
+/* ---------------------------------------------------------------------- */
+/* Binary grid format                                                      */
+/* ---------------------------------------------------------------------- */
+
+/*
+  Layout: a fixed size header followed by the grid arrays in the order of
+  enum grid_binary_field, each starting at a multiple of
+  GRID_BINARY_ALIGN bytes.  Integers are stored as 32-bit values in the
+  byte order of the writer, which is recorded in endian_tag.  Optional
+  arrays (cell_facetag, global_cell) are only present if the
+  corresponding flag is set.
+*/
+
+#define GRID_BINARY_MAGIC      "OPMUGRID"
+#define GRID_BINARY_VERSION    1u
+#define GRID_BINARY_ENDIAN_TAG 0x01020304u
+#define GRID_BINARY_ALIGN      64
+
+#define GRID_BINARY_HAS_TAG      1u
+#define GRID_BINARY_HAS_INDEXMAP 2u
+
+struct grid_binary_header {
+    char     magic[8];
+    uint32_t endian_tag;
+    uint32_t version;
+    uint32_t flags;
+    int32_t  dimensions;
+    int32_t  cartdims[3];
+    uint32_t reserved;
+    uint64_t ncells;
+    uint64_t nfaces;
+    uint64_t nnodes;
+    uint64_t nfacenodes;
+    uint64_t ncellfaces;
+};
+
+enum grid_binary_field {
+    GB_NODE_COORDINATES,
+    GB_FACE_NODEPOS,
+    GB_FACE_NODES,
+    GB_FACE_CELLS,
+    GB_FACE_AREAS,
+    GB_FACE_CENTROIDS,
+    GB_FACE_NORMALS,
+    GB_CELL_FACEPOS,
+    GB_CELL_FACES,
+    GB_CELL_FACETAG,
+    GB_GLOBAL_CELL,
+    GB_CELL_VOLUMES,
+    GB_CELL_CENTROIDS,
+    GB_NFIELDS
+};
+
+struct grid_binary_layout {
+    size_t elem_size[GB_NFIELDS];
+    size_t count    [GB_NFIELDS];
+    size_t offset   [GB_NFIELDS];
+    size_t total;
+};
+
+/* A grid whose arrays point into a mapped file.  The grid is the first
+   member such that the UnstructuredGrid pointer handed out can be
+   converted back in unmap_grid_binary(). */
+struct mapped_grid {
+    struct UnstructuredGrid G;
+    void                   *base;
+    size_t                  length;
+};
+
+
+static size_t
+grid_binary_align(size_t offset)
+{
+    return (offset + GRID_BINARY_ALIGN - 1) / GRID_BINARY_ALIGN * GRID_BINARY_ALIGN;
+}
+
+
+static void
+grid_binary_compute_layout(const struct grid_binary_header *h,
+                           struct grid_binary_layout       *L)
+{
+    size_t nd = (size_t) h->dimensions;
+    size_t i, offset;
+
+    L->elem_size[GB_NODE_COORDINATES] = sizeof(double);
+    L->count    [GB_NODE_COORDINATES] = nd * h->nnodes;
+
+    L->elem_size[GB_FACE_NODEPOS]     = sizeof(uint32_t);
+    L->count    [GB_FACE_NODEPOS]     = h->nfaces + 1;
+    L->elem_size[GB_FACE_NODES]       = sizeof(int32_t);
+    L->count    [GB_FACE_NODES]       = h->nfacenodes;
+    L->elem_size[GB_FACE_CELLS]       = sizeof(int32_t);
+    L->count    [GB_FACE_CELLS]       = 2 * h->nfaces;
+    L->elem_size[GB_FACE_AREAS]       = sizeof(double);
+    L->count    [GB_FACE_AREAS]       = h->nfaces;
+    L->elem_size[GB_FACE_CENTROIDS]   = sizeof(double);
+    L->count    [GB_FACE_CENTROIDS]   = nd * h->nfaces;
+    L->elem_size[GB_FACE_NORMALS]     = sizeof(double);
+    L->count    [GB_FACE_NORMALS]     = nd * h->nfaces;
+
+    L->elem_size[GB_CELL_FACEPOS]     = sizeof(uint32_t);
+    L->count    [GB_CELL_FACEPOS]     = h->ncells + 1;
+    L->elem_size[GB_CELL_FACES]       = sizeof(int32_t);
+    L->count    [GB_CELL_FACES]       = h->ncellfaces;
+    L->elem_size[GB_CELL_FACETAG]     = sizeof(int32_t);
+    L->count    [GB_CELL_FACETAG]     =
+        (h->flags & GRID_BINARY_HAS_TAG) ? h->ncellfaces : 0;
+    L->elem_size[GB_GLOBAL_CELL]      = sizeof(int32_t);
+    L->count    [GB_GLOBAL_CELL]      =
+        (h->flags & GRID_BINARY_HAS_INDEXMAP) ? h->ncells : 0;
+    L->elem_size[GB_CELL_VOLUMES]     = sizeof(double);
+    L->count    [GB_CELL_VOLUMES]     = h->ncells;
+    L->elem_size[GB_CELL_CENTROIDS]   = sizeof(double);
+    L->count    [GB_CELL_CENTROIDS]   = nd * h->ncells;
+
+    offset = sizeof *h;
+    for (i = 0; i < GB_NFIELDS; i++) {
+        offset       = grid_binary_align(offset);
+        L->offset[i] = offset;
+        offset      += L->elem_size[i] * L->count[i];
+    }
+    L->total = offset;
+}
+
+
+static void *
+grid_binary_get_field(const struct UnstructuredGrid *G, int field)
+{
+    switch (field) {
+    case GB_NODE_COORDINATES: return G->node_coordinates;
+    case GB_FACE_NODEPOS:     return G->face_nodepos;
+    case GB_FACE_NODES:       return G->face_nodes;
+    case GB_FACE_CELLS:       return G->face_cells;
+    case GB_FACE_AREAS:       return G->face_areas;
+    case GB_FACE_CENTROIDS:   return G->face_centroids;
+    case GB_FACE_NORMALS:     return G->face_normals;
+    case GB_CELL_FACEPOS:     return G->cell_facepos;
+    case GB_CELL_FACES:       return G->cell_faces;
+    case GB_CELL_FACETAG:     return G->cell_facetag;
+    case GB_GLOBAL_CELL:      return G->global_cell;
+    case GB_CELL_VOLUMES:     return G->cell_volumes;
+    case GB_CELL_CENTROIDS:   return G->cell_centroids;
+    default:                  return NULL;
+    }
+}
+
+
+static void
+grid_binary_set_field(struct UnstructuredGrid *G, int field, void *p)
+{
+    switch (field) {
+    case GB_NODE_COORDINATES: G->node_coordinates = p; break;
+    case GB_FACE_NODEPOS:     G->face_nodepos     = p; break;
+    case GB_FACE_NODES:       G->face_nodes       = p; break;
+    case GB_FACE_CELLS:       G->face_cells       = p; break;
+    case GB_FACE_AREAS:       G->face_areas       = p; break;
+    case GB_FACE_CENTROIDS:   G->face_centroids   = p; break;
+    case GB_FACE_NORMALS:     G->face_normals     = p; break;
+    case GB_CELL_FACEPOS:     G->cell_facepos     = p; break;
+    case GB_CELL_FACES:       G->cell_faces       = p; break;
+    case GB_CELL_FACETAG:     G->cell_facetag     = p; break;
+    case GB_GLOBAL_CELL:      G->global_cell      = p; break;
+    case GB_CELL_VOLUMES:     G->cell_volumes     = p; break;
+    case GB_CELL_CENTROIDS:   G->cell_centroids   = p; break;
+    default:                  break;
+    }
+}
+
+
+static void
+grid_binary_swap(void *data, size_t elem_size, size_t count)
+{
+    unsigned char *p = data;
+    size_t         i, j;
+
+    for (i = 0; i < count; i++, p += elem_size) {
+        for (j = 0; j < elem_size / 2; j++) {
+            unsigned char t        = p[j];
+            p[j]                   = p[elem_size - 1 - j];
+            p[elem_size - 1 - j]   = t;
+        }
+    }
+}
+
+
+/* Seek to an absolute file offset.  Returns 1 on success and 0 if the
+   seek fails or the offset is not representable, rather than seeking
+   to a truncated offset. */
+static int
+grid_binary_seek(FILE *fp, size_t offset)
+{
+#if defined(_WIN32)
+    if ((uint64_t) offset > (uint64_t) INT64_MAX) {
+        return 0;
+    }
+    return _fseeki64(fp, (__int64) offset, SEEK_SET) == 0;
+#elif defined(__unix__) || defined(__APPLE__)
+    const off_t off = (off_t) offset;
+
+    if ((off < 0) || ((size_t) off != offset)) {
+        return 0;
+    }
+    return fseeko(fp, off, SEEK_SET) == 0;
+#else
+    if (offset > (size_t) LONG_MAX) {
+        return 0;
+    }
+    return fseek(fp, (long) offset, SEEK_SET) == 0;
+#endif
+}
+
+
+/* Validate a header read from file.  Returns 1 if the header is
+   usable, and sets *swap if the file has foreign byte order. */
+static int
+grid_binary_check_header(struct grid_binary_header *h, int *swap)
+{
+    if (memcmp(h->magic, GRID_BINARY_MAGIC, sizeof h->magic) != 0) {
+        return 0;
+    }
+
+    *swap = h->endian_tag != GRID_BINARY_ENDIAN_TAG;
+    if (*swap) {
+        grid_binary_swap(&h->endian_tag, sizeof h->endian_tag, 1);
+        if (h->endian_tag != GRID_BINARY_ENDIAN_TAG) {
+            return 0;
+        }
+        grid_binary_swap(&h->version   , sizeof h->version   , 1);
+        grid_binary_swap(&h->flags     , sizeof h->flags     , 1);
+        grid_binary_swap(&h->dimensions, sizeof h->dimensions, 1);
+        grid_binary_swap( h->cartdims  , sizeof h->cartdims[0], 3);
+        grid_binary_swap(&h->ncells    , sizeof h->ncells    , 5);
+    }
+
+    /* All counts must fit the int members and indices of the grid. */
+    return (h->version == GRID_BINARY_VERSION) &&
+        (h->dimensions >= 1) && (h->dimensions <= 3) &&
+        (h->ncells     <= (uint64_t) INT_MAX) &&
+        (h->nfaces     <= (uint64_t) INT_MAX) &&
+        (h->nnodes     <= (uint64_t) INT_MAX) &&
+        (h->nfacenodes <= (uint64_t) INT_MAX) &&
+        (h->ncellfaces <= (uint64_t) INT_MAX);
+}
+
+
+/* Validate the connectivity arrays of a grid read from file: the
+   position arrays must be monotone, start at zero and end at the
+   totals recorded in the header, and every index must refer to an
+   existing entity.  Returns 1 if the topology is consistent. */
+static int
+grid_binary_check_topology(const struct grid_binary_header *h,
+                           const struct UnstructuredGrid   *G)
+{
+    const int nc = G->number_of_cells;
+    const int nf = G->number_of_faces;
+    const int nn = G->number_of_nodes;
+    size_t    i;
+    int       f, c;
+
+    if ((G->face_nodepos[0] != 0) ||
+        (G->face_nodepos[nf] != (grid_size_t) h->nfacenodes)) {
+        return 0;
+    }
+    for (f = 0; f < nf; f++) {
+        if (G->face_nodepos[f + 1] < G->face_nodepos[f]) {
+            return 0;
+        }
+    }
+
+    if ((G->cell_facepos[0] != 0) ||
+        (G->cell_facepos[nc] != (grid_size_t) h->ncellfaces)) {
+        return 0;
+    }
+    for (c = 0; c < nc; c++) {
+        if (G->cell_facepos[c + 1] < G->cell_facepos[c]) {
+            return 0;
+        }
+    }
+
+    for (i = 0; i < h->nfacenodes; i++) {
+        if ((G->face_nodes[i] < 0) || (G->face_nodes[i] >= nn)) {
+            return 0;
+        }
+    }
+    for (i = 0; i < 2 * (size_t) nf; i++) {
+        if ((G->face_cells[i] < -1) || (G->face_cells[i] >= nc)) {
+            return 0;
+        }
+    }
+    for (i = 0; i < h->ncellfaces; i++) {
+        if ((G->cell_faces[i] < 0) || (G->cell_faces[i] >= nf)) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+
+static void
+grid_binary_fill_scalars(const struct grid_binary_header *h,
+                         struct UnstructuredGrid         *G)
+{
+    G->dimensions      = h->dimensions;
+    G->number_of_cells = (int) h->ncells;
+    G->number_of_faces = (int) h->nfaces;
+    G->number_of_nodes = (int) h->nnodes;
+    G->cartdims[0]     = h->cartdims[0];
+    G->cartdims[1]     = h->cartdims[1];
+    G->cartdims[2]     = h->cartdims[2];
+}
+
+
+int
+is_grid_binary_file(const char *fname)
+{
+    FILE *fp;
+    char  magic[8];
+    int   ok = 0;
+
+    fp = fopen(fname, "rb");
+    if (fp != NULL) {
+        ok = (fread(magic, 1, sizeof magic, fp) == sizeof magic) &&
+            (memcmp(magic, GRID_BINARY_MAGIC, sizeof magic) == 0);
+        fclose(fp);
+    }
+
+    return ok;
+}
+
+
+int
+write_grid_binary(const struct UnstructuredGrid *G, const char *fname)
+{
+    struct grid_binary_header h;
+    struct grid_binary_layout L;
+    static const char         zeros[GRID_BINARY_ALIGN] = { 0 };
+
+    FILE  *fp;
+    size_t pos, i;
+    int    ok;
+
+    if ((sizeof(int) != sizeof(int32_t)) || (sizeof(G->face_nodepos[0]) != sizeof(uint32_t))) {
+        return 0;
+    }
+
+    memset(&h, 0, sizeof h);
+    memcpy(h.magic, GRID_BINARY_MAGIC, sizeof h.magic);
+    h.endian_tag  = GRID_BINARY_ENDIAN_TAG;
+    h.version     = GRID_BINARY_VERSION;
+    h.flags       = ((G->cell_facetag != NULL) ? GRID_BINARY_HAS_TAG      : 0u) |
+                    ((G->global_cell  != NULL) ? GRID_BINARY_HAS_INDEXMAP : 0u);
+    h.dimensions  = G->dimensions;
+    h.cartdims[0] = G->cartdims[0];
+    h.cartdims[1] = G->cartdims[1];
+    h.cartdims[2] = G->cartdims[2];
+    h.ncells      = G->number_of_cells;
+    h.nfaces      = G->number_of_faces;
+    h.nnodes      = G->number_of_nodes;
+    h.nfacenodes  = G->face_nodepos[G->number_of_faces];
+    h.ncellfaces  = G->cell_facepos[G->number_of_cells];
+
+    grid_binary_compute_layout(&h, &L);
+
+    fp = fopen(fname, "wb");
+    if (fp == NULL) {
+        return 0;
+    }
+
+    ok  = fwrite(&h, sizeof h, 1, fp) == 1;
+    pos = sizeof h;
+
+    for (i = 0; ok && (i < GB_NFIELDS); i++) {
+        const void *data = grid_binary_get_field(G, (int) i);
+
+        ok = (L.offset[i] - pos) <= sizeof zeros;
+        if (ok) {
+            ok = fwrite(zeros, 1, L.offset[i] - pos, fp) == L.offset[i] - pos;
+        }
+        pos = L.offset[i];
+
+        if (ok && (L.count[i] > 0)) {
+            ok = (data != NULL) &&
+                (fwrite(data, L.elem_size[i], L.count[i], fp) == L.count[i]);
+            pos += L.elem_size[i] * L.count[i];
+        }
+    }
+
+    ok = (fclose(fp) == 0) && ok;
+
+    return ok;
+}
+
+
+struct UnstructuredGrid *
+read_grid_binary(const char *fname)
+{
+    struct grid_binary_header h;
+    struct grid_binary_layout L;
+    struct UnstructuredGrid  *G = NULL;
+
+    FILE  *fp;
+    size_t i;
+    int    swap, ok;
+
+    fp = fopen(fname, "rb");
+    if (fp == NULL) {
+        return NULL;
+    }
+
+    ok = (fread(&h, sizeof h, 1, fp) == 1) && grid_binary_check_header(&h, &swap);
+
+    if (ok) {
+        G = allocate_grid(h.dimensions, h.ncells, h.nfaces,
+                          h.nfacenodes, h.ncellfaces, h.nnodes);
+        ok = G != NULL;
+    }
+
+    if (ok) {
+        if (! (h.flags & GRID_BINARY_HAS_TAG)) {
+            free(G->cell_facetag);
+            G->cell_facetag = NULL;
+        }
+        if (h.flags & GRID_BINARY_HAS_INDEXMAP) {
+            G->global_cell = malloc(h.ncells * sizeof *G->global_cell);
+        }
+        grid_binary_fill_scalars(&h, G);
+        grid_binary_compute_layout(&h, &L);
+    }
+
+    for (i = 0; ok && (i < GB_NFIELDS); i++) {
+        void *data = grid_binary_get_field(G, (int) i);
+
+        if (L.count[i] == 0) {
+            continue;
+        }
+
+        ok = (data != NULL) &&
+            grid_binary_seek(fp, L.offset[i]) &&
+            (fread(data, L.elem_size[i], L.count[i], fp) == L.count[i]);
+
+        if (ok && swap) {
+            grid_binary_swap(data, L.elem_size[i], L.count[i]);
+        }
+    }
+
+    fclose(fp);
+
+    ok = ok && grid_binary_check_topology(&h, G);
+
+    if (! ok) {
+        destroy_grid(G);
+        G = NULL;
+    }
+
+    return G;
+}
+
+
+struct UnstructuredGrid *
+map_grid_binary(const char *fname)
+{
+#if GRID_BINARY_HAVE_MMAP
+    struct grid_binary_header  h;
+    struct grid_binary_layout  L;
+    struct mapped_grid        *mg;
+    struct stat                st;
+
+    void  *base;
+    size_t i;
+    int    fd, swap, ok;
+
+    fd = open(fname, O_RDONLY);
+    if (fd < 0) {
+        return NULL;
+    }
+
+    ok = (fstat(fd, &st) == 0) && ((size_t) st.st_size >= sizeof h);
+
+    base = MAP_FAILED;
+    if (ok) {
+        /* Private, writable mapping: modifications of the grid (e.g.,
+           by grid initialisation code) never reach the file. */
+        base = mmap(NULL, (size_t) st.st_size, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE, fd, 0);
+        ok = base != MAP_FAILED;
+    }
+    close(fd);
+
+    if (ok) {
+        memcpy(&h, base, sizeof h);
+        /* Arrays can only be used in place in native byte order. */
+        ok = grid_binary_check_header(&h, &swap) && !swap &&
+            (sizeof(int) == sizeof(int32_t));
+    }
+
+    if (ok) {
+        grid_binary_compute_layout(&h, &L);
+        ok = L.total <= (size_t) st.st_size;
+    }
+
+    mg = NULL;
+    if (ok) {
+        mg = calloc(1, sizeof *mg);
+        ok = mg != NULL;
+    }
+
+    if (! ok) {
+        if (base != MAP_FAILED) {
+            munmap(base, (size_t) st.st_size);
+        }
+        return NULL;
+    }
+
+    mg->base   = base;
+    mg->length = (size_t) st.st_size;
+    grid_binary_fill_scalars(&h, &mg->G);
+
+    for (i = 0; i < GB_NFIELDS; i++) {
+        grid_binary_set_field(&mg->G, (int) i,
+                              (L.count[i] > 0)
+                              ? (void *) ((char *) base + L.offset[i])
+                              : NULL);
+    }
+
+    if (! grid_binary_check_topology(&h, &mg->G)) {
+        munmap(base, mg->length);
+        free(mg);
+        return NULL;
+    }
+
+    return &mg->G;
+#else
+    (void) fname;
+    return NULL;
+#endif
+}
+
+
+void
+unmap_grid_binary(struct UnstructuredGrid *g)
+{
+    if (g != NULL) {
+        struct mapped_grid *mg = (struct mapped_grid *) g;
+
+#if GRID_BINARY_HAVE_MMAP
+        munmap(mg->base, mg->length);
+#endif
+        free(mg);
+    }
+}
@@ -322,6 +322,75 @@ struct UnstructuredGrid *
 read_grid(const char *fname);
 
 
+/**
+ * Export a grid to the binary grid file format.
+ *
+ * The format consists of a versioned header, tagged with the byte order
+ * of the writer, followed by the raw grid arrays aligned on 64 byte
+ * boundaries.  The optional arrays <code>cell_facetag</code> and
+ * <code>global_cell</code> are stored if present.
+ *
+ * @param[in] G     Grid.
+ * @param[in] fname File name.
+ * @return True (integer one) if successful and false (integer zero) if
+ * the file could not be written.
+ */
+int
+write_grid_binary(const struct UnstructuredGrid *G, const char *fname);
+
+
+/**
+ * Import a grid from a file written by write_grid_binary().
+ *
+ * Files written on a machine with different byte order are converted
+ * while reading.
+ *
+ * @param[in] fname File name.
+ * @return Fully formed UnstructuredGrid to be released with
+ * destroy_grid().  Returns @c NULL if the file could not be read or is
+ * not a valid binary grid file.
+ */
+struct UnstructuredGrid *
+read_grid_binary(const char *fname);
+
+
+/**
+ * Map a file written by write_grid_binary() into memory.
+ *
+ * The grid arrays point directly into a private mapping of the file, so
+ * no data is copied until it is accessed.  Modifying the arrays does not
+ * change the file.  Only files in native byte order can be mapped.
+ *
+ * @param[in] fname File name.
+ * @return Grid to be released with unmap_grid_binary(), never with
+ * destroy_grid().  Returns @c NULL if the file cannot be mapped, e.g. on
+ * platforms without memory mapped files, in which case
+ * read_grid_binary() can be used instead.
+ */
+struct UnstructuredGrid *
+map_grid_binary(const char *fname);
+
+
+/**
+ * Release a grid created by map_grid_binary().
+ *
+ * @param[in,out] g Grid.  May be @c NULL.
+ */
+void
+unmap_grid_binary(struct UnstructuredGrid *g);
+
+
+/**
+ * Determine whether a file starts with the magic bytes of the binary
+ * grid file format.
+ *
+ * @param[in] fname File name.
+ * @return True (integer one) if the file is a binary grid file.
+ */
+int
+is_grid_binary_file(const char *fname);
+
+
 /**
  * Determine whether or not two grid structures represent the same
  * underlying geometry and topology.
@@ -132,6 +132,212 @@ void setMetisOptions(const std::map<std::string, std::string>& optionsMap, int&
 #endif
 
 
+namespace
+{
+
+/// Partition a graph in CSR format into nparts parts with METIS on the
+/// calling process.
+///
+/// METIS_PartGraphRecursive is used if requested by the METIS_OPTION_PTYPE
+/// parameter or, if no method is requested, when nparts is a small power
+/// of two. Otherwise METIS_PartGraphKway is used.
+/// \param adjwgt The edge weights, or null for uniform weights.
+/// \return The METIS return code.
+int callMetis(idx_t n,
+              idx_t* xadj,
+              idx_t* adjncy,
+              idx_t* adjwgt,
+              idx_t nparts,
+              real_t imbalanceTol,
+              [[maybe_unused]] const std::map<std::string,std::string>& params,
+              std::vector<int>& partitionVector)
+{
+    int rc = METIS_OK;
+
+    // This is a vector of size n that upon successful completion stores the partition vector of the graph.
+    // The numbering of this vector starts from either 0 or 1, depending on the value of options[METIS_OPTION_NUMBERING].
+    std::vector<idx_t> gpart(n);
+
+    // Upon successful completion, this variable stores the edge-cut or the total communication volume of
+    // the partitioning solution. The value returned depends on the partitioning’s objective function.
+    idx_t objval = 0;
+
+    //The number of balancing constraints, should be at least 1.
+    idx_t ncon = 1;
+
+    int manuallySelectedMethod = 0; // 0: choose according to number of partitions, 1: recursive, 2: kway
+#if IS_SCOTCH_METIS_HEADER
+    Opm::OpmLog::info("Not setting specific METIS Options since you're using Scotch-METIS.");
+    idx_t* options = nullptr;
+    if (imbalanceTol >= 1.0) {
+        imbalanceTol -= 1.0;
+        Opm::OpmLog::info("Note that the imbalanceTol parameter is interpeted differently by Scotch-METIS than just by METIS! Currently, imbalanceTol >= 1.0, we subtract 1.0, such that imbalanceTol = " + std::to_string(imbalanceTol) + ".");
+    }
+#else
+    // NOTE: scotchmetis interprets the imbalanceTol parameter differently
+    assert(imbalanceTol >= 1.0);
+    // This is the array of options as described in Section 5.4.
+    // The METIS options are not available if METIS is installed together with Scotch.
+    std::vector<idx_t> optionsVector(METIS_NOPTIONS);
+    idx_t* options = optionsVector.data();
+    Dune::cpgrid::setMetisOptions(params, manuallySelectedMethod, options);
+#endif
+
+    // This is an array of size ncon (in our case, of size 1) that specifies the allowed load imbalance tolerance for each constraint.
+    // For the ith partition and jth constraint the allowed weight is the ubvec[j]*tpwgts[i*ncon+j] fraction
+    // of the jth’s constraint total weight. The load imbalances must be greater than 1.0.
+    // A NULL value can be passed indicating that the load imbalance tolerance for each constraint should
+    // be 1.001 (for ncon=1) or 1.01 (for ncon>1).
+    real_t ubvec = imbalanceTol;
+
+    // Decide which partition method to use, both methods create k partitions, where
+    // METIS_PartGraphRecursive uses multilevel recursive bisection and
+    // METIS_PartGraphKway uses multilevel k-way partition.
+    // The advice is: Use METIS_PartGraphRecursive if k is small and if k is a power of two
+    // (n & (n - 1) == 0) is true if n > 0 and n is a power of two, this is an efficient bitwise check.
+    if (manuallySelectedMethod == 1 || (manuallySelectedMethod == 0 && nparts < 65 && ((nparts & (nparts - 1)) == 0))) {
+        if (manuallySelectedMethod == 1)
+            Opm::OpmLog::info("Partitioning grid using METIS_PartGraphRecursive.");
+        else if (nparts < 65 && ((nparts & (nparts - 1)) == 0))
+            Opm::OpmLog::info("Partitioning grid using METIS_PartGraphRecursive, since the number of partitions is small (<65) and a power of 2. If you want to use METIS_PartGraphKway instead, set the METIS Parameter METIS_OPTION_PTYPE = METIS_PTYPE_KWAY.");
+        rc = METIS_PartGraphRecursive(&n, 
+                                      &ncon,
+                                      xadj,
+                                      adjncy,
+                                      nullptr, // vwgt
+                                      nullptr, // vsize,
+                                      adjwgt,
+                                      &nparts,
+                                      nullptr, // tpwgts,
+                                      &ubvec,
+                                      options,
+                                      &objval,
+                                      gpart.data());
+    } else {
+        Opm::OpmLog::info("Partitioning grid using METIS_PartGraphKway.");
+        rc = METIS_PartGraphKway(&n, 
+                                 &ncon,
+                                 xadj,
+                                 adjncy,
+                                 nullptr, // vwgt
+                                 nullptr, // vsize,
+                                 adjwgt,
+                                 &nparts,
+                                 nullptr, // tpwgts,
+                                 &ubvec,
+                                 options,
+                                 &objval,
+                                 gpart.data());
+    }
+
+    partitionVector.assign(gpart.begin(), gpart.end());
+    return rc;
+}
+
+/// Partition the cells of the grid, or the grid and wells if gridAndWells
+/// is not null, into nparts parts with METIS on the calling process.
+/// \return The METIS return code.
+int metisPartitionCells(const CpGrid& cpgrid,
+                        const CombinedGridWellGraph* gridAndWells,
+                        idx_t nparts,
+                        real_t imbalanceTol,
+                        const std::map<std::string,std::string>& params,
+                        std::vector<int>& partitionVector)
+{
+    const bool wells = gridAndWells != nullptr;
+
+    // The number of vertices, every cell is a vertex in the graph.
+    idx_t n = cpgrid.numCells();
+
+    auto& globalIdSet         =  cpgrid.globalIdSet();
+    auto& localIdSet          =  cpgrid.localIdSet();
+
+    std::vector<idx_t> gids(n);
+    std::vector<idx_t> lids(n);
+
+    int idx = 0;
+    for (auto cell = cpgrid.leafbegin<0>(), cellEnd = cpgrid.leafend<0>(); cell != cellEnd; ++cell)
+    {
+        gids[idx]   = globalIdSet.id(*cell);
+        lids[idx++] = localIdSet.id(*cell);
+    }
+
+    // The adjacency structure of a graph with n vertices and m edges is represented using two arrays xadj and adjncy.
+    // An array of size n+1 that specifies the adjacency structure of the graph. The adjacency list of vertex i is stored in adjncy[xadj[i]] to adjncy[xadj[i+1]-1].
+    std::vector<idx_t> xadj(n+1);
+    xadj[0] = 0;
+
+    if( wells )
+    {            
+        for (int i = 0; i < n;  i++) {
+            xadj[i+1] = xadj[i] + Dune::cpgrid::getNumberOfEdgesForSpecificCellForGridWithWells(*gridAndWells, lids[i]);
+        }
+    }
+    else
+    {
+        for (int i = 0; i < n;  i++) {
+            xadj[i+1] = xadj[i] + Dune::cpgrid::getNumberOfEdgesForSpecificCell(cpgrid, lids[i]);
+        }
+    }
+
+    // The number of edges depends on whether there are wells or not, twoM = 2*m, where m = number of edges.
+    idx_t twoM = xadj[n];
+
+    // An array that contains the adjacency list of the graph.
+    // The xadj array is of size n + 1 whereas the adjncy array is of size 2m (because for each edge between vertices v and u we actually store both (v, u) and (u, v)).
+    // The adjacency list of vertex i is stored in array adjncy starting at index xadj[i] and ending at (but not
+    // including) index xadj[i + 1] (i.e., adjncy[xadj[i]] through and including adjncy[xadj[i + 1]-1])
+    // So: xadj contains the indices where we start for the respective component
+    idx_t* adjncy = new idx_t[twoM]; 
+    
+    // An array that contains the weights of the edges. If all edges have the same weight, this can be set to NULL.
+    // The weights of the edges (if any) are stored in an additional array called adjwgt. This array contains 2m elements, and the weight of edge adjncy[j] is stored at location adjwgt[j]
+    idx_t* adjwgt = new idx_t[twoM];
+
+    if( wells )
+    {
+        int neighborCounter = 0;
+        for( int cell = 0; cell < n;  cell++ )
+        {
+            fillNBORGIDAndWeightsForSpecificCellAndIncrementNeighborCounterForGridWithWells(*gridAndWells, lids[cell], gids.data(), neighborCounter, adjncy, adjwgt);
+        }
+    }
+    else
+    {
+        int neighborCounter = 0;
+        for( int cell = 0; cell < n;  cell++ )
+        {
+            fillNBORGIDForSpecificCellAndIncrementNeighborCounter(cpgrid, lids[cell], gids.data(), neighborCounter, adjncy);
+        }
+    }
+
+    const int rc = callMetis(n, xadj.data(), adjncy, wells ? adjwgt : nullptr,
+                             nparts, imbalanceTol, params, partitionVector);
+
+    delete[] adjncy;
+    delete[] adjwgt;
+    return rc;
+}
+
+/// Throw if a METIS call failed.
+void checkMetisReturnCode(int rc)
+{
+    if (rc == METIS_OK) {
+        // Function returned normally :)
+    } else if (rc == METIS_ERROR_INPUT) {
+        OPM_THROW(std::runtime_error, "METIS Input Error!");
+    } else if (rc == METIS_ERROR_MEMORY) {
+        OPM_THROW(std::runtime_error, "METIS could not allocate the required memory!");
+    } else if (rc == METIS_ERROR) {
+        OPM_THROW(std::runtime_error, "Some other type of METIS error!");
+    } else {   
+        OPM_THROW(std::runtime_error, "Some other type of general error!");
+    }
+}
+
+} // anonymous namespace
+
+
 std::tuple<std::vector<int>,
            std::vector<std::pair<std::string, bool>>,
            std::vector<std::tuple<int, int, char>>,
@@ -172,182 +378,42 @@ metisSerialGraphPartitionGridOnRoot(const CpGrid& cpgrid,
     cc.barrier();
     //Metis is a serial graph partitioner, we do everything only on root
     if (cc.rank() == root) {
-
-        //////// First, we define all variables that *do not depend* on whether there are wells or not
-
-        // The number of vertices, every cell is a vertex in the graph.
-        idx_t n = cpgrid.numCells();
-        
-        // This is a vector of size n that upon successful completion stores the partition vector of the graph.
-        // The numbering of this vector starts from either 0 or 1, depending on the value of options[METIS_OPTION_NUMBERING].
-        idx_t* gpart = new idx_t[n];
-
-        // Upon successful completion, this variable stores the edge-cut or the total communication volume of
-        // the partitioning solution. The value returned depends on the partitioning’s objective function.
-        idx_t objval = 0;
-
-        // The number of partitions to split the graph into, we want to distribtue over all processes, so cc.size()
-        idx_t nparts = cc.size(); 
-
-        auto& globalIdSet         =  cpgrid.globalIdSet();
-        auto& localIdSet          =  cpgrid.localIdSet();
-
-        idx_t* gids = new idx_t[n];
-        idx_t* lids = new idx_t[n];
-
-        int idx = 0;
-        for (auto cell = cpgrid.leafbegin<0>(), cellEnd = cpgrid.leafend<0>(); cell != cellEnd; ++cell)
-        {
-            gids[idx]   = globalIdSet.id(*cell);
-            lids[idx++] = localIdSet.id(*cell);
-        }
-
-        //The number of balancing constraints, should be at least 1.
-        idx_t ncon = 1;
-
-        // The adjacency structure of a graph with n vertices and m edges is represented using two arrays xadj and adjncy.
-        // An array of size n+1 that specifies the adjacency structure of the graph. The adjacency list of vertex i is stored in adjncy[xadj[i]] to adjncy[xadj[i+1]-1].
-        idx_t* xadj = new idx_t[n+1];
-        xadj[0] = 0;
-        
-        int manuallySelectedMethod = 0; // 0: choose according to number of partitions, 1: recursive, 2: kway
-#if IS_SCOTCH_METIS_HEADER
-        Opm::OpmLog::info("Not setting specific METIS Options since you're using Scotch-METIS.");
-        idx_t* options = nullptr;
-        if (imbalanceTol >= 1.0) {
-            imbalanceTol -= 1.0;
-            Opm::OpmLog::info("Note that the imbalanceTol parameter is interpeted differently by Scotch-METIS than just by METIS! Currently, imbalanceTol >= 1.0, we subtract 1.0, such that imbalanceTol = " + std::to_string(imbalanceTol) + ".");
-        }
-#else
-        // NOTE: scotchmetis interprets the imbalanceTol parameter differently
-        assert(imbalanceTol >= 1.0);
-        // This is the array of options as described in Section 5.4.
-        // The METIS options are not available if METIS is installed together with Scotch.
-        idx_t* options = new idx_t[METIS_NOPTIONS];
-        Dune::cpgrid::setMetisOptions(params, manuallySelectedMethod, options);
-#endif
-
-        // This is an array of size ncon (in our case, of size 1) that specifies the allowed load imbalance tolerance for each constraint.
-        // For the ith partition and jth constraint the allowed weight is the ubvec[j]*tpwgts[i*ncon+j] fraction
-        // of the jth’s constraint total weight. The load imbalances must be greater than 1.0.
-        // A NULL value can be passed indicating that the load imbalance tolerance for each constraint should
-        // be 1.001 (for ncon=1) or 1.01 (for ncon>1).
-        real_t ubvec = imbalanceTol;
-
-        //////// Now, we define all variables that *do depend* on whether there are wells or not
-
-        if( wells )
-        {            
-            for (int i = 0; i < n;  i++) {
-                xadj[i+1] = xadj[i] + Dune::cpgrid::getNumberOfEdgesForSpecificCellForGridWithWells(*gridAndWells, lids[i]);
-            }
-        }
-        else
-        {
-            for (int i = 0; i < n;  i++) {
-                xadj[i+1] = xadj[i] + Dune::cpgrid::getNumberOfEdgesForSpecificCell(cpgrid, lids[i]);
-            }
-        }
-
-        // The number of edges depends on whether there are wells or not, twoM = 2*m, where m = number of edges.
-        idx_t twoM = xadj[n];
-
-        // An array that contains the adjacency list of the graph.
-        // The xadj array is of size n + 1 whereas the adjncy array is of size 2m (because for each edge between vertices v and u we actually store both (v, u) and (u, v)).
-        // The adjacency list of vertex i is stored in array adjncy starting at index xadj[i] and ending at (but not
-        // including) index xadj[i + 1] (i.e., adjncy[xadj[i]] through and including adjncy[xadj[i + 1]-1])
-        // So: xadj contains the indices where we start for the respective component
-        idx_t* adjncy = new idx_t[twoM]; 
-        
-        // An array that contains the weights of the edges. If all edges have the same weight, this can be set to NULL.
-        // The weights of the edges (if any) are stored in an additional array called adjwgt. This array contains 2m elements, and the weight of edge adjncy[j] is stored at location adjwgt[j]
-        idx_t* adjwgt = new idx_t[twoM];
-
-        if( wells )
-        {
-            int neighborCounter = 0;
-            for( int cell = 0; cell < n;  cell++ )
-            {
-                fillNBORGIDAndWeightsForSpecificCellAndIncrementNeighborCounterForGridWithWells(*gridAndWells, lids[cell], gids, neighborCounter, adjncy, adjwgt);
-            }
-        }
-        else
-        {
-            int neighborCounter = 0;
-            for( int cell = 0; cell < n;  cell++ )
-            {
-                fillNBORGIDForSpecificCellAndIncrementNeighborCounter(cpgrid, lids[cell], gids, neighborCounter, adjncy);
-            }
-        }
-
-        // Decide which partition method to use, both methods create k partitions, where
-        // METIS_PartGraphRecursive uses multilevel recursive bisection and
-        // METIS_PartGraphKway uses multilevel k-way partition.
-        // The advice is: Use METIS_PartGraphRecursive if k is small and if k is a power of two
-        // (n & (n - 1) == 0) is true if n > 0 and n is a power of two, this is an efficient bitwise check.
-        if (manuallySelectedMethod == 1 || (manuallySelectedMethod == 0 && nparts < 65 && ((nparts & (nparts - 1)) == 0))) {
-            if (manuallySelectedMethod == 1)
-                Opm::OpmLog::info("Partitioning grid using METIS_PartGraphRecursive.");
-            else if (nparts < 65 && ((nparts & (nparts - 1)) == 0))
-                Opm::OpmLog::info("Partitioning grid using METIS_PartGraphRecursive, since the number of partitions is small (<65) and a power of 2. If you want to use METIS_PartGraphKway instead, set the METIS Parameter METIS_OPTION_PTYPE = METIS_PTYPE_KWAY.");
-            rc = METIS_PartGraphRecursive(&n, 
-                                          &ncon,
-                                          xadj,
-                                          adjncy,
-                                          nullptr, // vwgt
-                                          nullptr, // vsize,
-                                          wells ? adjwgt : nullptr,
-                                          &nparts,
-                                          nullptr, // tpwgts,
-                                          &ubvec,
-                                          options,
-                                          &objval,
-                                          gpart);
-        } else {
-            Opm::OpmLog::info("Partitioning grid using METIS_PartGraphKway.");
-            rc = METIS_PartGraphKway(&n, 
-                                     &ncon,
-                                     xadj,
-                                     adjncy,
-                                     nullptr, // vwgt
-                                     nullptr, // vsize,
-                                     wells ? adjwgt : nullptr,
-                                     &nparts,
-                                     nullptr, // tpwgts,
-                                     &ubvec,
-                                     options,
-                                     &objval,
-                                     gpart);
-        }
-
-        partitionVector.assign(gpart, gpart + n);
-        
-        delete[] gids;
-        delete[] lids;
-        delete[] xadj;
-        delete[] adjncy;
-        delete[] adjwgt;
-        delete[] options;
-        delete[] gpart;
+        // We want to distribute over all processes.
+        rc = metisPartitionCells(cpgrid, gridAndWells.get(), cc.size(), imbalanceTol, params, partitionVector);
     }
 
     //Broadcast the return value to all processes
     cc.broadcast(&rc, 1, root);
-    if (rc == METIS_OK) {
-        // Function returned normally :)
-    } else if (rc == METIS_ERROR_INPUT) {
-        OPM_THROW(std::runtime_error, "METIS Input Error!");
-    } else if (rc == METIS_ERROR_MEMORY) {
-        OPM_THROW(std::runtime_error, "METIS could not allocate the required memory!");
-    } else if (rc == METIS_ERROR) {
-        OPM_THROW(std::runtime_error, "Some other type of METIS error!");
-    } else {   
-        OPM_THROW(std::runtime_error, "Some other type of general error!");
-    }
+    checkMetisReturnCode(rc);
     
     return cpgrid::createListsFromParts(cpgrid, wells, possibleFutureConnections, transmissibilities, partitionVector, allowDistributedWells, gridAndWells);
 }
 
+std::vector<int>
+metisPartitionGraph(std::vector<idx_t> xadj,
+                    std::vector<idx_t> adjncy,
+                    int numParts,
+                    real_t imbalanceTol,
+                    const std::map<std::string,std::string>& params)
+{
+    if (xadj.empty()) {
+        return {};
+    }
+    const idx_t n = xadj.size() - 1;
+    if (n == 0) {
+        return {};
+    }
+    if (numParts == 1) {
+        return std::vector<int>(n, 0);
+    }
+    // METIS does not accept a null adjacency array, even without edges.
+    adjncy.resize(std::max(adjncy.size(), std::size_t(1)));
+    std::vector<int> partitionVector;
+    checkMetisReturnCode(callMetis(n, xadj.data(), adjncy.data(), nullptr,
+                                   numParts, imbalanceTol, params, partitionVector));
+    return partitionVector;
+}
+
 } // namespace cpgrid
 } // namespace Dune
 #endif // HAVE_METIS && HAVE_MPI
@@ -115,6 +115,24 @@ metisSerialGraphPartitionGridOnRoot(const CpGrid& grid,
                                     real_t imbalanceTol,
                                     bool allowDistributedWells,
                                     const std::map<std::string,std::string>& params);
+
+/// \brief Partition a graph given in CSR format into a given number of parts using METIS
+///
+/// The partitioning is done on the calling process with the same choice of
+/// METIS method and options as for the grids. The edges have uniform weights.
+///
+/// @param xadj The adjacency list of vertex i is adjncy[xadj[i]] to adjncy[xadj[i+1]-1].
+/// @param adjncy The symmetric adjacency lists without self loops.
+/// @param numParts How many parts to divide the graph into.
+/// @param imbalanceTol Set the imbalance tolerance used by METIS, i.e. the entries of the parameter ubvec
+/// @param params Options passed on to METIS, as for metisSerialGraphPartitionGridOnRoot
+/// @return A list containing the part of vertex i for all vertices.
+std::vector<int>
+metisPartitionGraph(std::vector<idx_t> xadj,
+                    std::vector<idx_t> adjncy,
+                    int numParts,
+                    real_t imbalanceTol,
+                    const std::map<std::string,std::string>& params = {});
 }
 }
 
@@ -0,0 +1,153 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#include <opm/grid/common/SubDomains.hpp>
+
+#include <opm/common/ErrorMacros.hpp>
+
+#include <opm/grid/CpGrid.hpp>
+#include <opm/grid/common/GridPartitioning.hpp>
+#if defined(HAVE_METIS) && HAVE_MPI
+#include <opm/grid/common/MetisPartition.hpp>
+#endif
+#if HAVE_MPI && HAVE_ZOLTAN
+#include <opm/grid/common/ZoltanPartition.hpp>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Dune
+{
+
+namespace
+{
+
+/// Split num_domains into logically Cartesian block counts that fit the
+/// grid, minimising the number of cell faces between blocks.
+std::array<int, 3> cartesianSplit(const std::array<int, 3>& dims, int num_domains)
+{
+    std::array<int, 3> best = { 0, 0, 0 };
+    double best_area = std::numeric_limits<double>::max();
+    for (int px = 1; px <= num_domains; ++px) {
+        if (num_domains % px != 0) {
+            continue;
+        }
+        for (int py = 1; py <= num_domains / px; ++py) {
+            if ((num_domains / px) % py != 0) {
+                continue;
+            }
+            const int pz = num_domains / (px * py);
+            const double area = double(px - 1) * dims[1] * dims[2]
+                + double(py - 1) * dims[0] * dims[2]
+                + double(pz - 1) * dims[0] * dims[1];
+            if (px <= dims[0] && py <= dims[1] && pz <= dims[2] && area < best_area) {
+                best = { px, py, pz };
+                best_area = area;
+            }
+        }
+    }
+    if (best[0] == 0) {
+        OPM_THROW(std::invalid_argument,
+                  "Cannot split a " + std::to_string(dims[0]) + "x" + std::to_string(dims[1])
+                  + "x" + std::to_string(dims[2]) + " grid into " + std::to_string(num_domains)
+                  + " Cartesian blocks");
+    }
+    return best;
+}
+
+/// The graph of the leaf cells of this process in CSR format, with the
+/// duplicate connections of cells sharing several faces removed. It only
+/// uses leaf indices, so it is valid for distributed and refined grids.
+[[maybe_unused]] std::pair<std::vector<int>, std::vector<int>>
+leafCellGraph(const CpGrid& grid)
+{
+    std::vector<int> start;
+    std::vector<int> adj;
+    SubDomains<CpGrid::LeafGridView>::cellAdjacency(grid.leafGridView(), nullptr, start, adj);
+    int out = 0;
+    int begin = 0;
+    for (std::size_t cell = 0; cell + 1 < start.size(); ++cell) {
+        const int end = start[cell + 1];
+        std::sort(adj.begin() + begin, adj.begin() + end);
+        for (int a = begin; a < end; ++a) {
+            if (a == begin || adj[a] != adj[a - 1]) {
+                adj[out++] = adj[a];
+            }
+        }
+        begin = end;
+        start[cell + 1] = out;
+    }
+    adj.resize(out);
+    return { std::move(start), std::move(adj) };
+}
+
+} // anonymous namespace
+
+std::vector<int> partitionSubDomains(const CpGrid& grid,
+                                     int num_domains,
+                                     PartitionMethod method,
+                                     double imbalance_tol)
+{
+    if (num_domains < 1) {
+        OPM_THROW(std::invalid_argument,
+                  "Number of subdomains must be positive, got " + std::to_string(num_domains));
+    }
+    switch (method) {
+    case PartitionMethod::simple: {
+        const auto split = cartesianSplit(grid.logicalCartesianSize(), num_domains);
+        int num_part = 0;
+        std::vector<int> cell_part;
+        partition(grid, split, num_part, cell_part, false, false);
+        return cell_part;
+    }
+    case PartitionMethod::zoltan:
+    case PartitionMethod::zoltanGoG:
+#if HAVE_MPI && HAVE_ZOLTAN
+    {
+        const auto [start, adj] = leafCellGraph(grid);
+        return cpgrid::zoltanPartitionGraph(start, adj, num_domains, imbalance_tol);
+    }
+#else
+        OPM_THROW(std::runtime_error, "Zoltan subdomains need MPI and Zoltan.");
+#endif
+    case PartitionMethod::metis:
+#if defined(HAVE_METIS) && HAVE_MPI
+    {
+        const auto [start, adj] = leafCellGraph(grid);
+        return cpgrid::metisPartitionGraph({ start.begin(), start.end() },
+                                           { adj.begin(), adj.end() },
+                                           num_domains, imbalance_tol);
+    }
+#else
+        OPM_THROW(std::runtime_error, "METIS subdomains need MPI and METIS.");
+#endif
+    }
+    OPM_THROW(std::invalid_argument,
+              "Unknown partition method " + std::to_string(static_cast<int>(method)));
+}
+
+} // namespace Dune
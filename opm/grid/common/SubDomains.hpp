@@ -0,0 +1,423 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_SUBDOMAINS_HEADER
+#define OPM_SUBDOMAINS_HEADER
+
+#include <opm/grid/common/GridEnums.hpp>
+#include <opm/grid/common/SubGridPart.hpp>
+#include <opm/grid/utility/ElementChunks.hpp>
+#include <opm/grid/utility/IteratorRange.hpp>
+
+#include <dune/grid/common/partitionset.hh>
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace Dune
+{
+
+class CpGrid;
+
+/// \brief Partition the cells of a CpGrid into subdomains.
+///
+/// \param grid           The grid, which may be distributed and refined.
+/// \param num_domains    The number of subdomains requested.
+/// \param method         simple splits the logical Cartesian grid into
+///                       blocks with Dune::partition(), dropping blocks
+///                       without active cells. zoltan and zoltanGoG use
+///                       Zoltan's graph partitioner, metis uses METIS,
+///                       both on the graph of the leaf cells of this
+///                       process from SubDomains::cellAdjacency().
+/// \param imbalance_tol  Imbalance tolerance of Zoltan and METIS.
+/// \return The subdomain of each cell of the leaf grid view.
+/// \throw std::invalid_argument if num_domains is not positive, or too
+///        large for a Cartesian split with the simple method.
+/// \throw std::runtime_error if the method is not available in this build.
+std::vector<int> partitionSubDomains(const CpGrid& grid,
+                                     int num_domains,
+                                     PartitionMethod method,
+                                     double imbalance_tol = 1.1);
+
+/// \brief Many subdomains of a grid view, set up at once in flat arrays.
+///
+/// Given a partition of the elements of a grid view into subdomains, for
+/// example from Dune::partition() or a Zoltan or METIS partitioning of the
+/// local grid, this builds for every subdomain
+///   - a local numbering of its cells, with the interior cells (all of
+///     whose neighbours are in the same subdomain) first and the boundary
+///     cells after them,
+///   - the connections between its cells in compressed row storage, using
+///     local cell numbers,
+///   - the connections from its cells to cells outside it, using grid view
+///     cell indices.
+///
+/// All subdomains share the same arrays, which are built in a few threaded
+/// passes over the grid view instead of one pass per subdomain. The
+/// SubDomain objects handed out by operator[] are cheap read-only views,
+/// so different threads can work on different subdomains concurrently:
+///
+///     Dune::SubDomains domains(grid.leafGridView(), cell_part);
+///
+/// or, for a CpGrid, with the partition computed by makeSubDomains():
+///
+///     const auto domains = Dune::makeSubDomains(grid, 8, Dune::PartitionMethod::metis);
+///     #pragma omp parallel for
+///     for (int d = 0; d < domains.size(); ++d) {
+///         const auto domain = domains[d];
+///         for (int c = 0; c < domain.numCells(); ++c) {
+///             for (const int nb : domain.neighbours(c)) {
+///                 // Local connection c -> nb.
+///             }
+///         }
+///     }
+template <class GridView>
+class SubDomains
+{
+public:
+    using Element = typename GridView::template Codim<0>::Entity;
+    using Seed = typename Element::EntitySeed;
+
+    /// \brief Set up the subdomains.
+    ///
+    /// \param gv         The grid view.
+    /// \param cell_part  Subdomain of each element, indexed by the index
+    ///                   set of gv. Cells with a negative value belong to
+    ///                   no subdomain. The number of subdomains is one
+    ///                   more than the largest value.
+    SubDomains(const GridView& gv, const std::vector<int>& cell_part)
+        : gv_(gv)
+        , cell_part_(cell_part)
+    {
+        const int num_cells = gv.size(0);
+        if (static_cast<int>(cell_part.size()) != num_cells) {
+            throw std::invalid_argument("SubDomains needs one subdomain number per cell.");
+        }
+        const int num_domains = num_cells > 0
+            ? std::max(*std::max_element(cell_part.begin(), cell_part.end()) + 1, 0)
+            : 0;
+        cellAdjacency(gv_, &seeds_, adj_start_, adj_);
+
+        // Sort the cells by subdomain.
+        cell_start_.assign(num_domains + 1, 0);
+        for (const int d : cell_part) {
+            if (d >= 0) {
+                ++cell_start_[d + 1];
+            }
+        }
+        std::partial_sum(cell_start_.begin(), cell_start_.end(), cell_start_.begin());
+        cells_.resize(cell_start_.back());
+        {
+            std::vector<int> pos(cell_start_.begin(), cell_start_.end() - 1);
+            for (int cell = 0; cell < num_cells; ++cell) {
+                if (cell_part[cell] >= 0) {
+                    cells_[pos[cell_part[cell]]++] = cell;
+                }
+            }
+        }
+
+        // Put the interior cells of each subdomain first, and number the
+        // cells locally.
+        num_interior_.resize(num_domains);
+        local_index_.assign(num_cells, -1);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+        for (int d = 0; d < num_domains; ++d) {
+            const auto begin = cells_.begin() + cell_start_[d];
+            const auto end = cells_.begin() + cell_start_[d + 1];
+            const auto boundary = std::stable_partition(begin, end, [&](const int cell) {
+                for (int a = adj_start_[cell]; a < adj_start_[cell + 1]; ++a) {
+                    if (cell_part_[adj_[a]] != d) {
+                        return false;
+                    }
+                }
+                return true;
+            });
+            num_interior_[d] = boundary - begin;
+            for (auto it = begin; it != end; ++it) {
+                local_index_[*it] = it - begin;
+            }
+        }
+
+        // Connections within and out of each subdomain, by position in cells_.
+        const int num_included = cells_.size();
+        inner_start_.assign(num_included + 1, 0);
+        outer_start_.assign(num_included + 1, 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int pos = 0; pos < num_included; ++pos) {
+            const int cell = cells_[pos];
+            for (int a = adj_start_[cell]; a < adj_start_[cell + 1]; ++a) {
+                if (cell_part_[adj_[a]] == cell_part_[cell]) {
+                    ++inner_start_[pos + 1];
+                } else {
+                    ++outer_start_[pos + 1];
+                }
+            }
+        }
+        std::partial_sum(inner_start_.begin(), inner_start_.end(), inner_start_.begin());
+        std::partial_sum(outer_start_.begin(), outer_start_.end(), outer_start_.begin());
+        inner_.resize(inner_start_.back());
+        outer_.resize(outer_start_.back());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int pos = 0; pos < num_included; ++pos) {
+            const int cell = cells_[pos];
+            int inner = inner_start_[pos];
+            int outer = outer_start_[pos];
+            for (int a = adj_start_[cell]; a < adj_start_[cell + 1]; ++a) {
+                const int nb = adj_[a];
+                if (cell_part_[nb] == cell_part_[cell]) {
+                    inner_[inner++] = local_index_[nb];
+                } else {
+                    outer_[outer++] = nb;
+                }
+            }
+        }
+    }
+
+    /// \brief Read-only view of one subdomain.
+    ///
+    /// Cells are numbered locally from 0 to numCells() - 1, with the
+    /// interior cells first.
+    class SubDomain
+    {
+    public:
+        SubDomain(const SubDomains& domains, const int index)
+            : domains_(&domains)
+            , index_(index)
+            , first_(domains.cell_start_[index])
+        {
+        }
+
+        /// The number of this subdomain.
+        int index() const
+        {
+            return index_;
+        }
+
+        int numCells() const
+        {
+            return domains_->cell_start_[index_ + 1] - first_;
+        }
+
+        /// Number of cells with all their neighbours in this subdomain.
+        int numInterior() const
+        {
+            return domains_->num_interior_[index_];
+        }
+
+        /// Grid view indices of the cells, in local order.
+        Opm::iterator_range_pod<int> cells() const
+        {
+            return span(domains_->cells_, first_, first_ + numCells());
+        }
+
+        /// Grid view indices of the interior cells, local numbers
+        /// [0, numInterior()).
+        Opm::iterator_range_pod<int> interiorCells() const
+        {
+            return span(domains_->cells_, first_, first_ + numInterior());
+        }
+
+        /// Grid view indices of the cells with neighbours outside this
+        /// subdomain, local numbers [numInterior(), numCells()).
+        Opm::iterator_range_pod<int> boundaryCells() const
+        {
+            return span(domains_->cells_, first_ + numInterior(), first_ + numCells());
+        }
+
+        /// Local numbers of the neighbours of a cell in this subdomain.
+        ///
+        /// There is one entry per face shared with a neighbour, so this
+        /// and externalNeighbours() together form the cell-to-face table
+        /// of the subdomain.
+        Opm::iterator_range_pod<int> neighbours(const int local_cell) const
+        {
+            const int pos = first_ + local_cell;
+            return span(domains_->inner_, domains_->inner_start_[pos], domains_->inner_start_[pos + 1]);
+        }
+
+        /// Grid view indices of the neighbours of a cell outside this
+        /// subdomain. Empty for interior cells.
+        Opm::iterator_range_pod<int> externalNeighbours(const int local_cell) const
+        {
+            const int pos = first_ + local_cell;
+            return span(domains_->outer_, domains_->outer_start_[pos], domains_->outer_start_[pos + 1]);
+        }
+
+        /// The element of a cell.
+        Element element(const int local_cell) const
+        {
+            return domains_->gv_.grid().entity(domains_->seeds_[domains_->cells_[first_ + local_cell]]);
+        }
+
+    private:
+        static Opm::iterator_range_pod<int> span(const std::vector<int>& v, const int begin, const int end)
+        {
+            return { v.data() + begin, v.data() + end };
+        }
+
+        const SubDomains* domains_;
+        int index_;
+        int first_;
+    };
+
+    /// Number of subdomains.
+    int size() const
+    {
+        return cell_start_.size() - 1;
+    }
+
+    SubDomain operator[](const int d) const
+    {
+        return SubDomain(*this, d);
+    }
+
+    /// Subdomain of a cell, or a negative number if it is in none.
+    int subDomain(const int cell) const
+    {
+        return cell_part_[cell];
+    }
+
+    /// Local number of a cell within its subdomain, or -1 if it is in none.
+    int localIndex(const int cell) const
+    {
+        return local_index_[cell];
+    }
+
+    /// A SubGridPart of one subdomain, for code written against the
+    /// grid view interface. The cells of the subdomain are its interior,
+    /// and with overlap their neighbours outside it form the overlap.
+    SubGridPart<typename GridView::Grid> subGridPart(const int d, const bool overlap = true) const
+    {
+        const auto cells = (*this)[d].cells();
+        std::vector<Seed> seeds;
+        seeds.reserve(cells.size());
+        for (const int cell : cells) {
+            seeds.push_back(seeds_[cell]);
+        }
+        return SubGridPart<typename GridView::Grid>(gv_.grid(), std::move(seeds), overlap);
+    }
+
+    /// \brief Collect the neighbours of every cell of a grid view in
+    ///        compressed row storage, threaded over element chunks.
+    ///
+    /// There is one entry per intersection with a neighbour, in the order
+    /// of the intersections, so cells sharing several faces are listed
+    /// several times.
+    ///
+    /// \param gv      The grid view.
+    /// \param seeds   If not null, the seed of every cell is stored here.
+    /// \param start   The neighbours of cell c are adj[start[c]] to adj[start[c+1]-1].
+    /// \param adj     Grid view indices of the neighbours.
+    static void cellAdjacency(const GridView& gv,
+                              std::vector<Seed>* seeds,
+                              std::vector<int>& start,
+                              std::vector<int>& adj)
+    {
+        const int num_cells = gv.size(0);
+#ifdef _OPENMP
+        const std::size_t num_chunks = 4 * omp_get_max_threads();
+#else
+        const std::size_t num_chunks = 1;
+#endif
+        const Opm::ElementChunks chunks(gv, Dune::Partitions::all, num_chunks);
+        const auto& index_set = gv.indexSet();
+        if (seeds) {
+            seeds->resize(num_cells);
+        }
+        start.assign(num_cells + 1, 0);
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (const auto& chunk : chunks) {
+            for (const auto& elem : chunk) {
+                const int cell = index_set.index(elem);
+                if (seeds) {
+                    (*seeds)[cell] = elem.seed();
+                }
+                for (const auto& is : intersections(gv, elem)) {
+                    if (is.neighbor()) {
+                        ++start[cell + 1];
+                    }
+                }
+            }
+        }
+        std::partial_sum(start.begin(), start.end(), start.begin());
+        adj.resize(start.back());
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (const auto& chunk : chunks) {
+            for (const auto& elem : chunk) {
+                const int cell = index_set.index(elem);
+                int a = start[cell];
+                for (const auto& is : intersections(gv, elem)) {
+                    if (is.neighbor()) {
+                        adj[a++] = index_set.index(is.outside());
+                    }
+                }
+            }
+        }
+    }
+
+private:
+    GridView gv_;
+    std::vector<int> cell_part_;
+    std::vector<Seed> seeds_;
+    std::vector<int> adj_start_;
+    std::vector<int> adj_;
+    std::vector<int> cell_start_;
+    std::vector<int> cells_;
+    std::vector<int> num_interior_;
+    std::vector<int> local_index_;
+    std::vector<int> inner_start_;
+    std::vector<int> inner_;
+    std::vector<int> outer_start_;
+    std::vector<int> outer_;
+};
+
+/// \brief Partition a grid into num_domains subdomains with the given
+///        method, see partitionSubDomains(), and set them up on the leaf
+///        grid view.
+template <class Grid>
+SubDomains<typename Grid::LeafGridView>
+makeSubDomains(const Grid& grid,
+               int num_domains,
+               PartitionMethod method,
+               double imbalance_tol = 1.1)
+{
+    return SubDomains<typename Grid::LeafGridView>(grid.leafGridView(),
+                                                   partitionSubDomains(grid, num_domains, method, imbalance_tol));
+}
+
+} // namespace Dune
+
+#endif // OPM_SUBDOMAINS_HEADER
@@ -0,0 +1,816 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <config.h>
+
+#include <opm/grid/common/UnstructuredGridPartitioning.hpp>
+
+#include <opm/common/ErrorMacros.hpp>
+#include <opm/grid/UnstructuredGrid.h>
+#if defined(HAVE_METIS) && HAVE_MPI
+#include <opm/grid/common/MetisPartition.hpp>
+#endif
+#if HAVE_MPI && HAVE_ZOLTAN
+#include <opm/grid/common/ZoltanPartition.hpp>
+#endif
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace Opm
+{
+
+namespace
+{
+
+    /// The dual graph of the grid in CSR format, i.e. the symmetric and
+    /// duplicate free adjacency of the cells through their faces.
+    [[maybe_unused]] std::pair<std::vector<int>, std::vector<int>>
+    dualGraph(const UnstructuredGrid& grid)
+    {
+        const int nc = grid.number_of_cells;
+        std::vector<int> xadj(nc + 1, 0);
+        for (int f = 0; f < grid.number_of_faces; ++f) {
+            const int c0 = grid.face_cells[2*f];
+            const int c1 = grid.face_cells[2*f + 1];
+            if (c0 >= 0 && c1 >= 0 && c0 != c1) {
+                ++xadj[c0 + 1];
+                ++xadj[c1 + 1];
+            }
+        }
+        std::partial_sum(xadj.begin(), xadj.end(), xadj.begin());
+
+        std::vector<int> adjncy(xadj[nc]);
+        std::vector<int> pos(xadj.begin(), xadj.end() - 1);
+        for (int f = 0; f < grid.number_of_faces; ++f) {
+            const int c0 = grid.face_cells[2*f];
+            const int c1 = grid.face_cells[2*f + 1];
+            if (c0 >= 0 && c1 >= 0 && c0 != c1) {
+                adjncy[pos[c0]++] = c1;
+                adjncy[pos[c1]++] = c0;
+            }
+        }
+
+        // Remove the duplicates of cells sharing several faces.
+        int out = 0;
+        int begin = 0;
+        for (int c = 0; c < nc; ++c) {
+            const int end = xadj[c + 1];
+            std::sort(adjncy.begin() + begin, adjncy.begin() + end);
+            for (int i = begin; i < end; ++i) {
+                if (i == begin || adjncy[i] != adjncy[i - 1]) {
+                    adjncy[out++] = adjncy[i];
+                }
+            }
+            begin = end;
+            xadj[c + 1] = out;
+        }
+        adjncy.resize(out);
+        return { std::move(xadj), std::move(adjncy) };
+    }
+
+    /// Split the cells into contiguous ranges of (almost) equal size, the
+    /// first nc % num_parts ranges get one extra cell.
+    std::vector<int> contiguousPartition(int nc, int num_parts)
+    {
+        std::vector<int> part(nc, 0);
+        const int base = nc / num_parts;
+        const int extra = nc % num_parts;
+        int cell = 0;
+        for (int p = 0; p < num_parts; ++p) {
+            const int count = base + (p < extra ? 1 : 0);
+            std::fill(part.begin() + cell, part.begin() + cell + count, p);
+            cell += count;
+        }
+        return part;
+    }
+
+    /// Add the sorted set \p from to the sorted set \p to.
+    void mergeInto(std::vector<int>& to, const std::vector<int>& from)
+    {
+        if (std::includes(to.begin(), to.end(), from.begin(), from.end())) {
+            return;
+        }
+        std::vector<int> merged;
+        merged.reserve(to.size() + from.size());
+        std::set_union(to.begin(), to.end(), from.begin(), from.end(),
+                       std::back_inserter(merged));
+        to.swap(merged);
+    }
+
+    /// Partition type of a face or node on rank \p rank given its adjacent
+    /// (global) cells. It is interior if all of them are interior, border if
+    /// some are, front if some are not present on the rank at all, and
+    /// overlap otherwise.
+    Dune::PartitionType subEntityPartitionType(const std::vector<int>& cells,
+                                               const std::vector<int>& cell_part,
+                                               const std::vector<std::vector<int>>& present,
+                                               int rank)
+    {
+        const auto mine = std::count_if(cells.begin(), cells.end(),
+                                        [&cell_part, rank](int c) { return cell_part[c] == rank; });
+        if (mine > 0) {
+            return (mine == static_cast<long>(cells.size())) ? Dune::InteriorEntity
+                                                             : Dune::BorderEntity;
+        }
+        const bool front = std::any_of(cells.begin(), cells.end(), [&present, rank](int c)
+        {
+            return !std::binary_search(present[c].begin(), present[c].end(), rank);
+        });
+        return front ? Dune::FrontEntity : Dune::OverlapEntity;
+    }
+
+    template<class T>
+    T* allocateCopy(const T* src, std::size_t n)
+    {
+        T* dst = static_cast<T*>(std::malloc(std::max(n, std::size_t(1)) * sizeof(T)));
+        if (dst == nullptr) {
+            OPM_THROW(std::runtime_error, "Unable to allocate local grid storage");
+        }
+        if (src != nullptr && n > 0) {
+            std::memcpy(dst, src, n * sizeof(T));
+        }
+        return dst;
+    }
+
+    /// What is shared by the local grids of all parts, computed once such
+    /// that extracting the grid of one part only costs its own size.
+    struct PartLayout
+    {
+        /// present[c] holds the (sorted) ranks that have cell c.
+        std::vector<std::vector<int>> present;
+        /// For each rank its interior cells followed by its overlap cells,
+        /// each in global order.
+        std::vector<std::vector<int>> cells;
+        /// Number of interior cells of each rank.
+        std::vector<std::size_t> num_interior;
+        /// The (sorted) cells adjacent to each node, in CSR format.
+        std::vector<int> node_cellpos;
+        std::vector<int> node_cells;
+    };
+
+    PartLayout computePartLayout(const UnstructuredGrid& g,
+                                 const std::vector<int>& cell_part,
+                                 int num_parts,
+                                 int overlap_layers)
+    {
+        const int nc = g.number_of_cells;
+        const int nf = g.number_of_faces;
+        const int nn = g.number_of_nodes;
+
+        if (static_cast<int>(cell_part.size()) != nc) {
+            OPM_THROW(std::invalid_argument, "Cell partition does not match the number of grid cells");
+        }
+        if (overlap_layers < 0) {
+            OPM_THROW(std::invalid_argument, "Number of overlap layers must not be negative");
+        }
+        if (std::any_of(cell_part.begin(), cell_part.end(),
+                        [num_parts](int p) { return p < 0 || p >= num_parts; })) {
+            OPM_THROW(std::invalid_argument, "Cell partition refers to parts outside [0, "
+                      + std::to_string(num_parts) + ")");
+        }
+
+        PartLayout layout;
+
+        // Start with the owner of each cell and add overlap_layers layers
+        // of overlap around each part.
+        auto& present = layout.present;
+        present.resize(nc);
+        for (int c = 0; c < nc; ++c) {
+            present[c].assign(1, cell_part[c]);
+        }
+        for (int layer = 0; layer < overlap_layers; ++layer) {
+            auto next = present;
+            for (int f = 0; f < nf; ++f) {
+                const int c0 = g.face_cells[2*f];
+                const int c1 = g.face_cells[2*f + 1];
+                if (c0 >= 0 && c1 >= 0) {
+                    mergeInto(next[c0], present[c1]);
+                    mergeInto(next[c1], present[c0]);
+                }
+            }
+            present.swap(next);
+        }
+
+        // Bucket the cells by rank in one pass for the interior cells and
+        // one for the overlap cells.
+        layout.cells.resize(num_parts);
+        for (int c = 0; c < nc; ++c) {
+            layout.cells[cell_part[c]].push_back(c);
+        }
+        layout.num_interior.resize(num_parts);
+        for (int p = 0; p < num_parts; ++p) {
+            layout.num_interior[p] = layout.cells[p].size();
+        }
+        for (int c = 0; c < nc; ++c) {
+            for (int p : present[c]) {
+                if (p != cell_part[c]) {
+                    layout.cells[p].push_back(c);
+                }
+            }
+        }
+
+        // Invert the (duplicate free) nodes of each cell.
+        std::vector<int> cell_nodepos(nc + 1, 0);
+        std::vector<int> cell_nodes;
+        for (int c = 0; c < nc; ++c) {
+            const auto begin = cell_nodes.size();
+            for (auto hf = g.cell_facepos[c]; hf < g.cell_facepos[c + 1]; ++hf) {
+                const int f = g.cell_faces[hf];
+                cell_nodes.insert(cell_nodes.end(), g.face_nodes + g.face_nodepos[f],
+                                  g.face_nodes + g.face_nodepos[f + 1]);
+            }
+            std::sort(cell_nodes.begin() + begin, cell_nodes.end());
+            cell_nodes.erase(std::unique(cell_nodes.begin() + begin, cell_nodes.end()), cell_nodes.end());
+            cell_nodepos[c + 1] = cell_nodes.size();
+        }
+        layout.node_cellpos.assign(nn + 1, 0);
+        for (int n : cell_nodes) {
+            ++layout.node_cellpos[n + 1];
+        }
+        std::partial_sum(layout.node_cellpos.begin(), layout.node_cellpos.end(),
+                         layout.node_cellpos.begin());
+        layout.node_cells.resize(cell_nodes.size());
+        std::vector<int> pos(layout.node_cellpos.begin(), layout.node_cellpos.end() - 1);
+        for (int c = 0; c < nc; ++c) {
+            for (int i = cell_nodepos[c]; i < cell_nodepos[c + 1]; ++i) {
+                layout.node_cells[pos[cell_nodes[i]]++] = c;
+            }
+        }
+        return layout;
+    }
+
+    /// Maps from global to local indices. All entries are -1 between two
+    /// extractions, such that an extraction only touches its own entities.
+    struct GlobalToLocal
+    {
+        explicit GlobalToLocal(const UnstructuredGrid& g)
+            : cell(g.number_of_cells, -1)
+            , face(g.number_of_faces, -1)
+            , node(g.number_of_nodes, -1)
+        {}
+
+        std::vector<int> cell;
+        std::vector<int> face;
+        std::vector<int> node;
+    };
+
+    LocalUnstructuredGrid extractPart(const UnstructuredGrid& g,
+                                      const std::vector<int>& cell_part,
+                                      const PartLayout& layout,
+                                      int rank,
+                                      GlobalToLocal& g2l)
+    {
+        const int nc = g.number_of_cells;
+        const int nf = g.number_of_faces;
+        const int nn = g.number_of_nodes;
+        const int dims = g.dimensions;
+        const auto& present = layout.present;
+
+        LocalUnstructuredGrid local;
+        local.global_sizes = { nc, nf, nn };
+
+        // Cells: interior first, then overlap, each in global order.
+        local.global_cell = layout.cells[rank];
+        const std::size_t num_interior = layout.num_interior[rank];
+        const int lnc = local.global_cell.size();
+        for (int lc = 0; lc < lnc; ++lc) {
+            g2l.cell[local.global_cell[lc]] = lc;
+        }
+
+        // Faces and nodes of local cells, in global order.
+        std::size_t num_cell_faces = 0;
+        for (int c : local.global_cell) {
+            for (auto hf = g.cell_facepos[c]; hf < g.cell_facepos[c + 1]; ++hf) {
+                const int f = g.cell_faces[hf];
+                if (g2l.face[f] < 0) {
+                    g2l.face[f] = 0;
+                    local.global_face.push_back(f);
+                }
+            }
+            num_cell_faces += g.cell_facepos[c + 1] - g.cell_facepos[c];
+        }
+        std::sort(local.global_face.begin(), local.global_face.end());
+        const int lnf = local.global_face.size();
+        std::size_t num_face_nodes = 0;
+        for (int lf = 0; lf < lnf; ++lf) {
+            const int f = local.global_face[lf];
+            g2l.face[f] = lf;
+            for (auto fn = g.face_nodepos[f]; fn < g.face_nodepos[f + 1]; ++fn) {
+                const int n = g.face_nodes[fn];
+                if (g2l.node[n] < 0) {
+                    g2l.node[n] = 0;
+                    local.global_node.push_back(n);
+                }
+            }
+            num_face_nodes += g.face_nodepos[f + 1] - g.face_nodepos[f];
+        }
+        std::sort(local.global_node.begin(), local.global_node.end());
+        const int lnn = local.global_node.size();
+        for (int ln = 0; ln < lnn; ++ln) {
+            g2l.node[local.global_node[ln]] = ln;
+        }
+
+        UnstructuredGrid* lg = allocate_grid(dims, lnc, lnf, num_face_nodes, num_cell_faces, lnn);
+        if (lg == nullptr) {
+            OPM_THROW(std::runtime_error, "Unable to allocate local grid");
+        }
+        local.grid.reset(lg);
+
+        std::copy(g.cartdims, g.cartdims + 3, lg->cartdims);
+
+        for (int ln = 0; ln < lnn; ++ln) {
+            const int n = local.global_node[ln];
+            std::copy_n(g.node_coordinates + dims*n, dims, lg->node_coordinates + dims*ln);
+        }
+
+        lg->face_nodepos[0] = 0;
+        for (int lf = 0; lf < lnf; ++lf) {
+            const int f = local.global_face[lf];
+            auto pos = lg->face_nodepos[lf];
+            for (auto fn = g.face_nodepos[f]; fn < g.face_nodepos[f + 1]; ++fn, ++pos) {
+                lg->face_nodes[pos] = g2l.node[g.face_nodes[fn]];
+            }
+            lg->face_nodepos[lf + 1] = pos;
+
+            for (int side = 0; side < 2; ++side) {
+                const int c = g.face_cells[2*f + side];
+                lg->face_cells[2*lf + side] = (c >= 0) ? g2l.cell[c] : -1;
+            }
+            std::copy_n(g.face_centroids + dims*f, dims, lg->face_centroids + dims*lf);
+            std::copy_n(g.face_normals + dims*f, dims, lg->face_normals + dims*lf);
+            lg->face_areas[lf] = g.face_areas[f];
+        }
+
+        if (g.cell_facetag == nullptr) {
+            std::free(lg->cell_facetag);
+            lg->cell_facetag = nullptr;
+        }
+        lg->global_cell = allocateCopy<int>(nullptr, lnc);
+        lg->cell_facepos[0] = 0;
+        for (int lc = 0; lc < lnc; ++lc) {
+            const int c = local.global_cell[lc];
+            auto pos = lg->cell_facepos[lc];
+            for (auto hf = g.cell_facepos[c]; hf < g.cell_facepos[c + 1]; ++hf, ++pos) {
+                lg->cell_faces[pos] = g2l.face[g.cell_faces[hf]];
+                if (lg->cell_facetag) {
+                    lg->cell_facetag[pos] = g.cell_facetag[hf];
+                }
+            }
+            lg->cell_facepos[lc + 1] = pos;
+
+            std::copy_n(g.cell_centroids + dims*c, dims, lg->cell_centroids + dims*lc);
+            lg->cell_volumes[lc] = g.cell_volumes[c];
+            lg->global_cell[lc] = g.global_cell ? g.global_cell[c] : c;
+        }
+
+        // Partition types and shared cells.
+        local.cell_partition_type.resize(lnc, Dune::OverlapEntity);
+        std::fill_n(local.cell_partition_type.begin(), num_interior, Dune::InteriorEntity);
+
+        std::map<int, std::vector<std::pair<int, SharedUnstructuredEntity>>> shared_cells;
+        for (int lc = 0; lc < lnc; ++lc) {
+            const int c = local.global_cell[lc];
+            for (int other : present[c]) {
+                if (other != rank) {
+                    const auto other_type = (cell_part[c] == other) ? Dune::InteriorEntity
+                                                                    : Dune::OverlapEntity;
+                    shared_cells[other].push_back({c, {lc, local.cell_partition_type[lc], other_type}});
+                }
+            }
+        }
+
+        local.face_partition_type.resize(lnf);
+        std::vector<int> adjacent_cells;
+        for (int lf = 0; lf < lnf; ++lf) {
+            const int f = local.global_face[lf];
+            adjacent_cells.clear();
+            for (int side = 0; side < 2; ++side) {
+                const int c = g.face_cells[2*f + side];
+                if (c >= 0) {
+                    adjacent_cells.push_back(c);
+                }
+            }
+            local.face_partition_type[lf] = subEntityPartitionType(adjacent_cells, cell_part, present, rank);
+        }
+
+        local.node_partition_type.resize(lnn);
+        std::vector<int> node_present;
+        for (int ln = 0; ln < lnn; ++ln) {
+            const int n = local.global_node[ln];
+            adjacent_cells.assign(layout.node_cells.begin() + layout.node_cellpos[n],
+                                  layout.node_cells.begin() + layout.node_cellpos[n + 1]);
+            node_present.clear();
+            for (int c : adjacent_cells) {
+                mergeInto(node_present, present[c]);
+            }
+            local.node_partition_type[ln] = subEntityPartitionType(adjacent_cells, cell_part, present, rank);
+            for (int other : node_present) {
+                if (other != rank) {
+                    // Local nodes are in global order, so appending keeps the
+                    // lists ordered by global index.
+                    local.shared_nodes[other].push_back({ln, local.node_partition_type[ln],
+                                                         subEntityPartitionType(adjacent_cells, cell_part, present, other)});
+                }
+            }
+        }
+
+        for (auto& [other, list] : shared_cells) {
+            std::sort(list.begin(), list.end(),
+                      [](const auto& a, const auto& b) { return a.first < b.first; });
+            auto& out = local.shared_cells[other];
+            out.reserve(list.size());
+            for (const auto& entry : list) {
+                out.push_back(entry.second);
+            }
+        }
+
+        // Leave the maps clean for the next part.
+        for (int c : local.global_cell) {
+            g2l.cell[c] = -1;
+        }
+        for (int f : local.global_face) {
+            g2l.face[f] = -1;
+        }
+        for (int n : local.global_node) {
+            g2l.node[n] = -1;
+        }
+
+        return local;
+    }
+
+#if HAVE_MPI
+    /// Sequential writer of trivially copyable values into a byte buffer.
+    class PackBuffer
+    {
+    public:
+        template<class T>
+        void write(const T* values, std::size_t n)
+        {
+            const auto* bytes = reinterpret_cast<const char*>(values);
+            data_.insert(data_.end(), bytes, bytes + n * sizeof(T));
+        }
+
+        template<class T>
+        void write(const T& value)
+        {
+            write(&value, 1);
+        }
+
+        template<class T>
+        void write(const std::vector<T>& values)
+        {
+            write(values.size());
+            write(values.data(), values.size());
+        }
+
+        std::vector<char>& data()
+        {
+            return data_;
+        }
+
+    private:
+        std::vector<char> data_;
+    };
+
+    /// Reads back what PackBuffer wrote, in the same order.
+    class UnpackBuffer
+    {
+    public:
+        explicit UnpackBuffer(const std::vector<char>& data)
+            : data_(data)
+        {}
+
+        template<class T>
+        void read(T* values, std::size_t n)
+        {
+            if (pos_ + n * sizeof(T) > data_.size()) {
+                OPM_THROW(std::runtime_error, "Truncated local grid received");
+            }
+            std::memcpy(values, data_.data() + pos_, n * sizeof(T));
+            pos_ += n * sizeof(T);
+        }
+
+        template<class T>
+        T read()
+        {
+            T value;
+            read(&value, 1);
+            return value;
+        }
+
+        template<class T>
+        void read(std::vector<T>& values)
+        {
+            values.resize(read<std::size_t>());
+            read(values.data(), values.size());
+        }
+
+    private:
+        const std::vector<char>& data_;
+        std::size_t pos_ = 0;
+    };
+
+    void packShared(PackBuffer& buffer,
+                    const std::map<int, std::vector<SharedUnstructuredEntity>>& shared)
+    {
+        buffer.write(shared.size());
+        for (const auto& [other, entities] : shared) {
+            buffer.write(other);
+            buffer.write(entities);
+        }
+    }
+
+    void unpackShared(UnpackBuffer& buffer,
+                      std::map<int, std::vector<SharedUnstructuredEntity>>& shared)
+    {
+        const auto size = buffer.read<std::size_t>();
+        for (std::size_t i = 0; i < size; ++i) {
+            const int other = buffer.read<int>();
+            buffer.read(shared[other]);
+        }
+    }
+
+    std::vector<char> packLocalGrid(const LocalUnstructuredGrid& local)
+    {
+        const UnstructuredGrid& g = *local.grid;
+        const std::size_t nc = g.number_of_cells;
+        const std::size_t nf = g.number_of_faces;
+        const std::size_t nn = g.number_of_nodes;
+        const std::size_t dims = g.dimensions;
+        const std::size_t num_face_nodes = g.face_nodepos[nf];
+        const std::size_t num_cell_faces = g.cell_facepos[nc];
+
+        PackBuffer buffer;
+        buffer.write(dims);
+        buffer.write(nc);
+        buffer.write(nf);
+        buffer.write(nn);
+        buffer.write(num_face_nodes);
+        buffer.write(num_cell_faces);
+        buffer.write(g.cartdims, 3);
+        buffer.write(g.node_coordinates, dims*nn);
+        buffer.write(g.face_nodepos, nf + 1);
+        buffer.write(g.face_nodes, num_face_nodes);
+        buffer.write(g.face_cells, 2*nf);
+        buffer.write(g.face_centroids, dims*nf);
+        buffer.write(g.face_normals, dims*nf);
+        buffer.write(g.face_areas, nf);
+        buffer.write(g.cell_facepos, nc + 1);
+        buffer.write(g.cell_faces, num_cell_faces);
+        buffer.write(g.cell_facetag != nullptr);
+        if (g.cell_facetag) {
+            buffer.write(g.cell_facetag, num_cell_faces);
+        }
+        buffer.write(g.cell_centroids, dims*nc);
+        buffer.write(g.cell_volumes, nc);
+        buffer.write(g.global_cell, nc);
+
+        buffer.write(local.global_sizes);
+        buffer.write(local.global_cell);
+        buffer.write(local.global_face);
+        buffer.write(local.global_node);
+        buffer.write(local.cell_partition_type);
+        buffer.write(local.face_partition_type);
+        buffer.write(local.node_partition_type);
+        packShared(buffer, local.shared_cells);
+        packShared(buffer, local.shared_nodes);
+        return std::move(buffer.data());
+    }
+
+    LocalUnstructuredGrid unpackLocalGrid(const std::vector<char>& data)
+    {
+        UnpackBuffer buffer(data);
+        const auto dims = buffer.read<std::size_t>();
+        const auto nc = buffer.read<std::size_t>();
+        const auto nf = buffer.read<std::size_t>();
+        const auto nn = buffer.read<std::size_t>();
+        const auto num_face_nodes = buffer.read<std::size_t>();
+        const auto num_cell_faces = buffer.read<std::size_t>();
+
+        LocalUnstructuredGrid local;
+        UnstructuredGrid* g = allocate_grid(dims, nc, nf, num_face_nodes, num_cell_faces, nn);
+        if (g == nullptr) {
+            OPM_THROW(std::runtime_error, "Unable to allocate local grid");
+        }
+        local.grid.reset(g);
+        buffer.read(g->cartdims, 3);
+        buffer.read(g->node_coordinates, dims*nn);
+        buffer.read(g->face_nodepos, nf + 1);
+        buffer.read(g->face_nodes, num_face_nodes);
+        buffer.read(g->face_cells, 2*nf);
+        buffer.read(g->face_centroids, dims*nf);
+        buffer.read(g->face_normals, dims*nf);
+        buffer.read(g->face_areas, nf);
+        buffer.read(g->cell_facepos, nc + 1);
+        buffer.read(g->cell_faces, num_cell_faces);
+        if (buffer.read<bool>()) {
+            buffer.read(g->cell_facetag, num_cell_faces);
+        } else {
+            std::free(g->cell_facetag);
+            g->cell_facetag = nullptr;
+        }
+        buffer.read(g->cell_centroids, dims*nc);
+        buffer.read(g->cell_volumes, nc);
+        g->global_cell = allocateCopy<int>(nullptr, nc);
+        buffer.read(g->global_cell, nc);
+
+        local.global_sizes = buffer.read<std::array<int, 3>>();
+        buffer.read(local.global_cell);
+        buffer.read(local.global_face);
+        buffer.read(local.global_node);
+        buffer.read(local.cell_partition_type);
+        buffer.read(local.face_partition_type);
+        buffer.read(local.node_partition_type);
+        unpackShared(buffer, local.shared_cells);
+        unpackShared(buffer, local.shared_nodes);
+        return local;
+    }
+
+    // Messages are split such that each count fits into an int.
+    constexpr std::size_t maxMessageSize = std::numeric_limits<int>::max();
+
+    void sendBytes(const std::vector<char>& data, int dest, int tag, MPI_Comm comm)
+    {
+        unsigned long long size = data.size();
+        MPI_Send(&size, 1, MPI_UNSIGNED_LONG_LONG, dest, tag, comm);
+        for (std::size_t pos = 0; pos < data.size(); pos += maxMessageSize) {
+            const int count = std::min(maxMessageSize, data.size() - pos);
+            MPI_Send(data.data() + pos, count, MPI_BYTE, dest, tag, comm);
+        }
+    }
+
+    std::vector<char> receiveBytes(int source, int tag, MPI_Comm comm)
+    {
+        unsigned long long size = 0;
+        MPI_Recv(&size, 1, MPI_UNSIGNED_LONG_LONG, source, tag, comm, MPI_STATUS_IGNORE);
+        std::vector<char> data(size);
+        for (std::size_t pos = 0; pos < data.size(); pos += maxMessageSize) {
+            const int count = std::min(maxMessageSize, data.size() - pos);
+            MPI_Recv(data.data() + pos, count, MPI_BYTE, source, tag, comm, MPI_STATUS_IGNORE);
+        }
+        return data;
+    }
+#endif // HAVE_MPI
+
+} // anonymous namespace
+
+void LocalUnstructuredGrid::Deleter::operator()(UnstructuredGrid* g) const
+{
+    destroy_grid(g);
+}
+
+std::vector<int> partitionUnstructuredGrid(const UnstructuredGrid& grid,
+                                           int num_parts,
+                                           Dune::PartitionMethod method,
+                                           [[maybe_unused]] double imbalance_tol)
+{
+    if (num_parts < 1) {
+        OPM_THROW(std::invalid_argument,
+                  "Number of parts must be positive, got " + std::to_string(num_parts));
+    }
+
+    const int nc = grid.number_of_cells;
+    if (num_parts == 1 || nc == 0) {
+        return std::vector<int>(nc, 0);
+    }
+
+    switch (method) {
+    case Dune::PartitionMethod::simple:
+        return contiguousPartition(nc, num_parts);
+    case Dune::PartitionMethod::zoltan:
+    case Dune::PartitionMethod::zoltanGoG:
+#if HAVE_MPI && HAVE_ZOLTAN
+    {
+        const auto [xadj, adjncy] = dualGraph(grid);
+        return Dune::cpgrid::zoltanPartitionGraph(xadj, adjncy, num_parts, imbalance_tol);
+    }
+#else
+        OPM_THROW(std::runtime_error, "Partitioning with Zoltan requires MPI and Zoltan");
+#endif
+    case Dune::PartitionMethod::metis:
+#if defined(HAVE_METIS) && HAVE_MPI
+    {
+        const auto [xadj, adjncy] = dualGraph(grid);
+        return Dune::cpgrid::metisPartitionGraph({ xadj.begin(), xadj.end() },
+                                                 { adjncy.begin(), adjncy.end() },
+                                                 num_parts, imbalance_tol);
+    }
+#else
+        OPM_THROW(std::runtime_error, "Partitioning with METIS requires MPI and METIS");
+#endif
+    }
+    OPM_THROW(std::invalid_argument, "Unknown partition method " + std::to_string(method));
+}
+
+std::vector<int> partitionUnstructuredGrid(const UnstructuredGrid& grid, int num_parts)
+{
+#if HAVE_MPI && HAVE_ZOLTAN
+    constexpr auto method = Dune::PartitionMethod::zoltan;
+#elif defined(HAVE_METIS) && HAVE_MPI
+    constexpr auto method = Dune::PartitionMethod::metis;
+#else
+    constexpr auto method = Dune::PartitionMethod::simple;
+#endif
+    return partitionUnstructuredGrid(grid, num_parts, method, 1.1);
+}
+
+LocalUnstructuredGrid
+extractLocalUnstructuredGrid(const UnstructuredGrid& grid,
+                             const std::vector<int>& cell_part,
+                             int rank,
+                             int overlap_layers)
+{
+    if (rank < 0) {
+        OPM_THROW(std::invalid_argument, "Rank must not be negative, got " + std::to_string(rank));
+    }
+    int num_parts = rank + 1;
+    if (!cell_part.empty()) {
+        num_parts = std::max(num_parts, *std::max_element(cell_part.begin(), cell_part.end()) + 1);
+    }
+    const auto layout = computePartLayout(grid, cell_part, num_parts, overlap_layers);
+    GlobalToLocal g2l(grid);
+    return extractPart(grid, cell_part, layout, rank, g2l);
+}
+
+#if HAVE_MPI
+LocalUnstructuredGrid
+distributeUnstructuredGrid(const UnstructuredGrid* grid,
+                           int overlap_layers,
+                           MPI_Comm comm,
+                           int root)
+{
+    int rank = 0;
+    int size = 1;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+    constexpr int tag = 7113;
+
+    // The root partitions the grid before anything is sent and tells the
+    // others whether that worked, such that they never wait for a grid
+    // that will not come.
+    std::vector<int> cell_part;
+    PartLayout layout;
+    std::exception_ptr error;
+    int ok = 1;
+    if (rank == root) {
+        try {
+            if (grid == nullptr) {
+                OPM_THROW(std::invalid_argument, "The root process must provide the grid to distribute");
+            }
+            cell_part = partitionUnstructuredGrid(*grid, size);
+            layout = computePartLayout(*grid, cell_part, size, overlap_layers);
+        }
+        catch (...) {
+            error = std::current_exception();
+            ok = 0;
+        }
+    }
+    MPI_Bcast(&ok, 1, MPI_INT, root, comm);
+    if (!ok) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        OPM_THROW(std::runtime_error, "Partitioning the grid failed on the root process");
+    }
+
+    if (rank != root) {
+        return unpackLocalGrid(receiveBytes(root, tag, comm));
+    }
+
+    // One rank at a time, such that at most one extra local grid is held.
+    GlobalToLocal g2l(*grid);
+    for (int other = 0; other < size; ++other) {
+        if (other != root) {
+            sendBytes(packLocalGrid(extractPart(*grid, cell_part, layout, other, g2l)),
+                      other, tag, comm);
+        }
+    }
+    return extractPart(*grid, cell_part, layout, root, g2l);
+}
+#endif // HAVE_MPI
+
+} // namespace Opm
@@ -0,0 +1,156 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef OPM_UNSTRUCTUREDGRIDPARTITIONING_HEADER
+#define OPM_UNSTRUCTUREDGRIDPARTITIONING_HEADER
+
+#include <dune/grid/common/gridenums.hh>
+
+#include <opm/grid/common/GridEnums.hpp>
+
+#if HAVE_MPI
+#include <mpi.h>
+#endif
+
+#include <array>
+#include <map>
+#include <memory>
+#include <vector>
+
+struct UnstructuredGrid;
+
+namespace Opm
+{
+
+    /// Partition the cells of an UnstructuredGrid into \p num_parts parts.
+    ///
+    /// The dual graph is taken from the face_cells table and handed to
+    /// Dune::cpgrid::zoltanPartitionGraph() or
+    /// Dune::cpgrid::metisPartitionGraph(). The simple method splits the
+    /// cells into contiguous ranges of (almost) equal size. The partitioning
+    /// is done on the calling process only.
+    ///
+    /// \param[in] grid           The global grid.
+    /// \param[in] num_parts      Number of parts, must be positive.
+    /// \param[in] method         The partitioner, an exception is thrown if
+    ///                           it is not available.
+    /// \param[in] imbalance_tol  Imbalance tolerance of Zoltan or METIS.
+    /// \return The part number of each cell.
+    std::vector<int> partitionUnstructuredGrid(const UnstructuredGrid& grid,
+                                               int num_parts,
+                                               Dune::PartitionMethod method,
+                                               double imbalance_tol);
+
+    /// Partition the cells of an UnstructuredGrid into \p num_parts parts
+    /// with Zoltan if available, else METIS if available, else the simple
+    /// method.
+    std::vector<int> partitionUnstructuredGrid(const UnstructuredGrid& grid,
+                                               int num_parts);
+
+    /// An entity that is also present on another process.
+    struct SharedUnstructuredEntity
+    {
+        /// Index of the entity on this process.
+        int local;
+        /// Partition type of the entity on this process.
+        Dune::PartitionType mine;
+        /// Partition type of the entity on the other process.
+        Dune::PartitionType other;
+    };
+
+    /// The part of a partitioned UnstructuredGrid that lives on one process.
+    struct LocalUnstructuredGrid
+    {
+        struct Deleter
+        {
+            void operator()(UnstructuredGrid* g) const;
+        };
+
+        /// The local grid. Interior cells are numbered before overlap cells,
+        /// faces and nodes keep the relative order of the global grid.
+        /// Faces between a local and a non-local cell have -1 for the
+        /// missing neighbour.
+        std::unique_ptr<UnstructuredGrid, Deleter> grid;
+
+        /// Number of cells, faces and nodes of the global grid.
+        std::array<int, 3> global_sizes = { 0, 0, 0 };
+
+        /// Global index of each local cell, face and node.
+        std::vector<int> global_cell;
+        std::vector<int> global_face;
+        std::vector<int> global_node;
+
+        /// Partition type of each local cell, face and node. Cells are
+        /// interior or overlap, faces and nodes are interior, border
+        /// (adjacent to both interior and non-interior cells), front
+        /// (adjacent to overlap cells and cells not present locally) or
+        /// overlap.
+        std::vector<Dune::PartitionType> cell_partition_type;
+        std::vector<Dune::PartitionType> face_partition_type;
+        std::vector<Dune::PartitionType> node_partition_type;
+
+        /// For each other rank, the cells and nodes shared with it, ordered
+        /// by their global index such that both sides agree on the order.
+        std::map<int, std::vector<SharedUnstructuredEntity>> shared_cells;
+        std::map<int, std::vector<SharedUnstructuredEntity>> shared_nodes;
+    };
+
+    /// Extract the part of a partitioned grid that belongs to a rank.
+    ///
+    /// Every process is expected to hold the same global grid and cell
+    /// partition, which makes the extraction and the computation of the
+    /// shared entities purely local. The overlap and node adjacency of the
+    /// whole grid are computed for each call, distributeUnstructuredGrid()
+    /// computes them once for all ranks.
+    ///
+    /// \param[in] grid            The global grid.
+    /// \param[in] cell_part       The part number of each global cell.
+    /// \param[in] rank            The part to extract.
+    /// \param[in] overlap_layers  Number of cell layers added around the
+    ///                            interior cells.
+    /// \return The local grid together with its parallel index information.
+    LocalUnstructuredGrid
+    extractLocalUnstructuredGrid(const UnstructuredGrid& grid,
+                                 const std::vector<int>& cell_part,
+                                 int rank,
+                                 int overlap_layers);
+
+#if HAVE_MPI
+    /// Distribute a grid that is only needed on the root process.
+    ///
+    /// The root partitions the grid with partitionUnstructuredGrid(),
+    /// extracts the local grid of each process and sends it, one process
+    /// at a time. The other processes only ever hold their own part.
+    /// The call is collective. If the root fails to partition the grid,
+    /// or has none, all processes throw.
+    ///
+    /// \param[in] grid            The global grid, only used on \p root.
+    /// \param[in] overlap_layers  Number of overlap cell layers.
+    /// \param[in] comm            Communicator of the processes sharing the grid.
+    /// \param[in] root            Rank of the process holding the grid.
+    /// \return The local grid of this process.
+    LocalUnstructuredGrid
+    distributeUnstructuredGrid(const UnstructuredGrid* grid,
+                               int overlap_layers,
+                               MPI_Comm comm,
+                               int root = 0);
+#endif
+
+} // namespace Opm
+
+#endif // OPM_UNSTRUCTUREDGRIDPARTITIONING_HEADER
@@ -30,8 +30,9 @@
 #include <dune/common/parallel/mpitraits.hh>
 #include <dune/istl/owneroverlapcopy.hh>
 
+#include <algorithm>
 #include <map>
-#include <forward_list>
+#include <numeric>
 
 namespace
 {
@@ -111,12 +112,13 @@ void WellConnections::init([[maybe_unused]] const std::vector<OpmWellType>& well
                            [[maybe_unused]] const std::vector<int>& cartesian_to_compressed)
 {
 #if HAVE_ECL_INPUT
-    well_indices_.resize(wells.size());
+    well_start_.assign(1, 0);
+    well_start_.reserve(wells.size() + 1);
+    well_cells_.clear();
 
     // We assume that we know all the wells.
-    int index=0;
     for (const auto& well : wells) {
-        std::set<int>& well_indices = well_indices_[index];
+        const auto first = well_cells_.size();
         const auto& connectionSet = well.getConnections( );
         for (size_t c=0; c<connectionSet.size(); c++) {
             const auto& connection = connectionSet.get(c);
@@ -127,7 +129,7 @@ void WellConnections::init([[maybe_unused]] const std::vector<OpmWellType>& well
             int compressed_idx = cartesian_to_compressed[cart_grid_idx];
             if ( compressed_idx >= 0 ) // Ignore connections in inactive cells.
             {
-                well_indices.insert(compressed_idx);
+                well_cells_.push_back(compressed_idx);
             }
         }
         const auto possibleFutureConnectionSetIt = possibleFutureConnections.find(well.name());
@@ -136,11 +138,15 @@ void WellConnections::init([[maybe_unused]] const std::vector<OpmWellType>& well
                 int compressed_idx = cartesian_to_compressed[cart_grid_idx];
                 if ( compressed_idx >= 0 ) // Ignore connections in inactive cells.
                 {
-                    well_indices.insert(compressed_idx);
+                    well_cells_.push_back(compressed_idx);
                 }
             }
         }
-        ++index;
+        // Sort and remove cells connected more than once.
+        const auto begin = well_cells_.begin() + first;
+        std::sort(begin, well_cells_.end());
+        well_cells_.erase(std::unique(begin, well_cells_.end()), well_cells_.end());
+        well_start_.push_back(well_cells_.size());
     }
 #endif
 }
@@ -168,18 +174,14 @@ perforatingWellIndicesOnProc(const std::vector<int>& parts,
             well_indices.reserve(wells.size());
         }
 
+        // Last well added to each process.
+        std::vector<int> lastWell(numProcs, -1);
         for (std::size_t wellIndex = 0; wellIndex < wells.size(); ++wellIndex) {
-            const auto &connections = wellConnections[wellIndex];
-            std::map<int, std::size_t> connectionsOnProc;
-            for (const auto& connection_index : connections) {
-                ++connectionsOnProc[parts[connection_index]];
-            }
-
-            for (const auto& entry: connectionsOnProc)
-            {
-                if (entry.second > 0) // Should be unnecessary
-                {
-                    wellIndices[entry.first].push_back(wellIndex);
+            for (const auto& connection_index : wellConnections[wellIndex]) {
+                const int proc = parts[connection_index];
+                if (lastWell[proc] != static_cast<int>(wellIndex)) {
+                    lastWell[proc] = wellIndex;
+                    wellIndices[proc].push_back(wellIndex);
                 }
             }
         }
@@ -191,7 +193,6 @@ postProcessPartitioningForWells(std::vector<int>& parts,
                                 [[maybe_unused]] std::function<int(int)> gid,
                                 [[maybe_unused]] const std::vector<OpmWellType>& wells,
                                 [[maybe_unused]] const WellConnections& well_connections,
-                                [[maybe_unused]] const std::vector<std::set<int> >& wellGraph,
                                 [[maybe_unused]] std::vector<std::tuple<int,int,char>>& exportList,
                                 [[maybe_unused]] std::vector<std::tuple<int,int,char,int>>& importList,
                                 const Communication<MPI_Comm>& cc)
@@ -211,12 +212,67 @@ postProcessPartitioningForWells(std::vector<int>& parts,
     using AttributeSet = CpGridData::AttributeSet;
 
     if (noCells && well_connections.size()) {
-        std::vector<std::unordered_set<int>> old_owners(wells.size());
+        const std::size_t num_wells = wells.size();
 
-        for (std::size_t well_index = 0; well_index < wells.size(); ++well_index) {
+        // The owner of all cells of each well before moving, or -1 if
+        // they are on several processes.
+        std::vector<int> old_owner(num_wells, -1);
+        for (std::size_t well_index = 0; well_index < num_wells; ++well_index) {
             const auto& connections = well_connections[well_index];
+            if (connections.empty()) {
+                continue;
+            }
+            int owner = parts[connections[0]];
             for (const auto& cell : connections) {
-                old_owners[well_index].insert(parts[cell]);
+                if (parts[cell] != owner) {
+                    owner = -1;
+                    break;
+                }
+            }
+            old_owner[well_index] = owner;
+        }
+
+        // Note that a cell might be perforated by multiple wells. In that
+        // case all wells need to end up on the same process. Group the
+        // wells into sets of wells that share cells, directly or via other
+        // wells, with union-find. Each set is represented by its lowest
+        // well index.
+        std::vector<int> well_set(num_wells);
+        std::iota(well_set.begin(), well_set.end(), 0);
+        auto findSet = [&well_set](int well) {
+            while (well_set[well] != well) {
+                well_set[well] = well_set[well_set[well]];
+                well = well_set[well];
+            }
+            return well;
+        };
+        {
+            std::vector<int> cell_well(noCells, -1);
+            for (std::size_t well_index = 0; well_index < num_wells; ++well_index) {
+                for (const auto& cell : well_connections[well_index]) {
+                    if (cell_well[cell] < 0) {
+                        cell_well[cell] = well_index;
+                        continue;
+                    }
+                    const int set1 = findSet(well_index);
+                    const int set2 = findSet(cell_well[cell]);
+                    if (set1 != set2) {
+                        well_set[std::max(set1, set2)] = std::min(set1, set2);
+                    }
+                }
+            }
+        }
+        // The wells of each set, in compressed row storage.
+        std::vector<int> set_start(num_wells + 1, 0);
+        for (std::size_t well_index = 0; well_index < num_wells; ++well_index) {
+            ++set_start[findSet(well_index) + 1];
+        }
+        std::partial_sum(set_start.begin(), set_start.end(), set_start.begin());
+        std::vector<int> set_wells(num_wells);
+        {
+            std::vector<int> pos(set_start.begin(), set_start.end() - 1);
+            for (std::size_t well_index = 0; well_index < num_wells; ++well_index) {
+                set_wells[pos[findSet(well_index)]++] = well_index;
             }
         }
 
@@ -228,68 +284,57 @@ postProcessPartitioningForWells(std::vector<int>& parts,
         // Check that all connections of a well have ended up on one process.
         // If that is not the case for well then move them manually to the
         // process that already has the most connections on it.
-        for (std::size_t well_index = 0; well_index < wells.size(); ++well_index) {
+        std::vector<std::size_t> num_connections_on_proc(no_procs, 0);
+        std::vector<int> procs_with_connections;
+        std::vector<int> set_cells;
+        for (std::size_t well_index = 0; well_index < num_wells; ++well_index) {
             const auto& connections = well_connections[well_index];
-            if (connections.size() <= 1 || visited[*connections.begin()]) {
+            if (connections.size() <= 1 || visited[connections[0]]) {
                 // Well does not connect cells or was visited before,
                 // nothing to move or worry about.
                 continue;
             }
 
-            // Note that a cell might be perforated by multiple wells. In that
-            // case all wells need to end up on the same process.
-            // We need to process not just the perforated cells of this well,
-            // but any perforated well reachable by a path via wells from the
-            // cells of this well. Classic breadth first search.
-            std::forward_list<int> visited_cells;
-            std::map<int, std::size_t> num_connections_on_proc;
-            auto visitor = [&num_connections_on_proc, &parts](int cell) { ++num_connections_on_proc[parts[cell]]; };
-            visited_cells.push_front(*connections.begin());
-
-            auto current = visited_cells.begin();
-            auto last = current;
-            auto end = visited_cells.end();
-            int last_size = 1;
-            int idx = 0;
-
-            visitor(*current);
-            visited[*current] = true;
-
-            while (current != end) {
-                int new_size = last_size;
-                for (; idx < last_size; ++current, ++idx) {
-                    for (auto neighbor : wellGraph[*current]) {
-                        if (!visited[neighbor]) {
-                            ++new_size;
-                            last = visited_cells.insert_after(last, neighbor);
-                            visitor(neighbor);
-                            visited[neighbor] = true;
+            // Collect the cells of all wells in the set of this well.
+            const int set = findSet(well_index);
+            set_cells.clear();
+            procs_with_connections.clear();
+            for (int i = set_start[set]; i < set_start[set + 1]; ++i) {
+                for (const auto& cell : well_connections[set_wells[i]]) {
+                    if (!visited[cell]) {
+                        visited[cell] = true;
+                        set_cells.push_back(cell);
+                        if (num_connections_on_proc[parts[cell]]++ == 0) {
+                            procs_with_connections.push_back(parts[cell]);
                         }
                     }
                 }
-                last_size = new_size;
             }
-            assert(!num_connections_on_proc.empty());
-
-            if (num_connections_on_proc.size() > 1) {
-                // partition with the most connections on it becomes new owner
-                int new_owner = std::max_element(num_connections_on_proc.begin(),
-                                                 num_connections_on_proc.end(),
-                                                 [](const auto& p1, const auto& p2)
-                                                 { return (p1.second < p2.second); })
-                                    ->first;
+            assert(!procs_with_connections.empty());
+
+            if (procs_with_connections.size() > 1) {
+                // partition with the most connections on it becomes new
+                // owner, the lowest rank among those with equally many.
+                int new_owner = procs_with_connections[0];
+                for (const int proc : procs_with_connections) {
+                    if (num_connections_on_proc[proc] > num_connections_on_proc[new_owner]
+                        || (num_connections_on_proc[proc] == num_connections_on_proc[new_owner]
+                            && proc < new_owner)) {
+                        new_owner = proc;
+                    }
+                }
 
                 // all cells moving to new_owner. Might already contain cells from
                 // previous wells.
                 auto &add = addCells[new_owner];
                 auto addOldSize = add.size(); // remember beginning of this well
 
-                for (auto connection_cell : visited_cells) {
+                for (auto connection_cell : set_cells) {
                     const auto &global = gid(connection_cell);
-                    auto old_owner = parts[connection_cell];
-                    if (old_owner != new_owner) // only parts might be moved
+                    auto old_owner_cell = parts[connection_cell];
+                    if (old_owner_cell != new_owner) // only parts might be moved
                     {
-                        removeCells[old_owner].push_back(global);
+                        removeCells[old_owner_cell].push_back(global);
                         add.push_back(global);
                         parts[connection_cell] = new_owner;
                     }
@@ -305,6 +350,9 @@ postProcessPartitioningForWells(std::vector<int>& parts,
                     std::get<1>(*exportCandidate) = new_owner;
                 }
             }
+            for (const int proc : procs_with_connections) {
+                num_connections_on_proc[proc] = 0;
+            }
         }
         auto sorter = [](std::pair<const int, std::vector<int>> &pair) {
                           auto &vec = pair.second;
@@ -313,14 +361,6 @@ postProcessPartitioningForWells(std::vector<int>& parts,
         std::for_each(addCells.begin(), addCells.end(), sorter);
         std::for_each(removeCells.begin(), removeCells.end(), sorter);
 
-        // prevent memory allocation
-        for (auto& well_indices : well_indices_on_proc) {
-            well_indices.reserve(wells.size());
-        }
-
-        // Check that all connections of a well have ended up on one process.
-        // If that is not the case for well then move them manually to the
-        // process that already has the most connections on it.
         std::size_t well_index = 0;
 
         for (const auto& well : wells) {
@@ -330,10 +370,9 @@ postProcessPartitioningForWells(std::vector<int>& parts,
                 ++well_index;
                 continue;
             } else {
-                int new_owner = parts[*connections.begin()];
+                int new_owner = parts[connections[0]];
                 well_indices_on_proc[new_owner].push_back(well_index);
-                const auto& old_owners_well = old_owners[well_index];
-                if (old_owners_well.size() > 1 || old_owners_well.find(new_owner) == old_owners_well.end()) {
+                if (old_owner[well_index] != new_owner) {
                     ::Opm::OpmLog::info("Manually moved well " + well.name() + " to partition "
                                         + std::to_string( new_owner ));
                 }
@@ -20,6 +20,8 @@
 #ifndef DUNE_CPGRID_WELL_CONNECTIONS_HEADER_INCLUDED
 #define DUNE_CPGRID_WELL_CONNECTIONS_HEADER_INCLUDED
 
+#include <cstddef>
+#include <iterator>
 #include <set>
 #include <unordered_set>
 #include <vector>
@@ -34,6 +36,7 @@
 #include <dune/common/parallel/communication.hh>
 
 #include <opm/grid/CpGrid.hpp>
+#include <opm/grid/utility/IteratorRange.hpp>
 #include <opm/grid/utility/OpmWellType.hpp>
 
 namespace Dune
@@ -46,13 +49,61 @@ namespace cpgrid
 /// Wells are identified by their position as exported by the wells method
 /// of the eclipse parser.
 /// For each well the container stores at the well index all indices of cells
-/// that the well perforates.
+/// that the well perforates, in ascending order and without duplicates.
+/// The cells of all wells are stored in one array (compressed row storage).
 class WellConnections
 {
 
 public:
-    /// \brief The const iterator type.
-    typedef std::vector<std::set<int> >::const_iterator const_iterator;
+    /// \brief The cells of one well.
+    using Cells = Opm::iterator_range_pod<int>;
+
+    /// \brief Iterator over the cells of all wells (always const).
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Cells;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = Cells;
+
+        const_iterator(const WellConnections* connections, std::size_t well)
+            : connections_(connections), well_(well)
+        {}
+
+        Cells operator*() const
+        {
+            return (*connections_)[well_];
+        }
+
+        const_iterator& operator++()
+        {
+            ++well_;
+            return *this;
+        }
+
+        const_iterator operator++(int)
+        {
+            const_iterator old = *this;
+            ++well_;
+            return old;
+        }
+
+        bool operator==(const const_iterator& other) const
+        {
+            return well_ == other.well_;
+        }
+
+        bool operator!=(const const_iterator& other) const
+        {
+            return well_ != other.well_;
+        }
+
+    private:
+        const WellConnections* connections_;
+        std::size_t well_;
+    };
 
     /// \brief The iterator type (always const).
     typedef const_iterator iterator;
@@ -100,33 +151,36 @@ public:
     /// \brief Access all connections of a well
     /// \param i The index of the well (position of the well in the
     ///          eclipse schedule.
-    /// \return The set of compressed indices of cells perforated by the well.
-    const std::set<int>& operator[](std::size_t i) const
+    /// \return The ascending compressed indices of cells perforated by the well.
+    Cells operator[](std::size_t i) const
     {
-        return well_indices_[i];
+        return Cells(well_cells_.data() + well_start_[i],
+                     well_cells_.data() + well_start_[i + 1]);
     }
 
     /// \brief Get a begin iterator
     const_iterator begin() const
     {
-        return well_indices_.begin();
+        return const_iterator(this, 0);
     }
 
     /// \brief Get the end iterator
     const_iterator end() const
     {
-        return well_indices_.end();
+        return const_iterator(this, size());
     }
 
     /// \breif Get the number of wells
     std::size_t size() const
     {
-        return well_indices_.size();
+        return well_start_.size() - 1;
     }
 private:
-    /// Stores at index i all cells that are perforated by
-    /// the well at position i of the eclipse schedule.
-    std::vector<std::set<int> > well_indices_;
+    /// The cells perforated by the well at position i of the eclipse
+    /// schedule are well_cells_[well_start_[i]] to
+    /// well_cells_[well_start_[i + 1] - 1].
+    std::vector<int> well_start_ = {0};
+    std::vector<int> well_cells_;
 };
 
 
@@ -154,7 +208,8 @@ perforatingWellIndicesOnProc(const std::vector<int>& parts,
 /// \brief Computes wells assigned to processes.
 ///
 /// Computes for all processes all indices of wells that
-/// will be assigned to this process.
+/// will be assigned to this process. Wells that share cells, directly or
+/// via other wells, have all their cells moved to one process.
 /// \param parts The partition number for each cell
 /// \param gid Functor that turns cell index to global id.
 /// \param eclipseState The eclipse information
@@ -173,7 +228,6 @@ postProcessPartitioningForWells(std::vector<int>& parts,
                                 std::function<int(int)> gid,
                                 const std::vector<OpmWellType>&  wells,
                                 const WellConnections& well_connections,
-                                const std::vector<std::set<int> >& wellGraph,
                                 std::vector<std::tuple<int,int,char>>& exportList,
                                 std::vector<std::tuple<int,int,char,int>>& importList,
                                 const Communication<MPI_Comm>& cc);
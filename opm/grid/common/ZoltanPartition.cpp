@@ -116,7 +116,6 @@ makeImportAndExportLists(const Dune::CpGrid& cpgrid,
                                                 gidGetter,
                                                 *wells,
                                                 gridAndWells->getWellConnections(),
-                                                gridAndWells->getWellsGraph(),
                                                 myExportList, myImportList,
                                                 cc);
 
@@ -289,6 +288,62 @@ void setDefaultZoltanParameters(Zoltan_Struct* zz) {
     Zoltan_Set_Param(zz, "PHG_EDGE_SIZE_THRESHOLD", ".35");  /* 0-remove all, 1-remove none */
 }
 
+/// A graph in CSR format, the vertex number is used as global and local id.
+struct CSRGraph
+{
+    const std::vector<int>& xadj;
+    const std::vector<int>& adjncy;
+};
+
+int getCSRGraphNumVertices(void* graphPointer, int* err)
+{
+    const auto& graph = *static_cast<const CSRGraph*>(graphPointer);
+    *err = ZOLTAN_OK;
+    return graph.xadj.size() - 1;
+}
+
+void getCSRGraphVertexList(void* graphPointer, [[maybe_unused]] int numGlobalIds,
+                           [[maybe_unused]] int numLocalIds, ZOLTAN_ID_PTR gids,
+                           ZOLTAN_ID_PTR lids, [[maybe_unused]] int wgtDim,
+                           [[maybe_unused]] float* objWgts, int* err)
+{
+    const auto& graph = *static_cast<const CSRGraph*>(graphPointer);
+    for (std::size_t v = 0; v + 1 < graph.xadj.size(); ++v) {
+        gids[v] = v;
+        lids[v] = v;
+    }
+    *err = ZOLTAN_OK;
+}
+
+void getCSRGraphNumEdgesList(void* graphPointer, [[maybe_unused]] int sizeGID, [[maybe_unused]] int sizeLID,
+                             int numVertices,
+                             [[maybe_unused]] ZOLTAN_ID_PTR globalID, ZOLTAN_ID_PTR localID,
+                             int* numEdges, int* err)
+{
+    const auto& graph = *static_cast<const CSRGraph*>(graphPointer);
+    for (int i = 0; i < numVertices; ++i) {
+        numEdges[i] = graph.xadj[localID[i] + 1] - graph.xadj[localID[i]];
+    }
+    *err = ZOLTAN_OK;
+}
+
+void getCSRGraphEdgeList(void* graphPointer, [[maybe_unused]] int sizeGID, [[maybe_unused]] int sizeLID,
+                         int numVertices, [[maybe_unused]] ZOLTAN_ID_PTR globalID, ZOLTAN_ID_PTR localID,
+                         [[maybe_unused]] int* numEdges,
+                         ZOLTAN_ID_PTR nborGID, int* nborProc,
+                         [[maybe_unused]] int wgtDim, [[maybe_unused]] float* ewgts, int* err)
+{
+    const auto& graph = *static_cast<const CSRGraph*>(graphPointer);
+    int neighborCounter = 0;
+    for (int i = 0; i < numVertices; ++i) {
+        for (int e = graph.xadj[localID[i]]; e < graph.xadj[localID[i] + 1]; ++e, ++neighborCounter) {
+            nborGID[neighborCounter] = graph.adjncy[e];
+            nborProc[neighborCounter] = 0;
+        }
+    }
+    *err = ZOLTAN_OK;
+}
+
 
 } // anon namespace
 
@@ -629,6 +684,75 @@ zoltanGraphPartitionGridForJac(const CpGrid& cpgrid,
     return partitioner.partitionForInfo();
 }
 
+std::vector<int>
+zoltanPartitionGraph(const std::vector<int>& xadj,
+                     const std::vector<int>& adjncy,
+                     int numParts,
+                     const double zoltanImbalanceTol,
+                     const std::map<std::string,std::string>& params)
+{
+    if (xadj.size() < 2) {
+        return {};
+    }
+    const int n = xadj.size() - 1;
+    std::vector<int> parts(n, 0);
+    if (numParts == 1) {
+        return parts;
+    }
+
+    int argc = 0;
+    char** argv = 0;
+    float ver = 0;
+    int rc = Zoltan_Initialize(argc, argv, &ver);
+    if (rc != ZOLTAN_OK) {
+        OPM_THROW(std::runtime_error, "Could not initialize Zoltan.");
+    }
+    struct Zoltan_Struct* zz = Zoltan_Create(MPI_COMM_SELF);
+    setDefaultZoltanParameters(zz);
+    Zoltan_Set_Param(zz, "IMBALANCE_TOL", std::to_string(zoltanImbalanceTol).c_str());
+    Zoltan_Set_Param(zz, "NUM_GLOBAL_PARTS", std::to_string(numParts).c_str());
+    Zoltan_Set_Param(zz, "RETURN_LISTS", "PARTS");
+    for (const auto& [key, value] : params)
+        Zoltan_Set_Param(zz, key.c_str(), value.c_str());
+
+    CSRGraph graph{xadj, adjncy};
+    Zoltan_Set_Num_Obj_Fn(zz, getCSRGraphNumVertices, &graph);
+    Zoltan_Set_Obj_List_Fn(zz, getCSRGraphVertexList, &graph);
+    Zoltan_Set_Num_Edges_Multi_Fn(zz, getCSRGraphNumEdgesList, &graph);
+    Zoltan_Set_Edge_List_Multi_Fn(zz, getCSRGraphEdgeList, &graph);
+
+    int changes = 0;
+    int numGidEntries = 0;
+    int numLidEntries = 0;
+    int numImport = 0;
+    int numExport = 0;
+    ZOLTAN_ID_PTR importGlobalGids = nullptr;
+    ZOLTAN_ID_PTR importLocalGids = nullptr;
+    ZOLTAN_ID_PTR exportGlobalGids = nullptr;
+    ZOLTAN_ID_PTR exportLocalGids = nullptr;
+    int *importProcs = nullptr, *importToPart = nullptr;
+    int *exportProcs = nullptr, *exportToPart = nullptr;
+    rc = Zoltan_LB_Partition(zz, &changes, &numGidEntries, &numLidEntries,
+                             &numImport, &importGlobalGids, &importLocalGids,
+                             &importProcs, &importToPart,
+                             &numExport, &exportGlobalGids, &exportLocalGids,
+                             &exportProcs, &exportToPart);
+    if (rc == ZOLTAN_OK || rc == ZOLTAN_WARN) {
+        for (int i = 0; i < numExport; ++i) {
+            parts[exportLocalGids[i]] = exportToPart[i];
+        }
+    }
+    Zoltan_LB_Free_Part(&exportGlobalGids, &exportLocalGids, &exportProcs, &exportToPart);
+    Zoltan_LB_Free_Part(&importGlobalGids, &importLocalGids, &importProcs, &importToPart);
+    Zoltan_Destroy(&zz);
+
+    if (rc == ZOLTAN_MEMERR) {
+        OPM_THROW(std::runtime_error, "Memory allocation failure in Zoltan_LB_Partition");
+    } else if (rc != ZOLTAN_OK && rc != ZOLTAN_WARN) {
+        OPM_THROW(std::runtime_error, "Error returned from Zoltan_LB_Partition");
+    }
+    return parts;
+}
 
 } // namespace cpgrid
 } // namespace Dune
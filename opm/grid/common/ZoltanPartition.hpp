@@ -221,6 +221,24 @@ zoltanGraphPartitionGridForJac(const CpGrid& cpgrid,
 			       EdgeWeightMethod edgeWeightsMethod, int root,
 			       int numParts, const double zoltanImbalanceTol);
 
+/// \brief Partition a graph given in CSR format using Zoltan
+///
+/// The partitioning is done on the calling process with Zoltan's graph
+/// method and uniform edge weights.
+///
+/// @param xadj The adjacency list of vertex i is adjncy[xadj[i]] to adjncy[xadj[i+1]-1].
+/// @param adjncy The symmetric adjacency lists without self loops.
+/// @param numParts How many parts to divide the graph into.
+/// @param zoltanImbalanceTol The imbalance tolerance used by Zoltan.
+/// @param params Additional parameters passed on to Zoltan.
+/// @return A list containing the part of vertex i for all vertices.
+std::vector<int>
+zoltanPartitionGraph(const std::vector<int>& xadj,
+                     const std::vector<int>& adjncy,
+                     int numParts,
+                     const double zoltanImbalanceTol,
+                     const std::map<std::string,std::string>& params = {});
+
 }
 }
 
@@ -3,10 +3,14 @@
 
 #include <array>
 #include <cassert>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 
 #include <opm/grid/common/CartesianIndexMapper.hpp>
 #include <opm/grid/CpGrid.hpp>
+#include <opm/grid/utility/CartesianToCompressedMap.hpp>
 
 namespace Dune
 {
@@ -60,6 +64,37 @@ namespace Dune
         {
             grid_.getIJK( compressedElementIndex, coords );
         }
+
+        /** \brief return compressed index of a cell in the logical Cartesian grid, or -1 if inactive
+                   (for refined cells, the first leaf cell with the given parent Cartesian index) */
+        int compressedIndex( const int cartesianIndex ) const
+        {
+            return cartesianToCompressed()[ cartesianIndex ];
+        }
+
+        /** \brief return the inverse of cartesianIndex() as a dense or sparse O(1) lookup table.
+                   It is built on first use, and rebuilt when CpGrid::generation() has changed
+                   (e.g. after adapt()). Concurrent calls are safe, as long as the grid is not
+                   modified meanwhile. */
+        const Opm::CartesianToCompressedMap& cartesianToCompressed() const
+        {
+            std::lock_guard<std::mutex> lock(*inverseMutex_);
+            const auto generation = grid_.generation();
+            if( !inverse_ || inverseGeneration_ != generation )
+            {
+                const auto& globalCell = grid_.globalCell();
+                inverse_ = std::make_shared<const Opm::CartesianToCompressedMap>
+                    ( cartesianSize_, globalCell.size(), globalCell.data() );
+                inverseGeneration_ = generation;
+            }
+            return *inverse_;
+        }
+
+    private:
+        mutable std::shared_ptr<const Opm::CartesianToCompressedMap> inverse_;
+        mutable std::uint64_t inverseGeneration_ = 0;
+        // Shared by copies, which share the grid.
+        std::shared_ptr<std::mutex> inverseMutex_ = std::make_shared<std::mutex>();
     };
 
 } // end namespace Opm
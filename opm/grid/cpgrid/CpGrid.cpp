@@ -59,10 +59,16 @@
 #include <opm/grid/common/GridPartitioning.hpp>
 //#include <opm/grid/common/WellConnections.hpp>
 #include <opm/grid/common/CommunicationUtils.hpp>
+#include <opm/grid/utility/ElementChunks.hpp>
 
 //#include <fstream>
 //#include <iostream>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include <algorithm>
+#include <fstream>
 #include <iomanip>
 #include <numeric>
 #include <tuple>
@@ -570,6 +576,7 @@ CpGrid::scatterGrid(EdgeWeightMethod method,
 
         current_view_data_ = distributed_data_[0].get();
         current_data_ = &distributed_data_;
+        ++generation_;
         return std::make_pair(true, wells_on_proc);
     }
     else
@@ -644,6 +651,7 @@ void CpGrid::createCartesian(const std::array<int, 3>& dims,
                                              nullptr,
 #endif
                                              nnc, false, false, false, 0.0);
+    ++generation_;
     // global grid only on rank 0
     current_view_data_->ccobj_.broadcast(current_view_data_->logical_cartesian_size_.data(),
                                          current_view_data_->logical_cartesian_size_.size(),
@@ -729,12 +737,53 @@ std::vector<std::unordered_map<std::size_t, std::size_t>> CpGrid::mapLocalCartes
     return localCartesianIdxSets_to_leafIdx;
 }
 
+std::vector<Opm::CartesianToCompressedMap> CpGrid::mapLocalCartesianIndicesToLeafIndices() const
+{
+    const auto& leafIdx_to_localCartesianIdxSets = mapLeafIndexSetToLocalCartesianIndexSets();
+    const int num_leaf_cells = leafIdx_to_localCartesianIdxSets.size();
+    const int num_levels = maxLevel() + 1;
+
+    // Bucket the leaf cells by level, keeping the leaf order within each level.
+    std::vector<int> level_offset(num_levels + 1, 0);
+    for (const auto& [level, cartesian_idx] : leafIdx_to_localCartesianIdxSets) {
+        ++level_offset[level + 1];
+    }
+    std::partial_sum(level_offset.begin(), level_offset.end(), level_offset.begin());
+    std::vector<int> cartesian_indices(num_leaf_cells);
+    std::vector<int> leaf_indices(num_leaf_cells);
+    auto position = level_offset;
+    for (int leaf_idx = 0; leaf_idx < num_leaf_cells; ++leaf_idx) {
+        const auto& [level, cartesian_idx] = leafIdx_to_localCartesianIdxSets[leaf_idx];
+        cartesian_indices[position[level]] = cartesian_idx;
+        leaf_indices[position[level]] = leaf_idx;
+        ++position[level];
+    }
+
+    std::vector<Opm::CartesianToCompressedMap> localCartesianIdx_to_leafIdx;
+    localCartesianIdx_to_leafIdx.reserve(num_levels);
+    for (int level = 0; level < num_levels; ++level) {
+        const auto& cartesian_dims = currentData()[level]->logicalCartesianSize();
+        localCartesianIdx_to_leafIdx.emplace_back(cartesian_dims[0]*cartesian_dims[1]*cartesian_dims[2],
+                                                  level_offset[level + 1] - level_offset[level],
+                                                  cartesian_indices.data() + level_offset[level],
+                                                  leaf_indices.data() + level_offset[level],
+                                                  Opm::CartesianToCompressedMap::defaultDenseFraction);
+    }
+    return localCartesianIdx_to_leafIdx;
+}
+
 std::vector<std::array<int,2>> CpGrid::mapLeafIndexSetToLocalCartesianIndexSets() const
 {
-    std::vector<std::array<int,2>> leafIdx_to_localCartesianIdxSets(currentData().back()->size(0));
-    for (const auto& element : elements(leafGridView())) {
+    const int num_leaf_cells = currentData().back()->size(0);
+    std::vector<std::array<int,2>> leafIdx_to_localCartesianIdxSets(num_leaf_cells);
+    // Leaf elements are created from their index, to allow threading.
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for (int leaf_idx = 0; leaf_idx < num_leaf_cells; ++leaf_idx) {
+        const auto element = cpgrid::Entity<0>(*currentData().back(), leaf_idx, true);
         const auto& global_cell_level = currentData()[element.level()]->globalCell()[element.getLevelElem().index()];
-        leafIdx_to_localCartesianIdxSets[element.index()] = {element.level(), global_cell_level};
+        leafIdx_to_localCartesianIdxSets[leaf_idx] = {element.level(), global_cell_level};
     }
     return leafIdx_to_localCartesianIdxSets;
 }
@@ -754,11 +803,28 @@ void CpGrid::setUniqueBoundaryIds(bool uids)
     current_view_data_->setUniqueBoundaryIds(uids);
 }
 
+void CpGrid::firstTouch(int num_threads)
+{
+    if (num_threads <= 0) {
+#ifdef _OPENMP
+        num_threads = omp_get_max_threads();
+#else
+        num_threads = 1;
+#endif
+    }
+    current_view_data_->firstTouch(num_threads);
+}
+
 std::string CpGrid::name() const
 {
     return "CpGrid";
 }
 
+std::uint64_t CpGrid::generation() const
+{
+    return generation_;
+}
+
 int CpGrid::maxLevel() const
 {
     if (currentData().size() == 1){
@@ -1450,7 +1516,7 @@ void CpGrid::selectWinnerPointIds([[maybe_unused]] std::vector<std::vector<int>>
 {
 #if HAVE_MPI
     // To store cell_to_point_ information of all refined level grids.
-    std::vector<std::vector<std::array<int,8>>> level_cell_to_point(cells_per_dim_vec.size());
+    std::vector<cpgrid::CellToPointTable> level_cell_to_point(cells_per_dim_vec.size());
     // To decide which "candidate" point global id wins, the rank is stored. The smallest ranks wins,
     // i.e., the other non-selected candidates get rewritten with the values from the smallest (winner) rank.
     std::vector<std::vector<int>> level_winning_ranks(cells_per_dim_vec.size());
@@ -1759,6 +1825,55 @@ const Dune::FieldVector<double,3> CpGrid::faceAreaNormalEcl(int face) const
     }
 }
 
+const CpGrid::EclGeometry& CpGrid::eclGeometry() const
+{
+    if (ecl_geometry_ && ecl_geometry_generation_ == generation_) {
+        return *ecl_geometry_;
+    }
+    auto geometry = std::make_shared<EclGeometry>();
+    const int num_cells = size(0);
+    const int num_faces = numFaces();
+    geometry->cell_center_depth.resize(num_cells);
+    geometry->cell_face_start.resize(num_cells + 1);
+    geometry->cell_face_start[0] = 0;
+    for (int cell = 0; cell < num_cells; ++cell) {
+        geometry->cell_face_start[cell + 1] = geometry->cell_face_start[cell] + numCellFaces(cell);
+    }
+    geometry->face_center.resize(geometry->cell_face_start.back());
+    geometry->face_area_normal.resize(num_faces);
+
+    const auto& gv = leafGridView();
+#ifdef _OPENMP
+    const std::size_t num_chunks = 4 * omp_get_max_threads();
+#else
+    const std::size_t num_chunks = 1;
+#endif
+    const Opm::ElementChunks chunks(gv, Dune::Partitions::all, num_chunks);
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for (const auto& chunk : chunks) {
+        for (const auto& elem : chunk) {
+            const int cell = elem.index();
+            geometry->cell_center_depth[cell] = cellCenterDepth(cell);
+            int pos = geometry->cell_face_start[cell];
+            for (const auto& intersection : intersections(gv, elem)) {
+                geometry->face_center[pos++] = faceCenterEcl(cell, intersection.indexInInside(), intersection);
+            }
+        }
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int face = 0; face < num_faces; ++face) {
+        geometry->face_area_normal[face] = faceAreaNormalEcl(face);
+    }
+
+    ecl_geometry_ = std::move(geometry);
+    ecl_geometry_generation_ = generation_;
+    return *ecl_geometry_;
+}
+
 const Dune::FieldVector<double,3>& CpGrid::vertexPosition(int vertex) const
 {
     return current_view_data_->geomVector<3>()[cpgrid::EntityRep<3>(vertex, true)].center();
@@ -1857,8 +1972,11 @@ const CpGrid::InterfaceMap& CpGrid::pointScatterGatherInterface() const
 
 void CpGrid::switchToGlobalView()
 {
+    if (globalViewReleased())
+        OPM_THROW(std::logic_error, "The global view of the grid has been released by releaseGlobalView()");
     current_view_data_ = data_.back().get();
     current_data_ = &data_;
+    ++generation_;
 }
 
 void CpGrid::switchToDistributedView()
@@ -1867,6 +1985,56 @@ void CpGrid::switchToDistributedView()
         OPM_THROW(std::logic_error, "No distributed view available in grid");
     current_view_data_ = distributed_data_.back().get();
     current_data_ = &distributed_data_;
+    ++generation_;
+}
+
+void CpGrid::releaseGlobalView()
+{
+    if (distributed_data_.empty())
+        OPM_THROW(std::logic_error, "The global view can only be released after load balancing");
+    if (current_data_ != &distributed_data_)
+        OPM_THROW(std::logic_error, "Switch to the distributed view before releasing the global view");
+    if (data_.size() > 1)
+        OPM_THROW(std::logic_error, "Releasing the global view of a grid with local refinement is not supported");
+    data_[0]->releaseTopologyAndGeometry();
+}
+
+bool CpGrid::globalViewReleased() const
+{
+    return data_[0]->topologyAndGeometryReleased();
+}
+
+std::uint64_t CpGrid::writeDistributedCheckpoint(const std::string& basename) const
+{
+    if (distributed_data_.empty())
+        OPM_THROW(std::logic_error, "Only a load balanced grid can be checkpointed");
+    if (distributed_data_.size() > 1)
+        OPM_THROW(std::logic_error, "Checkpointing a grid with local refinement is not supported");
+    const auto& data = *distributed_data_[0];
+    std::ofstream out(basename + "." + std::to_string(data.ccobj_.rank()), std::ios::binary);
+    return data.writeCheckpoint(out);
+}
+
+std::uint64_t CpGrid::readDistributedCheckpoint(const std::string& basename)
+{
+    if (!distributed_data_.empty())
+        OPM_THROW(std::logic_error, "The grid has already been load balanced");
+    auto& cc = data_[0]->ccobj_;
+    std::ifstream in(basename + "." + std::to_string(cc.rank()), std::ios::binary);
+    auto data = std::make_shared<cpgrid::CpGridData>(cc, distributed_data_);
+    const auto hash = data->readCheckpoint(in);
+
+    distributed_data_.push_back(data);
+    global_id_set_ptr_->insertIdSet(*data);
+    data->index_set_.reset(new cpgrid::IndexSet(data->cell_to_face_.size(),
+                                                data->geomVector<3>().size()));
+    // There is no global grid to go back to.
+    data_[0]->releaseTopologyAndGeometry();
+
+    current_view_data_ = data.get();
+    current_data_ = &distributed_data_;
+    ++generation_;
+    return hash;
 }
 
 #if HAVE_MPI
@@ -1908,6 +2076,7 @@ CpGrid::processEclipseFormat(const Opm::EclipseGrid* ecl_grid,
 {
     auto removed_cells = current_view_data_->processEclipseFormat(ecl_grid, ecl_state, periodic_extension,
                                                                   turn_normals, clip_z, pinchActive);
+    ++generation_;
     current_view_data_->ccobj_.broadcast(current_view_data_->logical_cartesian_size_.data(),
                                          current_view_data_->logical_cartesian_size_.size(),
                                          0);
@@ -1937,6 +2106,7 @@ void CpGrid::processEclipseFormat(const grdecl& input_data,
 #endif
                                              nnc,
                                              remove_ij_boundary, turn_normals, false, 0.0);
+    ++generation_;
     current_view_data_->ccobj_.broadcast(current_view_data_->logical_cartesian_size_.data(),
                                          current_view_data_->logical_cartesian_size_.size(),
                                          0);
@@ -2072,7 +2242,7 @@ bool CpGrid::adapt(const std::vector<std::array<int,3>>& cells_per_dim_vec,
     std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>> refined_grid_ptr_vec(levels);
 
     std::vector<Dune::cpgrid::DefaultGeometryPolicy> refined_geometries_vec(levels);
-    std::vector<std::vector<std::array<int,8>>> refined_cell_to_point_vec(levels);
+    std::vector<cpgrid::CellToPointTable> refined_cell_to_point_vec(levels);
     std::vector<cpgrid::OrientedEntityTable<0,1>> refined_cell_to_face_vec(levels);
     std::vector<Opm::SparseTable<int>> refined_face_to_point_vec(levels);
     std::vector<cpgrid::OrientedEntityTable<1,0>> refined_face_to_cell_vec(levels);
@@ -2099,7 +2269,7 @@ bool CpGrid::adapt(const std::vector<std::array<int,3>>& cells_per_dim_vec,
 #endif
     auto& adaptedGrid = *adaptedGrid_ptr;
     Dune::cpgrid::DefaultGeometryPolicy&                         adapted_geometries = adaptedGrid.geometry_;
-    std::vector<std::array<int,8>>&                              adapted_cell_to_point = adaptedGrid.cell_to_point_;
+    cpgrid::CellToPointTable&                                    adapted_cell_to_point = adaptedGrid.cell_to_point_;
     cpgrid::OrientedEntityTable<0,1>&                            adapted_cell_to_face = adaptedGrid.cell_to_face_;
     Opm::SparseTable<int>&                                       adapted_face_to_point = adaptedGrid.face_to_point_;
     cpgrid::OrientedEntityTable<1,0>&                            adapted_face_to_cell = adaptedGrid.face_to_cell_;
@@ -2475,6 +2645,7 @@ bool CpGrid::adapt(const std::vector<std::array<int,3>>& cells_per_dim_vec,
 
     // Update the leaf grid view
     current_view_data_ = data.back().get();
+    ++generation_;
 
     // When the refinement is determined by startIJK and endIJK values, the LGR has a (local) Cartesian size.
     // Therefore, each refined cell belonging to the LGR can be associated with a (local) IJK and its (local) Cartesian index.
@@ -3731,7 +3902,7 @@ void CpGrid::populateRefinedFaces(std::vector<Dune::cpgrid::EntityVariableBase<c
 }
 
 void CpGrid::populateLeafGridCells(Dune::cpgrid::EntityVariableBase<cpgrid::Geometry<3,3>>& adapted_cells,
-                                   std::vector<std::array<int,8>>& adapted_cell_to_point,
+                                   cpgrid::CellToPointTable& adapted_cell_to_point,
                                    const int& cell_count,
                                    cpgrid::OrientedEntityTable<0,1>& adapted_cell_to_face,
                                    cpgrid::OrientedEntityTable<1,0>& adapted_face_to_cell,
@@ -3862,7 +4033,7 @@ void CpGrid::populateLeafGridCells(Dune::cpgrid::EntityVariableBase<cpgrid::Geom
 
 
 void CpGrid::populateRefinedCells(std::vector<Dune::cpgrid::EntityVariableBase<cpgrid::Geometry<3,3>>>& refined_cells_vec,
-                                  std::vector<std::vector<std::array<int,8>>>& refined_cell_to_point_vec,
+                                  std::vector<cpgrid::CellToPointTable>& refined_cell_to_point_vec,
                                   std::vector<std::vector<int>>& refined_global_cell_vec,
                                   const std::vector<int>& refined_cell_count_vec,
                                   std::vector<cpgrid::OrientedEntityTable<0,1>>& refined_cell_to_face_vec,
@@ -3992,7 +4163,7 @@ void CpGrid::setRefinedLevelGridsGeometries( /* Refined corner arguments */
                                              const std::vector<int>& refined_face_count_vec,
                                              /* Refined cell argumets */
                                              std::vector<Dune::cpgrid::EntityVariableBase<cpgrid::Geometry<3,3>>>& refined_cells_vec,
-                                             std::vector<std::vector<std::array<int,8>>>& refined_cell_to_point_vec,
+                                             std::vector<cpgrid::CellToPointTable>& refined_cell_to_point_vec,
                                              std::vector<std::vector<int>>& refined_global_cell_vec,
                                              const std::vector<int>& refined_cell_count_vec,
                                              std::vector<cpgrid::OrientedEntityTable<0,1>>& refined_cell_to_face_vec,
@@ -4065,7 +4236,7 @@ void CpGrid::updateLeafGridViewGeometries( /* Leaf grid View Corners arguments *
                                            const int& face_count,
                                            /* Leaf grid View Cells argumemts  */
                                            Dune::cpgrid::EntityVariableBase<cpgrid::Geometry<3,3>>& adapted_cells,
-                                           std::vector<std::array<int,8>>& adapted_cell_to_point,
+                                           cpgrid::CellToPointTable& adapted_cell_to_point,
                                            const int& cell_count,
                                            cpgrid::OrientedEntityTable<0,1>& adapted_cell_to_face,
                                            cpgrid::OrientedEntityTable<1,0>& adapted_face_to_cell,
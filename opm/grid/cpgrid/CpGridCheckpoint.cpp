@@ -0,0 +1,466 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+#include "CpGridData.hpp"
+#include "Indexsets.hpp"
+#include "PartitionTypeIndicator.hpp"
+
+#include <opm/common/ErrorMacros.hpp>
+
+#include <array>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+
+// Layout of a checkpoint: the header (magic, version, number of processes,
+// rank), the grid data written by writeCheckpoint(), and a trailer with the
+// hash of the grid data of this process and the combined hash of all
+// processes.
+const char checkpointMagic[8] = { 'O', 'P', 'M', 'C', 'P', 'G', 'R', 'D' };
+const std::uint32_t checkpointVersion = 1;
+
+/// FNV-1a hash of a byte sequence, continued from hash.
+std::uint64_t hashBytes(const char* bytes, std::size_t size, std::uint64_t hash)
+{
+    for (std::size_t i = 0; i < size; ++i) {
+        hash ^= static_cast<unsigned char>(bytes[i]);
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+const std::uint64_t hashSeed = 0xcbf29ce484222325ULL;
+
+/// Writes plain values and vectors of them, hashing what is written.
+class CheckpointWriter
+{
+public:
+    explicit CheckpointWriter(std::ostream& out)
+        : out_(out)
+    {}
+
+    template<class T>
+    void write(const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Only plain values can be written.");
+        writeBytes(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template<class T, class A>
+    void write(const std::vector<T, A>& values)
+    {
+        write<std::uint64_t>(values.size());
+        writeBytes(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+    }
+
+    std::uint64_t hash() const
+    {
+        return hash_;
+    }
+
+private:
+    void writeBytes(const char* bytes, std::size_t size)
+    {
+        out_.write(bytes, size);
+        hash_ = hashBytes(bytes, size, hash_);
+    }
+
+    std::ostream& out_;
+    std::uint64_t hash_ = hashSeed;
+};
+
+/// Reads what CheckpointWriter wrote, hashing what is read.
+class CheckpointReader
+{
+public:
+    explicit CheckpointReader(std::istream& in)
+        : in_(in)
+    {}
+
+    template<class T>
+    T read()
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Only plain values can be read.");
+        T value;
+        readBytes(reinterpret_cast<char*>(&value), sizeof(T));
+        return value;
+    }
+
+    template<class T, class A>
+    void read(std::vector<T, A>& values)
+    {
+        values.resize(read<std::uint64_t>());
+        readBytes(reinterpret_cast<char*>(values.data()), values.size() * sizeof(T));
+    }
+
+    std::uint64_t hash() const
+    {
+        return hash_;
+    }
+
+private:
+    void readBytes(char* bytes, std::size_t size)
+    {
+        if (!in_.read(bytes, size)) {
+            throw std::runtime_error("Unexpected end of grid checkpoint");
+        }
+        hash_ = hashBytes(bytes, size, hash_);
+    }
+
+    std::istream& in_;
+    std::uint64_t hash_ = hashSeed;
+};
+
+/// Row r of a sparse table.
+template<class T>
+auto tableRow(const Opm::SparseTable<T>& table, int r)
+{
+    return table[r];
+}
+
+template<int codim_from, int codim_to>
+auto tableRow(const Dune::cpgrid::OrientedEntityTable<codim_from, codim_to>& table, int r)
+{
+    return table[Dune::cpgrid::EntityRep<codim_from>(r, true)];
+}
+
+/// Row sizes and entries of a sparse table, with entity representations
+/// given by their signed index.
+template<class Table, class Entry>
+void writeTable(CheckpointWriter& writer, const Table& table, Entry entry)
+{
+    std::vector<int> row_sizes(table.size());
+    std::vector<int> entries;
+    entries.reserve(table.dataSize());
+    for (int row = 0; row < table.size(); ++row) {
+        const auto entity_row = tableRow(table, row);
+        row_sizes[row] = entity_row.size();
+        for (const auto& e : entity_row) {
+            entries.push_back(entry(e));
+        }
+    }
+    writer.write(row_sizes);
+    writer.write(entries);
+}
+
+template<class Table, class Entry>
+void readTable(CheckpointReader& reader, Table& table, Entry entry)
+{
+    std::vector<int> row_sizes;
+    std::vector<int> entries;
+    reader.read(row_sizes);
+    reader.read(entries);
+    std::vector<std::decay_t<decltype(entry(0))>> data;
+    data.reserve(entries.size());
+    for (const int e : entries) {
+        data.push_back(entry(e));
+    }
+    table = Table(data.begin(), data.end(), row_sizes.begin(), row_sizes.end());
+}
+
+template<int codim>
+Dune::cpgrid::EntityRep<codim> entityRep(const int signed_index)
+{
+    return Dune::cpgrid::EntityRep<codim>(signed_index < 0 ? ~signed_index : signed_index,
+                                          signed_index >= 0);
+}
+
+template<class Vector>
+void writeVectors(CheckpointWriter& writer, const std::vector<Vector>& vectors)
+{
+    std::vector<double> components;
+    components.reserve(3 * vectors.size());
+    for (const auto& v : vectors) {
+        components.insert(components.end(), v.begin(), v.end());
+    }
+    writer.write(components);
+}
+
+template<class Vector>
+std::vector<Vector> readVectors(CheckpointReader& reader)
+{
+    std::vector<double> components;
+    reader.read(components);
+    if (components.size() % 3 != 0) {
+        throw std::runtime_error("Corrupt vector data in grid checkpoint");
+    }
+    std::vector<Vector> vectors(components.size() / 3);
+    for (std::size_t i = 0; i < vectors.size(); ++i) {
+        for (int d = 0; d < 3; ++d) {
+            vectors[i][d] = components[3 * i + d];
+        }
+    }
+    return vectors;
+}
+
+} // anonymous namespace
+
+namespace Dune
+{
+namespace cpgrid
+{
+
+#if HAVE_MPI
+
+std::uint64_t CpGridData::writeCheckpoint(std::ostream& out) const
+{
+    using PointType = FieldVector<double, 3>;
+
+    out.write(checkpointMagic, sizeof(checkpointMagic));
+    const std::array<std::uint32_t, 3> header{ checkpointVersion,
+                                               static_cast<std::uint32_t>(ccobj_.size()),
+                                               static_cast<std::uint32_t>(ccobj_.rank()) };
+    out.write(reinterpret_cast<const char*>(header.data()), sizeof(header));
+
+    CheckpointWriter writer(out);
+    writer.write(logical_cartesian_size_);
+    writeTable(writer, cell_to_face_, [](const EntityRep<1>& f) { return f.signedIndex(); });
+    writeTable(writer, face_to_cell_, [](const EntityRep<0>& c) { return c.signedIndex(); });
+    writeTable(writer, face_to_point_, [](const int p) { return p; });
+    writer.write(cell_to_point_);
+    writer.write(global_cell_);
+    writer.write(aquifer_cells_);
+
+    writer.write(std::vector<enum face_tag>(face_tag_.begin(), face_tag_.end()));
+    writeVectors(writer, std::vector<PointType>(face_normals_.begin(), face_normals_.end()));
+    writer.write(std::vector<int>(unique_boundary_ids_.begin(), unique_boundary_ids_.end()));
+    writer.write<char>(use_unique_boundary_ids_);
+
+    // Geometry: point positions, face centroids and areas, cell centroids
+    // and volumes. The cell corners are given by cell_to_point_.
+    std::vector<PointType> centers;
+    std::vector<double> volumes;
+    for (const auto& point : geomVector<3>()) {
+        centers.push_back(point.center());
+    }
+    writeVectors(writer, centers);
+    centers.clear();
+    for (const auto& face : geomVector<1>()) {
+        centers.push_back(face.center());
+        volumes.push_back(face.volume());
+    }
+    writeVectors(writer, centers);
+    writer.write(volumes);
+    centers.clear();
+    volumes.clear();
+    for (const auto& cell : geomVector<0>()) {
+        centers.push_back(cell.center());
+        volumes.push_back(cell.volume());
+    }
+    writeVectors(writer, centers);
+    writer.write(volumes);
+
+    writer.write(global_id_set_->getMapping<0>());
+    writer.write(global_id_set_->getMapping<1>());
+    writer.write(global_id_set_->getMapping<3>());
+
+    // The parallel index set of the cells: global index, local index,
+    // attribute and whether the index is public.
+    std::vector<std::array<int, 4>> indices;
+    indices.reserve(cellIndexSet().size());
+    for (const auto& index : cellIndexSet()) {
+        indices.push_back({ index.global(), static_cast<int>(index.local().local()),
+                            static_cast<int>(index.local().attribute()),
+                            static_cast<int>(index.local().isPublic()) });
+    }
+    writer.write(indices);
+
+    // Trailer with the hash of this process and of all processes.
+    const std::uint64_t local_hash = writer.hash();
+    std::vector<std::uint64_t> local_hashes(ccobj_.size());
+    ccobj_.allgather(&local_hash, 1, local_hashes.data());
+    const std::uint64_t global_hash =
+        hashBytes(reinterpret_cast<const char*>(local_hashes.data()),
+                  local_hashes.size() * sizeof(std::uint64_t), hashSeed);
+    out.write(reinterpret_cast<const char*>(&local_hash), sizeof(local_hash));
+    out.write(reinterpret_cast<const char*>(&global_hash), sizeof(global_hash));
+
+    const bool ok = ccobj_.min(static_cast<int>(static_cast<bool>(out)));
+    if (!ok) {
+        OPM_THROW(std::runtime_error, "Writing the grid checkpoint failed on at least one process");
+    }
+    return global_hash;
+}
+
+std::uint64_t CpGridData::readCheckpoint(std::istream& in)
+{
+    using PointType = FieldVector<double, 3>;
+
+    // Read everything local first, so that all processes fail together
+    // before any communication if one of the files is bad.
+    std::string error;
+    std::uint64_t local_hash = 0;
+    std::uint64_t global_hash = 0;
+    std::vector<std::array<int, 4>> indices;
+    try {
+        char magic[sizeof(checkpointMagic)];
+        std::array<std::uint32_t, 3> header;
+        if (!in.read(magic, sizeof(magic))
+            || std::memcmp(magic, checkpointMagic, sizeof(magic)) != 0
+            || !in.read(reinterpret_cast<char*>(header.data()), sizeof(header))) {
+            throw std::runtime_error("Not a grid checkpoint");
+        }
+        if (header[0] != checkpointVersion) {
+            throw std::runtime_error("Unsupported grid checkpoint version " + std::to_string(header[0]));
+        }
+        if (header[1] != static_cast<std::uint32_t>(ccobj_.size())
+            || header[2] != static_cast<std::uint32_t>(ccobj_.rank())) {
+            throw std::runtime_error("Grid checkpoint of rank " + std::to_string(header[2]) + " of "
+                                     + std::to_string(header[1]) + " processes read by rank "
+                                     + std::to_string(ccobj_.rank()) + " of "
+                                     + std::to_string(ccobj_.size()));
+        }
+
+        CheckpointReader reader(in);
+        logical_cartesian_size_ = reader.read<std::array<int, 3>>();
+        readTable(reader, cell_to_face_, entityRep<1>);
+        readTable(reader, face_to_cell_, entityRep<0>);
+        readTable(reader, face_to_point_, [](const int p) { return p; });
+        reader.read(cell_to_point_);
+        reader.read(global_cell_);
+        reader.read(aquifer_cells_);
+
+        std::vector<enum face_tag> tags;
+        reader.read(tags);
+        face_tag_.assign(tags.begin(), tags.end());
+        const auto normals = readVectors<PointType>(reader);
+        face_normals_.assign(normals.begin(), normals.end());
+        std::vector<int> bids;
+        reader.read(bids);
+        unique_boundary_ids_.assign(bids.begin(), bids.end());
+        use_unique_boundary_ids_ = reader.read<char>();
+
+        const auto point_centers = readVectors<PointType>(reader);
+        auto& points = *geometry_.geomVector(std::integral_constant<int, 3>());
+        points.resize(point_centers.size());
+        for (std::size_t p = 0; p < point_centers.size(); ++p) {
+            points[EntityRep<3>(p, true)] = Geometry<0, 3>(point_centers[p]);
+        }
+        const auto face_centers = readVectors<PointType>(reader);
+        std::vector<double> volumes;
+        reader.read(volumes);
+        if (volumes.size() != face_centers.size()) {
+            throw std::runtime_error("Inconsistent sizes in grid checkpoint");
+        }
+        auto& faces = *geometry_.geomVector(std::integral_constant<int, 1>());
+        faces.resize(face_centers.size());
+        for (std::size_t f = 0; f < face_centers.size(); ++f) {
+            faces[EntityRep<1>(f, true)] = Geometry<2, 3>(face_centers[f], volumes[f]);
+        }
+        const auto cell_centers = readVectors<PointType>(reader);
+        reader.read(volumes);
+        if (volumes.size() != cell_centers.size() || cell_to_point_.size() != cell_centers.size()) {
+            throw std::runtime_error("Inconsistent sizes in grid checkpoint");
+        }
+        auto& cells = *geometry_.geomVector(std::integral_constant<int, 0>());
+        cells.resize(cell_centers.size());
+        for (std::size_t c = 0; c < cell_centers.size(); ++c) {
+            cells[EntityRep<0>(c, true)] = Geometry<3, 3>(cell_centers[c], volumes[c],
+                                                          geometry_.geomVector(std::integral_constant<int, 3>()),
+                                                          cell_to_point_[c].data());
+        }
+
+        std::vector<int> cell_ids, face_ids, point_ids;
+        reader.read(cell_ids);
+        reader.read(face_ids);
+        reader.read(point_ids);
+        global_id_set_->swap(cell_ids, face_ids, point_ids);
+        reader.read(indices);
+
+        if (static_cast<int>(cell_centers.size()) != cell_to_face_.size()
+            || global_cell_.size() != cell_centers.size()
+            || static_cast<int>(face_centers.size()) != face_to_cell_.size()
+            || static_cast<int>(face_centers.size()) != face_to_point_.size()
+            || indices.size() != cell_centers.size()) {
+            throw std::runtime_error("Inconsistent sizes in grid checkpoint");
+        }
+
+        local_hash = reader.hash();
+        std::uint64_t stored[2];
+        if (!in.read(reinterpret_cast<char*>(stored), sizeof(stored))) {
+            throw std::runtime_error("Unexpected end of grid checkpoint");
+        }
+        if (stored[0] != local_hash) {
+            throw std::runtime_error("Grid checkpoint of rank " + std::to_string(ccobj_.rank()) + " is corrupt");
+        }
+        global_hash = stored[1];
+    }
+    catch (const std::exception& e) {
+        error = e.what();
+    }
+    if (!ccobj_.min(static_cast<int>(error.empty()))) {
+        if (error.empty()) {
+            error = "Reading the grid checkpoint failed on another process";
+        }
+        OPM_THROW(std::runtime_error, error);
+    }
+
+    // All files have to be from the same checkpoint.
+    std::vector<std::uint64_t> local_hashes(ccobj_.size());
+    ccobj_.allgather(&local_hash, 1, local_hashes.data());
+    const std::uint64_t expected_hash =
+        hashBytes(reinterpret_cast<const char*>(local_hashes.data()),
+                  local_hashes.size() * sizeof(std::uint64_t), hashSeed);
+    if (!ccobj_.min(static_cast<int>(expected_hash == global_hash))) {
+        OPM_THROW(std::runtime_error, "The grid checkpoint files are not from the same checkpoint");
+    }
+
+    // Rebuild the parallel index set, the remote indices, the partition
+    // types and the communication interfaces, as distributeGlobalGrid() does.
+    auto& cell_indexset = cellIndexSet();
+    cell_indexset.beginResize();
+    for (const auto& index : indices) {
+        cell_indexset.add(index[0], ParallelIndexSet::LocalIndex(index[1], AttributeSet(index[2]), index[3] != 0));
+    }
+    cell_indexset.endResize();
+    cellRemoteIndices().template rebuild<false>();
+
+    computeCellPartitionType();
+    computePointPartitionType();
+    computeCommunicationInterfaces(geometry_.geomVector<3>().size());
+
+    return global_hash;
+}
+
+#else // #if HAVE_MPI
+
+std::uint64_t CpGridData::writeCheckpoint(std::ostream&) const
+{
+    OPM_THROW(std::logic_error, "Grid checkpoints need MPI");
+}
+
+std::uint64_t CpGridData::readCheckpoint(std::istream&)
+{
+    OPM_THROW(std::logic_error, "Grid checkpoints need MPI");
+}
+
+#endif // #if HAVE_MPI
+
+} // namespace cpgrid
+} // namespace Dune
@@ -3,6 +3,7 @@
 #include <array>
 #include <map>
 #include <set>
+#include <type_traits>
 #include <vector>
 #include <utility>
 #include"CpGridData.hpp"
@@ -20,6 +21,7 @@
 #include <dune/common/parallel/remoteindices.hh>
 #include <dune/common/enumset.hh>
 #include <opm/grid/utility/SparseTable.hpp>
+#include <opm/grid/utility/firstTouch.hpp>
 
 #include <opm/grid/utility/platform_dependent/reenable_warnings.h>
 #include <opm/grid/CpGrid.hpp>
@@ -144,8 +146,52 @@ void CpGridData::computeUniqueBoundaryIds()
 #endif
 }
 
+void CpGridData::firstTouch(int num_threads)
+{
+    const auto cell_blocks = Opm::chunkBoundaries(size(0), num_threads);
+    const auto face_blocks = Opm::chunkBoundaries(face_to_cell_.size(), num_threads);
+    const auto point_blocks = Opm::chunkBoundaries(size(3), num_threads);
+
+    // EntityVariable and OrientedEntityTable hide their storage, except
+    // from CpGridData.
+    const auto touchVariable = [](auto& variable, const auto& blocks) {
+        using T = typename std::remove_reference_t<decltype(variable)>::value_type;
+        Opm::firstTouch(static_cast<typename EntityVariableBase<T>::V&>(static_cast<EntityVariableBase<T>&>(variable)), blocks);
+    };
+    const auto touchTable = [](auto& table, const auto& blocks) {
+        using ToType = typename std::remove_reference_t<decltype(table)>::ToType;
+        static_cast<Opm::SparseTable<ToType>&>(table).firstTouch(blocks);
+    };
+
+    // Cell geometries point into cell_to_point_ for their corners.
+    const int* old_begin = cell_to_point_.empty() ? nullptr : cell_to_point_.front().data();
+    const int* old_end = old_begin + 8*cell_to_point_.size();
+    Opm::firstTouch(cell_to_point_, cell_blocks);
+    auto& cell_geom = *geometry_.geomVector(std::integral_constant<int, 0>());
+    if (old_begin) {
+        for (auto& geom : cell_geom) {
+            geom.relocateCornerIndices(old_begin, old_end, cell_to_point_.front().data());
+        }
+    }
+
+    touchVariable(cell_geom, cell_blocks);
+    touchVariable(*geometry_.geomVector(std::integral_constant<int, 1>()), face_blocks);
+    touchVariable(*geometry_.geomVector(std::integral_constant<int, 3>()), point_blocks);
+    touchVariable(face_normals_, face_blocks);
+    touchVariable(face_tag_, face_blocks);
+    touchVariable(unique_boundary_ids_, face_blocks);
+    touchTable(cell_to_face_, cell_blocks);
+    touchTable(face_to_cell_, face_blocks);
+    face_to_point_.firstTouch(face_blocks);
+    // global_cell_ is handed out as a std::vector<int> by globalCell(),
+    // so it cannot use FirstTouchAllocator and stays where it is.
+}
+
 int CpGridData::size(int codim) const
 {
+    if (released_sizes_) {
+        return codim == 0 ? (*released_sizes_)[0] : (codim == 3 ? (*released_sizes_)[1] : 0);
+    }
     switch (codim) {
     case 0: return cell_to_face_.size();
     case 1: return 0;
@@ -155,6 +201,26 @@ int CpGridData::size(int codim) const
     }
 }
 
+void CpGridData::releaseTopologyAndGeometry()
+{
+    if (released_sizes_) {
+        return;
+    }
+    released_sizes_ = std::array<int,2>{ size(0), size(3) };
+    cell_to_face_ = cpgrid::OrientedEntityTable<0, 1>();
+    face_to_cell_ = cpgrid::OrientedEntityTable<1, 0>();
+    face_to_point_ = Opm::SparseTable<int>();
+    cpgrid::CellToPointTable().swap(cell_to_point_);
+    face_tag_ = cpgrid::EntityVariable<enum face_tag, 1>();
+    geometry_ = cpgrid::DefaultGeometryPolicy();
+    face_normals_ = cpgrid::SignedEntityVariable<PointType, 1>();
+    unique_boundary_ids_ = cpgrid::EntityVariable<int, 1>();
+    use_unique_boundary_ids_ = false;
+    std::vector<int>().swap(mark_);
+    std::vector<double>().swap(zcorn);
+    std::vector<int>().swap(aquifer_cells_);
+}
+
 #if HAVE_MPI
 
 // A functor that counts existent entries and renumbers them.
@@ -500,7 +566,7 @@ struct CellGeometryHandle
                        const std::vector<int>& gatherAquiferCells,
                        std::vector<int>& scatterAquiferCells,
                        std::shared_ptr<const EntityVariable<cpgrid::Geometry<0, 3>, 3>> pointGeom,
-                       const std::vector< std::array<int,8> >& cell2Points)
+                       const cpgrid::CellToPointTable& cell2Points)
         : gatherCont_(gatherCont), scatterCont_(scatterCont),
           gatherAquiferCells_(gatherAquiferCells),scatterAquiferCells_(scatterAquiferCells),
           pointGeom_(std::move(pointGeom)), cell2Points_(cell2Points)
@@ -573,13 +639,13 @@ private:
     const std::vector<int>& gatherAquiferCells_;
     std::vector<int>& scatterAquiferCells_;
     std::shared_ptr<const EntityVariable<cpgrid::Geometry<0, 3>, 3>> pointGeom_;
-    const std::vector< std::array<int,8> >& cell2Points_;
+    const cpgrid::CellToPointTable& cell2Points_;
 };
 
 struct Cell2PointsDataHandle
 {
     using DataType = int;
-    using Vector = std::vector<std::array<int,8> >;
+    using Vector = cpgrid::CellToPointTable;
     Cell2PointsDataHandle(const Vector& globalCell2Points,
                           const LevelGlobalIdSet& globalIds,
                           const std::vector<std::set<int> >& globalAdditionalPointIds,
@@ -1227,7 +1293,7 @@ void CpGridData::computeGeometry(const CpGrid& grid,
                                  DefaultGeometryPolicy& geometry,
                                  std::vector<int>& aquiferCells,
                                  const OrientedEntityTable<0, 1>& cell2Faces,
-                                 const std::vector< std::array<int,8> >& cell2Points)
+                                 const cpgrid::CellToPointTable& cell2Points)
 {
     FaceGeometryHandle faceGeomHandle(*globalGeometry.geomVector(std::integral_constant<int,1>()),
                                       *geometry.geomVector(std::integral_constant<int,1>()));
@@ -1370,7 +1436,7 @@ std::map<int,int> computeCell2Face(const CpGrid& grid,
     return map2Local;
 }
 
-std::vector<std::set<int> > computeAdditionalFacePoints(const std::vector<std::array<int,8> >& globalCell2Points,
+std::vector<std::set<int> > computeAdditionalFacePoints(const cpgrid::CellToPointTable& globalCell2Points,
                                                         const OrientedEntityTable<0, 1>& globalCell2Faces,
                                                         const Opm::SparseTable<int>& globalFace2Points,
                                                         const LevelGlobalIdSet& globalIds)
@@ -1394,7 +1460,7 @@ std::vector<std::set<int> > computeAdditionalFacePoints(const std::vector<std::a
 
 template<bool send, class Map2Global, class Map2Local>
 void createInterfaceList(const typename CpGridData::InterfaceMap::value_type& procCellLists,
-                         const std::vector<std::array<int,8> >& cell2Points,
+                         const cpgrid::CellToPointTable& cell2Points,
                          const std::vector<std::set<int> >& additionalPoints,
                          const Map2Global& local2Global,
                          Map2Local& map2Local,
@@ -1437,11 +1503,11 @@ void createInterfaceList(const typename CpGridData::InterfaceMap::value_type& pr
 }
 
 std::map<int,int> computeCell2Point(const CpGrid& grid,
-                                    const std::vector<std::array<int,8> >& globalCell2Points,
+                                    const cpgrid::CellToPointTable& globalCell2Points,
                                     const LevelGlobalIdSet& globalIds,
                                     const OrientedEntityTable<0, 1>& globalCell2Faces,
                                     const Opm::SparseTable<int>& globalFace2Points,
-                                    std::vector<std::array<int,8> >& cell2Points,
+                                    cpgrid::CellToPointTable& cell2Points,
                                     std::vector<int>& map2Global,
                                     std::size_t noCells,
                                     const typename CpGridData::InterfaceMap& cellInterfaces,
@@ -1694,7 +1760,7 @@ void CpGridData::computeCommunicationInterfaces([[maybe_unused]] int noExistingP
     std::vector<std::map<int,char> >().swap(face_attributes);
     */
     std::vector<std::map<int,char> > point_attributes(noExistingPoints);
-    AttributeDataHandle<std::vector<std::array<int,8> > >
+    AttributeDataHandle<cpgrid::CellToPointTable>
         point_handle(ccobj_.rank(), *partition_type_indicator_,
                      point_attributes, cell_to_point_, *this);
     if( static_cast<const Dune::Interface&>(std::get<All_All_Interface>(cell_interfaces_))
@@ -2348,7 +2414,7 @@ CpGridData::refineSingleCell(const std::array<int,3>& cells_per_dim, const int&
     std::shared_ptr<CpGridData> refined_grid_ptr = std::make_shared<CpGridData>(refined_data); // ccobj_
     auto& refined_grid = *refined_grid_ptr;
     DefaultGeometryPolicy& refined_geometries = refined_grid.geometry_;
-    std::vector<std::array<int,8>>& refined_cell_to_point = refined_grid.cell_to_point_;
+    cpgrid::CellToPointTable& refined_cell_to_point = refined_grid.cell_to_point_;
     cpgrid::OrientedEntityTable<0,1>& refined_cell_to_face = refined_grid.cell_to_face_;
     Opm::SparseTable<int>& refined_face_to_point = refined_grid.face_to_point_;
     cpgrid::OrientedEntityTable<1,0>& refined_face_to_cell = refined_grid.face_to_cell_;
@@ -2487,7 +2553,7 @@ CpGridData::refinePatch(const std::array<int,3>& cells_per_dim, const std::array
     std::shared_ptr<CpGridData> refined_grid_ptr = std::make_shared<CpGridData>(refined_data); // ccobj_
     auto& refined_grid = *refined_grid_ptr;
     DefaultGeometryPolicy& refined_geometries = refined_grid.geometry_;
-    std::vector<std::array<int,8>>& refined_cell_to_point = refined_grid.cell_to_point_;
+    cpgrid::CellToPointTable& refined_cell_to_point = refined_grid.cell_to_point_;
     cpgrid::OrientedEntityTable<0,1>& refined_cell_to_face = refined_grid.cell_to_face_;
     Opm::SparseTable<int>& refined_face_to_point = refined_grid.face_to_point_;
     cpgrid::OrientedEntityTable<1,0>& refined_face_to_cell = refined_grid.face_to_cell_;
@@ -71,7 +71,11 @@
 #include "Geometry.hpp"
 
 #include <array>
+#include <cstddef>
+#include <cstdint>
 #include <initializer_list>
+#include <iosfwd>
+#include <optional>
 #include <set>
 #include <vector>
 
@@ -90,6 +94,7 @@ class IndexSet;
 class IdSet;
 class LevelGlobalIdSet;
 class PartitionTypeIndicator;
+class VtuWriter;
 template<int,int> class Geometry;
 template<int> class Entity;
 template<int> class EntityRep;
@@ -142,6 +147,7 @@ class CpGridData
     friend class Dune::cpgrid::IndexSet;
     friend class Dune::cpgrid::IdSet;
     friend class Dune::cpgrid::LevelGlobalIdSet;
+    friend class Dune::cpgrid::VtuWriter;
 
     friend
     void ::refine_and_check(const Dune::cpgrid::Geometry<3, 3>&,
@@ -213,6 +219,22 @@ public:
     /// number of leaf entities per codim in this process
     int size(int codim) const;
 
+    /// \brief Free the topology and geometry, keeping the number of cells
+    /// and points, the global cell ids and the id and partition type
+    /// information.
+    ///
+    /// Meant for the global view on the root rank once the grid has been
+    /// distributed. Entities of the released grid still have valid
+    /// indices, so scattering and gathering data keeps working, but any
+    /// topology or geometry query is invalid.
+    void releaseTopologyAndGeometry();
+
+    /// \brief Whether releaseTopologyAndGeometry() has been called.
+    bool topologyAndGeometryReleased() const
+    {
+        return released_sizes_.has_value();
+    }
+
     /// number of leaf entities per geometry type in this process
     int size (GeometryType type) const
     {
@@ -634,6 +656,12 @@ public:
         }
     }
 
+    /// Move the per-entity arrays to memory first touched by num_threads
+    /// OpenMP threads, using the static partition of ElementChunks with
+    /// num_threads chunks for cells and equally sized blocks for faces and
+    /// points. \see CpGrid::firstTouch()
+    void firstTouch(int num_threads);
+
     /// Return the internalized zcorn copy from the grid processing, if
     /// no cells were adjusted during the minpvprocessing this can be
     /// and empty vector.
@@ -641,6 +669,52 @@ public:
         return zcorn;
     }
 
+    /// \name Non-owning views of the storage, for kernels looping over
+    /// raw arrays. \see Opm::UgGridHelpers::GridArrays
+    /// \{
+
+    /// Positions of the first face of each cell in the cell to face table,
+    /// size(0) + 1 entries.
+    const int* cellFacePos() const
+    {
+        return cell_to_face_.rowStarts();
+    }
+
+    /// Vertices of all faces, those of face f starting at
+    /// faceVertexPos()[f].
+    const int* faceVertices() const
+    {
+        return face_to_point_.tableData();
+    }
+
+    /// Positions of the first vertex of each face in faceVertices(),
+    /// number of faces + 1 entries.
+    const int* faceVertexPos() const
+    {
+        return face_to_point_.rowStarts();
+    }
+
+    /// Centroids of the entities of codimension codim (0, 1 or 3), the
+    /// coordinates of entity i starting at
+    /// centroids<codim>() + i*centroidStride<codim>().
+    template <int codim>
+    const double* centroids() const
+    {
+        const auto& geoms = geomVector<codim>();
+        return geoms.empty() ? nullptr : &geoms.get(0).center()[0];
+    }
+
+    /// Distance in doubles between consecutive centroids<codim>().
+    template <int codim>
+    static constexpr std::size_t centroidStride()
+    {
+        static_assert(sizeof(Geometry<3 - codim, 3>) % sizeof(double) == 0,
+                      "Geometries must be a whole number of doubles apart");
+        return sizeof(Geometry<3 - codim, 3>) / sizeof(double);
+    }
+
+    /// \}
+
 
     /// Get the index set. This is the lead as well as th level index set.
     /// \return The index set.
@@ -676,6 +750,25 @@ public:
                               const CpGridData& view_data,
                               const std::vector<int>& cell_part);
 
+    /// \brief Write the distributed grid data of this process to a checkpoint.
+    ///
+    /// Writes the local topology, geometry, global ids and the cell index
+    /// set. Collective: all processes of the communicator have to call it.
+    /// \param out The binary stream of this process.
+    /// \return The hash of the grid data of all processes.
+    std::uint64_t writeCheckpoint(std::ostream& out) const;
+
+    /// \brief Set up distributed grid data from a checkpoint of this process.
+    ///
+    /// The checkpoint has to have been written with the same number of
+    /// processes and by the same rank. Partition types, remote indices and
+    /// communication interfaces are recomputed locally. Collective: throws
+    /// on all processes if any of the checkpoints is invalid or the
+    /// checkpoints are not from the same grid.
+    /// \param in The binary stream of this process.
+    /// \return The hash of the grid data of all processes.
+    std::uint64_t readCheckpoint(std::istream& in);
+
     /// \brief communicate objects for all codims on a given level
     /// \param data The data handle describing the data. Has to adhere to the
     /// Dune::DataHandleIF interface.
@@ -839,7 +932,7 @@ private:
                          DefaultGeometryPolicy& geometry,
                          std::vector<int>& aquiferCells,
                          const OrientedEntityTable<0, 1>& cell2Faces,
-                         const std::vector< std::array<int,8> >& cell2Points);
+                         const cpgrid::CellToPointTable& cell2Points);
 
     // Representing the topology
     /** @brief Container for lookup of the faces attached to each cell. */
@@ -855,7 +948,7 @@ private:
     /** @brief Container for the lookup of the points for each face. */
     Opm::SparseTable<int>             face_to_point_;
     /** @brief Vector that contains an arrays of the points of each cell*/
-    std::vector< std::array<int,8> >       cell_to_point_;
+    cpgrid::CellToPointTable          cell_to_point_;
     /** @brief The size of the underlying logical cartesian grid.
      *
      * In a Eclipse a cornerpoint grid has the same number of cells
@@ -931,6 +1024,9 @@ private:
     /// \brief Sorted vector of aquifer cell indices.
     std::vector<int> aquifer_cells_;
 
+    /// \brief Number of cells and points before releaseTopologyAndGeometry().
+    std::optional<std::array<int,2>> released_sizes_;
+
 #if HAVE_MPI
 
     /// \brief OwnerOverlap communication for cells
@@ -18,11 +18,14 @@
 */
 
 #include <opm/grid/cpgrid/CpGridUtilities.hpp>
+#include <opm/grid/common/CommunicationUtils.hpp>
 #include <opm/grid/cpgrid/LevelCartesianIndexMapper.hpp>
 
 #include <algorithm>
 #include <array>
+#include <exception>
 #include <limits>
+#include <numeric>
 #include <stdexcept>
 #include <string>
 #include <tuple>
@@ -67,11 +70,47 @@ lgrIJK(const Dune::CpGrid& grid, const std::string& lgr_name)
     return std::make_pair(lgrCartesianIdxToCellIdx, lgrIJK);
 }
 
+std::pair<Opm::CartesianToCompressedMap, std::vector<std::array<int, 3>>>
+lgrIJKWithCompressedMap(const Dune::CpGrid& grid, const std::string& lgr_name)
+{
+    // Check if lgr_name exists in lgr_names_
+    const auto& lgr_names = grid.getLgrNameToLevel();
+    auto it = lgr_names.find(lgr_name);
+    if (it == lgr_names.end()) {
+        OPM_THROW(std::runtime_error, "LGR name not found: " + lgr_name);
+    }
+
+    const auto level = it->second;
+    const Opm::LevelCartesianIndexMapper<Dune::CpGrid> levelCartMapper(grid);
+    const auto& cellIdxToLgrCartesianIdx = grid.currentData()[level]->globalCell();
+    const int numCells = cellIdxToLgrCartesianIdx.size();
+
+    std::vector<std::array<int, 3>> lgrIJK(numCells);
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for (int cellIndex = 0; cellIndex < numCells; ++cellIndex) {
+        levelCartMapper.cartesianCoordinate(cellIndex, lgrIJK[cellIndex], level);
+    }
+
+    // Active cells of the level only, inactive parent cells have no entry.
+    Opm::CartesianToCompressedMap lgrCartesianIdxToCellIdx(levelCartMapper.cartesianSize(level),
+                                                           numCells,
+                                                           cellIdxToLgrCartesianIdx.data());
+
+    return std::make_pair(std::move(lgrCartesianIdxToCellIdx), std::move(lgrIJK));
+}
+
+namespace
+{
+
+/// lgrCOORDandZCORN() for either kind of map from Cartesian to cell indices.
+template<class CartesianToCellMap>
 std::pair<std::vector<double>, std::vector<double>>
-lgrCOORDandZCORN(const Dune::CpGrid& grid,
-                 int level,
-                 const std::unordered_map<int, int>&  lgrCartesianIdxToCellIdx,
-                 const std::vector<std::array<int, 3>>& lgrIJK)
+lgrCOORDandZCORNImpl(const Dune::CpGrid& grid,
+                     int level,
+                     const CartesianToCellMap& lgrCartesianIdxToCellIdx,
+                     const std::vector<std::array<int, 3>>& lgrIJK)
 {
     const auto& levelGrid = *(grid.currentData()[level]);
 
@@ -179,6 +218,281 @@ lgrCOORDandZCORN(const Dune::CpGrid& grid,
     return std::make_pair(lgrCOORD, lgrZCORN);
 }
 
+} // anonymous namespace
+
+std::pair<std::vector<double>, std::vector<double>>
+lgrCOORDandZCORN(const Dune::CpGrid& grid,
+                 int level,
+                 const std::unordered_map<int, int>& lgrCartesianIdxToCellIdx,
+                 const std::vector<std::array<int, 3>>& lgrIJK)
+{
+    return lgrCOORDandZCORNImpl(grid, level, lgrCartesianIdxToCellIdx, lgrIJK);
+}
+
+std::pair<std::vector<double>, std::vector<double>>
+lgrCOORDandZCORN(const Dune::CpGrid& grid,
+                 int level,
+                 const Opm::CartesianToCompressedMap& lgrCartesianIdxToCellIdx,
+                 const std::vector<std::array<int, 3>>& lgrIJK)
+{
+    return lgrCOORDandZCORNImpl(grid, level, lgrCartesianIdxToCellIdx, lgrIJK);
+}
+
+namespace
+{
+
+/// The entries of a chunk set by one process, with a priority each.
+struct ChunkContribution
+{
+    std::vector<int> indexAndPriority;
+    std::vector<double> values;
+
+    void add(int index, int priority, double value)
+    {
+        indexAndPriority.push_back(index);
+        indexAndPriority.push_back(priority);
+        values.push_back(value);
+    }
+
+    void clear()
+    {
+        indexAndPriority.clear();
+        values.clear();
+    }
+};
+
+/// Gathers the contributions of all processes to a chunk on rank 0. Of several values
+/// for an entry the one with the highest priority wins, entries without any value are
+/// inactive. The chunk is only written on rank 0.
+template<class Comm>
+void mergeOnRoot(const Comm& comm, const ChunkContribution& local, std::vector<double>& chunk)
+{
+    const auto indexAndPriority = Opm::gatherv(local.indexAndPriority, comm, 0).first;
+    const auto values = Opm::gatherv(local.values, comm, 0).first;
+    if (comm.rank() != 0) {
+        return;
+    }
+    std::fill(chunk.begin(), chunk.end(), std::numeric_limits<double>::max());
+    std::vector<int> best(chunk.size(), -1);
+    for (std::size_t e = 0; e < values.size(); ++e) {
+        const int index = indexAndPriority[2*e];
+        const int priority = indexAndPriority[2*e + 1];
+        if (priority > best[index]) {
+            best[index] = priority;
+            chunk[index] = values[e];
+        }
+    }
+}
+
+/// Streams COORD and ZCORN of one level grid, see streamCOORDandZCORN().
+void streamLevelCOORDandZCORN(const Dune::CpGrid& grid,
+                              int level,
+                              bool distributed,
+                              const CornerPointSink& sink)
+{
+    const auto& levelGrid = *(grid.currentData()[level]);
+    const auto& comm = grid.comm();
+    const bool callSink = !distributed || comm.rank() == 0;
+    constexpr double inactive = std::numeric_limits<double>::max();
+
+    const auto& lgr_dim = levelGrid.logicalCartesianSize();
+    const int nx = lgr_dim[0];
+    const int ny = lgr_dim[1];
+    const int nz = lgr_dim[2];
+    const int numCells = levelGrid.size(0);
+
+    // Cells sorted by layer k (counting sort), and per cell column (i, j) the
+    // min/max k and the cells there. Initialized as {nz, -1} to detect inactive
+    // cell columns.
+    std::vector<int> layerStart(nz + 1, 0);
+    std::vector<int> minK(nx*ny, nz);
+    std::vector<int> maxK(nx*ny, -1);
+    std::vector<int> bottomCell(nx*ny, -1);
+    std::vector<int> topCell(nx*ny, -1);
+    std::array<int, 3> ijk;
+    for (int cell = 0; cell < numCells; ++cell) {
+        levelGrid.getIJK(cell, ijk);
+        ++layerStart[ijk[2] + 1];
+        const int cell_pillar_idx = ijk[1] * nx + ijk[0];
+        if (ijk[2] < minK[cell_pillar_idx]) {
+            minK[cell_pillar_idx] = ijk[2];
+            bottomCell[cell_pillar_idx] = cell;
+        }
+        if (ijk[2] > maxK[cell_pillar_idx]) {
+            maxK[cell_pillar_idx] = ijk[2];
+            topCell[cell_pillar_idx] = cell;
+        }
+    }
+    std::partial_sum(layerStart.begin(), layerStart.end(), layerStart.begin());
+    std::vector<int> cellsByLayer(numCells);
+    {
+        auto next = layerStart;
+        for (int cell = 0; cell < numCells; ++cell) {
+            levelGrid.getIJK(cell, ijk);
+            cellsByLayer[next[ijk[2]]++] = cell;
+        }
+    }
+
+    if (distributed) {
+        // The bottom and top cells of a column are the ones of the whole grid.
+        // Only the processes that have them contribute their corners.
+        auto globalMinK = minK;
+        auto globalMaxK = maxK;
+        comm.min(globalMinK.data(), globalMinK.size());
+        comm.max(globalMaxK.data(), globalMaxK.size());
+        for (int col = 0; col < nx*ny; ++col) {
+            if (minK[col] != globalMinK[col]) {
+                bottomCell[col] = -1;
+            }
+            if (maxK[col] != globalMaxK[col]) {
+                topCell[col] = -1;
+            }
+        }
+        minK.swap(globalMinK);
+        maxK.swap(globalMaxK);
+    }
+
+    // Serially the values are written to the chunk directly. On a distributed grid
+    // each process sends only the values it sets to rank 0, where the one with the
+    // highest priority wins.
+    ChunkContribution contribution;
+    auto set = [&](std::vector<double>& chunk, int index, int priority, double value)
+    {
+        if (distributed) {
+            contribution.add(index, priority, value);
+        } else {
+            chunk[index] = value;
+        }
+    };
+    auto emit = [&](CornerPointArray array, std::size_t offset, std::vector<double>& chunk)
+    {
+        if (distributed) {
+            mergeOnRoot(comm, contribution, chunk);
+            contribution.clear();
+        }
+        if (callSink) {
+            sink(level, array, offset, chunk.data(), chunk.size());
+        }
+    };
+
+    // COORD, one row of pillars at a time. Pillar (i,j) gets all its values from the
+    // last active one of the cell columns (i-1,j-1), (i,j-1), (i-1,j), (i,j), as in
+    // lgrCOORDandZCORN(), hence the column index is the priority. The top and bottom
+    // points of a column may come from different processes. See processPillars() for
+    // the corners used.
+    std::vector<double> coord(6*(nx+1));
+    for (int pillar_j = 0; pillar_j <= ny; ++pillar_j) {
+        std::fill(coord.begin(), coord.end(), inactive);
+        for (int j = std::max(pillar_j - 1, 0); j <= std::min(pillar_j, ny - 1); ++j) {
+            for (int i = 0; i < nx; ++i) {
+                const int cell_pillar_idx = (j*nx) + i;
+                if (minK[cell_pillar_idx] == nz) {
+                    continue; // no active pillar at (i,j)
+                }
+                for (int positionIdx = 0; positionIdx < 4; ++positionIdx) {
+                    if (j + positionIdx / 2 != pillar_j) {
+                        continue;
+                    }
+                    const int pillar = 6*(i + positionIdx % 2);
+                    const int top = topCell[cell_pillar_idx];
+                    const int bottom = bottomCell[cell_pillar_idx];
+                    if (top >= 0) {
+                        const auto top_point = Dune::cpgrid::Entity<0>(levelGrid, top, true)
+                            .subEntity<3>(4 + positionIdx).geometry().center();
+                        for (int d = 0; d < 3; ++d) {
+                            set(coord, pillar + d, cell_pillar_idx, top_point[d]);
+                        }
+                    }
+                    if (bottom >= 0) {
+                        const auto bottom_point = Dune::cpgrid::Entity<0>(levelGrid, bottom, true)
+                            .subEntity<3>(positionIdx).geometry().center();
+                        for (int d = 0; d < 3; ++d) {
+                            set(coord, pillar + 3 + d, cell_pillar_idx, bottom_point[d]);
+                        }
+                    }
+                }
+            }
+        }
+        emit(CornerPointArray::COORD, std::size_t(pillar_j) * coord.size(), coord);
+    }
+
+    // ZCORN, one layer of cells at a time, starting with the top layer nz-1. Within a
+    // layer the top corners (4-7) come before the bottom corners (0-3). Every entry
+    // belongs to one cell, which only its owner sends.
+    std::vector<double> zcorn(8*nx*ny);
+    for (int k = nz - 1; k >= 0; --k) {
+        std::fill(zcorn.begin(), zcorn.end(), inactive);
+        for (int c = layerStart[k]; c < layerStart[k + 1]; ++c) {
+            const int cell = cellsByLayer[c];
+            const Dune::cpgrid::Entity<0> elem(levelGrid, cell, true);
+            if (distributed && elem.partitionType() != Dune::InteriorEntity) {
+                continue;
+            }
+            levelGrid.getIJK(cell, ijk);
+            const int top_00_idx = (ijk[1]*4*nx) + (2*ijk[0]);
+            const int bottom_00_idx = top_00_idx + (4*nx*ny);
+            const std::array<int, 4> offsets = {0, 1, 2*nx, 2*nx + 1};
+            for (int corner = 0; corner < 4; ++corner) {
+                set(zcorn, top_00_idx + offsets[corner], 0, elem.subEntity<3>(4 + corner).geometry().center()[2]);
+                set(zcorn, bottom_00_idx + offsets[corner], 0, elem.subEntity<3>(corner).geometry().center()[2]);
+            }
+        }
+        emit(CornerPointArray::ZCORN, std::size_t(nz - 1 - k) * zcorn.size(), zcorn);
+    }
+}
+
+} // anonymous namespace
+
+void streamCOORDandZCORN(const Dune::CpGrid& grid,
+                         const std::vector<int>& levels,
+                         const CornerPointSink& sink)
+{
+    const auto& comm = grid.comm();
+    const bool distributed = comm.size() > 1;
+
+    for (const int level : levels) {
+        if (level < 0 || level > grid.maxLevel()) {
+            OPM_THROW(std::invalid_argument, "Level " + std::to_string(level) + " does not exist.\n");
+        }
+        int numCells = grid.currentData()[level]->size(0);
+        if (distributed) {
+            numCells = comm.sum(numCells);
+        }
+        if (numCells == 0) {
+            OPM_THROW(std::logic_error, "LGR in level " + std::to_string(level) + " has no active cells.\n");
+        }
+    }
+
+    if (distributed) {
+        // Every chunk is gathered, so all processes go through the levels in the same order.
+        for (const int level : levels) {
+            streamLevelCOORDandZCORN(grid, level, true, sink);
+        }
+        return;
+    }
+
+    std::exception_ptr error;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (std::size_t l = 0; l < levels.size(); ++l) {
+        try {
+            streamLevelCOORDandZCORN(grid, levels[l], false, sink);
+        }
+        catch (...) {
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
 void setPillarCoordinates(int i, int j, int nx,
                           int topCorner, int bottomCorner, int positionIdx,
                           const Dune::cpgrid::Entity<0>& topElem,
@@ -21,6 +21,12 @@
 #define OPM_CPGRIDUTILITIES_HEADER_INCLUDED
 
 #include <opm/grid/CpGrid.hpp>
+#include <opm/grid/utility/CartesianToCompressedMap.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
+#include <vector>
 
 namespace Opm
 {
@@ -35,9 +41,16 @@ namespace Opm
 /// @return A pair containing:
 ///   - A std::unordered_map<int, int> mapping Cartesian indices back to cell indices (handles inactive parent cells).
 ///   - A std::vector<std::array<int, 3>> storing the (i, j, k) Cartesian coordinates for active cells.
+/// @deprecated Use lgrIJKWithCompressedMap(), which avoids the hash map.
+[[deprecated("Use lgrIJKWithCompressedMap()")]]
 std::pair<std::unordered_map<int, int>, std::vector<std::array<int, 3>>>
 lgrIJK(const Dune::CpGrid& grid, const std::string& lgr_name);
 
+/// @brief Same as lgrIJK(), but with the map from Cartesian to cell indices as a
+///        CartesianToCompressedMap (dense array or bitmap, O(1) lookup), and computed in parallel.
+std::pair<Opm::CartesianToCompressedMap, std::vector<std::array<int, 3>>>
+lgrIJKWithCompressedMap(const Dune::CpGrid& grid, const std::string& lgr_name);
+
 /// @brief Extracts the COORD and ZCORN values for the LGR (Local Grid Refinement) block.
 ///
 /// COORD: This retrieves a vector of std::array<double, 6>, where each element represents
@@ -59,12 +72,53 @@ lgrIJK(const Dune::CpGrid& grid, const std::string& lgr_name);
 /// @return A pair containing:
 ///    - A std::vector<double> storing the coordinate values for each pillar.
 ///    - A std::vector<double> storing the depth of each corner point of the LGR pillars.
+/// @deprecated Use the overload taking the CartesianToCompressedMap of lgrIJKWithCompressedMap().
+[[deprecated("Use lgrIJKWithCompressedMap() and the overload taking its CartesianToCompressedMap")]]
 std::pair<std::vector<double>, std::vector<double>>
 lgrCOORDandZCORN(const Dune::CpGrid& grid,
                  int level,
                  const std::unordered_map<int, int>& lgrCartesianIdxToCellIdx,
                  const std::vector<std::array<int, 3>>& lgrIJK);
 
+/// @brief Same as above, with the map from lgrIJKWithCompressedMap().
+std::pair<std::vector<double>, std::vector<double>>
+lgrCOORDandZCORN(const Dune::CpGrid& grid,
+                 int level,
+                 const Opm::CartesianToCompressedMap& lgrCartesianIdxToCellIdx,
+                 const std::vector<std::array<int, 3>>& lgrIJK);
+
+/// @brief The corner-point arrays of a level grid.
+enum class CornerPointArray { COORD, ZCORN };
+
+/// @brief Receives consecutive chunks of the COORD or ZCORN array of a level grid.
+///
+/// Arguments: the level, the array, the offset of the chunk in the array, a pointer
+/// to the values of the chunk and their number.
+using CornerPointSink = std::function<void(int, CornerPointArray, std::size_t, const double*, std::size_t)>;
+
+/// @brief Streams the COORD and ZCORN values of level grids to a sink.
+///
+/// Produces the same values as lgrCOORDandZCORN(), without building the complete arrays
+/// or a map from Cartesian indices to cells. For each level, the COORD array is passed
+/// to the sink one row of pillars at a time, followed by the ZCORN array one layer of
+/// cells at a time, both in ascending order of offsets. Besides one chunk, the memory
+/// used is proportional to the number of cell columns plus one integer per cell.
+///
+/// Without MPI parallelism, the levels are processed in parallel with OpenMP. The sink
+/// is then called concurrently for different levels, but never for the same level.
+///
+/// On a distributed grid, every process sends only the values it sets, from its interior
+/// cells and the bottom and top cells of columns, to rank 0, which merges them with the
+/// same precedence as lgrCOORDandZCORN() and is the only one calling the sink. The call
+/// is collective.
+///
+/// @param [in] grid
+/// @param [in] levels The levels to process. Each of them needs at least one active cell.
+/// @param [in] sink Receives the values.
+void streamCOORDandZCORN(const Dune::CpGrid& grid,
+                         const std::vector<int>& levels,
+                         const CornerPointSink& sink);
+
 /// @brief Sets the coordinates for a pillar.
 ///
 /// This function calculates the pillar index based on the given (i, j) position
@@ -70,6 +70,8 @@ namespace Dune
 
 //#include <opm/core/utility/SparseTable.hpp>
 #include <opm/common/ErrorMacros.hpp>
+#include <opm/grid/utility/firstTouch.hpp>
+#include <array>
 #include <climits>
 #include <vector>
 
@@ -215,13 +217,13 @@ namespace Dune
         /// @tparam T A value type for the variable,
         /// such as double for pressure etc.
         template <typename T>
-        class EntityVariableBase : private std::vector<T>
+        class EntityVariableBase : private std::vector<T, Opm::FirstTouchAllocator<T>>
         {
             friend class CpGridData;
         public:
-            typedef std::vector<T> V;
-            typedef typename std::vector<T>::iterator iterator;
-            typedef typename std::vector<T>::const_iterator const_iterator;
+            typedef std::vector<T, Opm::FirstTouchAllocator<T>> V;
+            typedef typename V::iterator iterator;
+            typedef typename V::const_iterator const_iterator;
 
             using V::empty;
             using V::size;
@@ -322,6 +324,11 @@ namespace Dune
         };
 
 
+        /// @brief The corner (point) indices of each cell, in the
+        /// order of CpGridData::cell_to_point_.
+        typedef std::vector<std::array<int,8>, Opm::FirstTouchAllocator<std::array<int,8>>> CellToPointTable;
+
+
     } // namespace cpgrid
 } // namespace Dune
 
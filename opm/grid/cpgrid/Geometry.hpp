@@ -38,6 +38,7 @@
 #define OPM_GEOMETRY_HEADER
 
 #include <cmath>
+#include <functional>
 
 // Warning suppression for Dune includes.
 #include <opm/grid/utility/platform_dependent/disable_warnings.h>
@@ -519,6 +520,17 @@ namespace Dune
                 vol_ = volume;
             }
 
+            /// @brief Redirect the corner indices after the array they point
+            ///        into has been copied to [new_begin, ...).
+            ///        Corner indices outside [old_begin, old_end) are kept.
+            void relocateCornerIndices(const int* old_begin, const int* old_end, const int* new_begin)
+            {
+                const std::less<const int*> less;
+                if (cor_idx_ && !less(cor_idx_, old_begin) && less(cor_idx_, old_end)) {
+                    cor_idx_ = new_begin + (cor_idx_ - old_begin);
+                }
+            }
+
             /// Returns the centroid of the geometry.
             const GlobalCoordinate& center() const
             {
@@ -616,7 +628,7 @@ namespace Dune
             typedef Dune::FieldVector<double,3> PointType;
             void refineCellifiedPatch(const std::array<int,3>& cells_per_dim,
                                       DefaultGeometryPolicy& all_geom,
-                                      std::vector<std::array<int,8>>&  refined_cell_to_point,
+                                      cpgrid::CellToPointTable&  refined_cell_to_point,
                                       cpgrid::OrientedEntityTable<0,1>& refined_cell_to_face,
                                       Opm::SparseTable<int>& refined_face_to_point,
                                       cpgrid::OrientedEntityTable<1,0>& refined_face_to_cell,
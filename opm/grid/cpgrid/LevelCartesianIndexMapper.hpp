@@ -36,6 +36,12 @@
 
 #include <opm/grid/common/LevelCartesianIndexMapper.hpp>
 #include <opm/grid/CpGrid.hpp>
+#include <opm/grid/utility/CartesianToCompressedMap.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 namespace Dune
 {
@@ -86,9 +92,45 @@ public:
         grid_->currentData()[level]->getIJK( compressedElementIndexOnLevel, coordsOnLevel);
     }
 
+    /// Compressed index on the given level of a cell in the level's local Cartesian grid, or -1 if inactive.
+    int compressedIndex(const int cartesianIndex, const int level) const
+    {
+        return cartesianToCompressed(level)[cartesianIndex];
+    }
+
+    /// Inverse of cartesianIndex(., level), cached per level. Rebuilt when CpGrid::generation()
+    /// has changed. Concurrent calls are safe, as long as the grid is not modified meanwhile.
+    const CartesianToCompressedMap& cartesianToCompressed(const int level) const
+    {
+        validLevel(level);
+        std::lock_guard<std::mutex> lock(*inverseMutex_);
+        if (static_cast<int>(inverse_.size()) <= level) {
+            inverse_.resize(level + 1);
+        }
+        const auto generation = grid_->generation();
+        auto& cached = inverse_[level];
+        if (!cached.map || cached.generation != generation) {
+            const auto& globalCell = grid_->currentData()[level]->globalCell();
+            cached.map = std::make_shared<const CartesianToCompressedMap>(cartesianSize(level),
+                                                                          globalCell.size(),
+                                                                          globalCell.data());
+            cached.generation = generation;
+        }
+        return *cached.map;
+    }
+
 private:
     const Dune::CpGrid* grid_;
 
+    struct CachedInverse
+    {
+        std::shared_ptr<const CartesianToCompressedMap> map;
+        std::uint64_t generation = 0;
+    };
+    mutable std::vector<CachedInverse> inverse_;
+    // Shared by copies, which share the grid.
+    std::shared_ptr<std::mutex> inverseMutex_ = std::make_shared<std::mutex>();
+
     int computeCartesianSize(int level) const
     {
         int size = cartesianDimensions(level)[ 0 ];
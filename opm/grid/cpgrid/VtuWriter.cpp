@@ -0,0 +1,392 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+#include "VtuWriter.hpp"
+
+#include <opm/grid/CpGrid.hpp>
+#include <opm/grid/cpgrid/CpGridData.hpp>
+#include <opm/grid/cpgrid/Entity.hpp>
+#include <opm/grid/cpgrid/PartitionTypeIndicator.hpp>
+
+#include <opm/common/ErrorMacros.hpp>
+
+#if HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <stdexcept>
+
+namespace
+{
+
+/// Receives the raw bytes of a data array in chunks.
+using ByteSink = std::function<void(const char*, std::size_t)>;
+
+/// A data array of the appended data section.
+struct AppendedArray
+{
+    std::string type;
+    std::string name;
+    int components;
+    std::uint64_t bytes;
+    /// Produces the raw bytes of the array into a sink.
+    std::function<void(const ByteSink&)> produce;
+};
+
+/// Creates an array with count values of type T, where value(i) is
+/// the i-th value. The values are produced in chunks, so that the
+/// array never exists in memory as a whole.
+template<class T, class Value>
+AppendedArray makeArray(const std::string& type, const std::string& name, int components,
+                        std::size_t count, Value value)
+{
+    return { type, name, components, count * sizeof(T),
+             [count, value](const ByteSink& sink)
+             {
+                 constexpr std::size_t chunk = 8192;
+                 T buffer[chunk];
+                 for (std::size_t begin = 0; begin < count; begin += chunk) {
+                     const std::size_t end = std::min(count, begin + chunk);
+                     for (std::size_t i = begin; i < end; ++i) {
+                         buffer[i - begin] = value(i);
+                     }
+                     sink(reinterpret_cast<const char*>(buffer), (end - begin) * sizeof(T));
+                 }
+             } };
+}
+
+/// An appended array as stored in the file: a header with the byte
+/// counts followed by the (possibly compressed) bytes.
+struct EncodedArray
+{
+    std::vector<std::uint64_t> header;
+    std::vector<char> compressed;
+    /// Number of bytes of the array in the file, including the header.
+    std::uint64_t size;
+};
+
+EncodedArray encode(const AppendedArray& array, bool compress)
+{
+    EncodedArray encoded;
+    if (!compress) {
+        encoded.header.push_back(array.bytes);
+        encoded.size = sizeof(std::uint64_t) + array.bytes;
+        return encoded;
+    }
+#if HAVE_ZLIB
+    // Block size of the vtkZLibDataCompressor format.
+    constexpr std::size_t compressionBlockSize = 1 << 15;
+    // Header: number of blocks, block size, size of the last block and
+    // the compressed size of each block.
+    const std::uint64_t blocks = (array.bytes + compressionBlockSize - 1) / compressionBlockSize;
+    encoded.header = { blocks, compressionBlockSize,
+                       array.bytes % compressionBlockSize == 0 && blocks > 0
+                       ? compressionBlockSize : array.bytes % compressionBlockSize };
+    std::vector<char> block;
+    block.reserve(compressionBlockSize);
+    auto flush = [&encoded, &block]()
+    {
+        uLongf size = compressBound(block.size());
+        const std::size_t start = encoded.compressed.size();
+        encoded.compressed.resize(start + size);
+        if (compress2(reinterpret_cast<Bytef*>(encoded.compressed.data() + start), &size,
+                      reinterpret_cast<const Bytef*>(block.data()), block.size(),
+                      Z_DEFAULT_COMPRESSION) != Z_OK) {
+            OPM_THROW(std::runtime_error, "Compressing VTU data failed");
+        }
+        encoded.compressed.resize(start + size);
+        encoded.header.push_back(size);
+        block.clear();
+    };
+    array.produce([&block, &flush](const char* bytes, std::size_t size)
+    {
+        while (size > 0) {
+            const std::size_t n = std::min(size, compressionBlockSize - block.size());
+            block.insert(block.end(), bytes, bytes + n);
+            bytes += n;
+            size -= n;
+            if (block.size() == compressionBlockSize) {
+                flush();
+            }
+        }
+    });
+    if (!block.empty()) {
+        flush();
+    }
+    encoded.size = encoded.header.size() * sizeof(std::uint64_t) + encoded.compressed.size();
+    return encoded;
+#else
+    OPM_THROW(std::logic_error, "VTU compression needs zlib support");
+#endif
+}
+
+const char* byteOrder()
+{
+    const std::uint16_t one = 1;
+    char first;
+    std::memcpy(&first, &one, 1);
+    return first == 1 ? "LittleEndian" : "BigEndian";
+}
+
+void writeDataArray(std::ostream& out, const AppendedArray& array, std::uint64_t offset,
+                    const std::string& indent)
+{
+    out << indent << "<DataArray type=\"" << array.type << "\"";
+    if (!array.name.empty()) {
+        out << " Name=\"" << array.name << "\"";
+    }
+    out << " NumberOfComponents=\"" << array.components << "\" format=\"appended\" offset=\""
+        << offset << "\"/>\n";
+}
+
+void writePDataArrays(std::ostream& out, const std::vector<AppendedArray>& arrays,
+                      std::size_t begin, std::size_t end, const std::string& indent)
+{
+    for (std::size_t a = begin; a < end; ++a) {
+        out << indent << "<PDataArray type=\"" << arrays[a].type << "\"";
+        if (!arrays[a].name.empty()) {
+            out << " Name=\"" << arrays[a].name << "\"";
+        }
+        out << " NumberOfComponents=\"" << arrays[a].components << "\"/>\n";
+    }
+}
+
+std::string pieceName(const std::string& basename, int rank)
+{
+    return basename + "-p" + std::to_string(rank) + ".vtu";
+}
+
+const Dune::cpgrid::CpGridData& viewData(const Dune::CpGrid& grid, int level)
+{
+    if (level > grid.maxLevel()) {
+        OPM_THROW(std::invalid_argument, "Level " + std::to_string(level) + " does not exist in the grid");
+    }
+    return level < 0 ? *grid.currentData().back() : *grid.currentData()[level];
+}
+
+} // anonymous namespace
+
+namespace Dune
+{
+namespace cpgrid
+{
+
+VtuWriter::VtuWriter(const CpGrid& grid, int level, bool compress)
+    : data_(viewData(grid, level)),
+      compress_(compress)
+{
+#if !HAVE_ZLIB
+    if (compress_) {
+        OPM_THROW(std::logic_error, "VTU compression needs zlib support");
+    }
+#endif
+}
+
+void VtuWriter::addCellData(const std::vector<double>& values, const std::string& name, int components)
+{
+    if (values.size() != static_cast<std::size_t>(data_.size(0) * components)) {
+        OPM_THROW(std::invalid_argument, "Cell data " + name + " has " + std::to_string(values.size())
+                  + " values, expected " + std::to_string(data_.size(0) * components));
+    }
+    cell_data_.push_back({ &values, name, components });
+}
+
+void VtuWriter::addPointData(const std::vector<double>& values, const std::string& name, int components)
+{
+    if (values.size() != static_cast<std::size_t>(data_.size(3) * components)) {
+        OPM_THROW(std::invalid_argument, "Point data " + name + " has " + std::to_string(values.size())
+                  + " values, expected " + std::to_string(data_.size(3) * components));
+    }
+    point_data_.push_back({ &values, name, components });
+}
+
+std::string VtuWriter::write(const std::string& basename) const
+{
+    const int rank = data_.ccobj_.rank();
+    const bool parallel = data_.ccobj_.size() > 1;
+
+    // In parallel only the interior cells are written, so that every
+    // cell is in exactly one piece. The points are renumbered to the ones
+    // used by these cells.
+    const int num_cells = data_.size(0);
+    std::vector<int> cells;
+    cells.reserve(num_cells);
+    for (int c = 0; c < num_cells; ++c) {
+        if (!parallel
+            || data_.partition_type_indicator_->getPartitionType(Entity<0>(data_, c, true)) == InteriorEntity) {
+            cells.push_back(c);
+        }
+    }
+    std::vector<int> point_map(data_.size(3), -1);
+    std::vector<int> points;
+    for (const int c : cells) {
+        for (const int p : data_.cell_to_point_[c]) {
+            if (point_map[p] < 0) {
+                point_map[p] = points.size();
+                points.push_back(p);
+            }
+        }
+    }
+
+    // Corner p of a VTK hexahedron is corner vtk_corner[p] of the cell.
+    static constexpr int vtk_corner[8] = { 0, 1, 3, 2, 4, 5, 7, 6 };
+    const auto& point_geometry = data_.geometry_.geomVector<3>();
+    const auto& cell_to_point = data_.cell_to_point_;
+
+    std::vector<AppendedArray> arrays;
+    for (const auto& d : point_data_) {
+        arrays.push_back(makeArray<double>("Float64", d.name, d.components, points.size() * d.components,
+                                           [&points, d](std::size_t i)
+                                           {
+                                               return (*d.values)[points[i / d.components] * d.components
+                                                                  + i % d.components];
+                                           }));
+    }
+    const std::size_t num_point_arrays = arrays.size();
+    for (const auto& d : cell_data_) {
+        arrays.push_back(makeArray<double>("Float64", d.name, d.components, cells.size() * d.components,
+                                           [&cells, d](std::size_t i)
+                                           {
+                                               return (*d.values)[cells[i / d.components] * d.components
+                                                                  + i % d.components];
+                                           }));
+    }
+    const std::size_t num_data_arrays = arrays.size();
+    arrays.push_back(makeArray<double>("Float64", "", 3, 3 * points.size(),
+                                       [&points, &point_geometry](std::size_t i)
+                                       {
+                                           return point_geometry.get(points[i / 3]).center()[i % 3];
+                                       }));
+    arrays.push_back(makeArray<std::int32_t>("Int32", "connectivity", 1, 8 * cells.size(),
+                                             [&cells, &cell_to_point, &point_map](std::size_t i)
+                                             {
+                                                 return point_map[cell_to_point[cells[i / 8]][vtk_corner[i % 8]]];
+                                             }));
+    arrays.push_back(makeArray<std::int64_t>("Int64", "offsets", 1, cells.size(),
+                                             [](std::size_t i) { return std::int64_t(8 * (i + 1)); }));
+    arrays.push_back(makeArray<std::uint8_t>("UInt8", "types", 1, cells.size(),
+                                             [](std::size_t) { return std::uint8_t(12); })); // VTK_HEXAHEDRON
+
+    // Compressed arrays have to be compressed before their offsets are
+    // known. Uncompressed ones are streamed into the file below.
+    std::vector<EncodedArray> encoded;
+    std::vector<std::uint64_t> offsets;
+    std::uint64_t offset = 0;
+    for (const auto& array : arrays) {
+        encoded.push_back(encode(array, compress_));
+        offsets.push_back(offset);
+        offset += encoded.back().size;
+    }
+
+    const std::string header_attributes = std::string(" version=\"1.0\" byte_order=\"") + byteOrder()
+        + "\" header_type=\"UInt64\"" + (compress_ ? " compressor=\"vtkZLibDataCompressor\"" : "");
+
+    const std::string filename = parallel ? pieceName(basename, rank) : basename + ".vtu";
+    std::ofstream out(filename, std::ios::binary);
+    if (!out) {
+        OPM_THROW(std::runtime_error, "Could not open " + filename + " for writing");
+    }
+    out << "<?xml version=\"1.0\"?>\n"
+        << "<VTKFile type=\"UnstructuredGrid\"" << header_attributes << ">\n"
+        << "  <UnstructuredGrid>\n"
+        << "    <Piece NumberOfPoints=\"" << points.size() << "\" NumberOfCells=\"" << cells.size() << "\">\n"
+        << "      <PointData>\n";
+    for (std::size_t a = 0; a < num_point_arrays; ++a) {
+        writeDataArray(out, arrays[a], offsets[a], "        ");
+    }
+    out << "      </PointData>\n"
+        << "      <CellData>\n";
+    for (std::size_t a = num_point_arrays; a < num_data_arrays; ++a) {
+        writeDataArray(out, arrays[a], offsets[a], "        ");
+    }
+    out << "      </CellData>\n"
+        << "      <Points>\n";
+    writeDataArray(out, arrays[num_data_arrays], offsets[num_data_arrays], "        ");
+    out << "      </Points>\n"
+        << "      <Cells>\n";
+    for (std::size_t a = num_data_arrays + 1; a < arrays.size(); ++a) {
+        writeDataArray(out, arrays[a], offsets[a], "        ");
+    }
+    out << "      </Cells>\n"
+        << "    </Piece>\n"
+        << "  </UnstructuredGrid>\n"
+        << "  <AppendedData encoding=\"raw\">\n"
+        << "   _";
+    for (std::size_t a = 0; a < arrays.size(); ++a) {
+        out.write(reinterpret_cast<const char*>(encoded[a].header.data()),
+                  encoded[a].header.size() * sizeof(std::uint64_t));
+        if (compress_) {
+            out.write(encoded[a].compressed.data(), encoded[a].compressed.size());
+        } else {
+            arrays[a].produce([&out](const char* bytes, std::size_t size) { out.write(bytes, size); });
+        }
+    }
+    out << "\n  </AppendedData>\n"
+        << "</VTKFile>\n";
+    if (!out) {
+        OPM_THROW(std::runtime_error, "Writing " + filename + " failed");
+    }
+
+    if (!parallel) {
+        return filename;
+    }
+
+    // The index of all pieces. The pieces are referenced relative to it.
+    const std::string pvtu_name = basename + ".pvtu";
+    if (rank == 0) {
+        const auto slash = basename.find_last_of('/');
+        const std::string piece_base = slash == std::string::npos ? basename : basename.substr(slash + 1);
+        std::ofstream pvtu(pvtu_name);
+        if (!pvtu) {
+            OPM_THROW(std::runtime_error, "Could not open " + pvtu_name + " for writing");
+        }
+        pvtu << "<?xml version=\"1.0\"?>\n"
+             << "<VTKFile type=\"PUnstructuredGrid\"" << header_attributes << ">\n"
+             << "  <PUnstructuredGrid GhostLevel=\"0\">\n"
+             << "    <PPointData>\n";
+        writePDataArrays(pvtu, arrays, 0, num_point_arrays, "      ");
+        pvtu << "    </PPointData>\n"
+             << "    <PCellData>\n";
+        writePDataArrays(pvtu, arrays, num_point_arrays, num_data_arrays, "      ");
+        pvtu << "    </PCellData>\n"
+             << "    <PPoints>\n";
+        writePDataArrays(pvtu, arrays, num_data_arrays, num_data_arrays + 1, "      ");
+        pvtu << "    </PPoints>\n";
+        for (int r = 0; r < data_.ccobj_.size(); ++r) {
+            pvtu << "    <Piece Source=\"" << pieceName(piece_base, r) << "\"/>\n";
+        }
+        pvtu << "  </PUnstructuredGrid>\n"
+             << "</VTKFile>\n";
+        if (!pvtu) {
+            OPM_THROW(std::runtime_error, "Writing " + pvtu_name + " failed");
+        }
+    }
+    return pvtu_name;
+}
+
+} // namespace cpgrid
+} // namespace Dune
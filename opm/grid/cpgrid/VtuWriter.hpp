@@ -0,0 +1,92 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef OPM_CPGRID_VTUWRITER_HEADER
+#define OPM_CPGRID_VTUWRITER_HEADER
+
+#include <string>
+#include <vector>
+
+namespace Dune
+{
+class CpGrid;
+
+namespace cpgrid
+{
+class CpGridData;
+
+/// \brief Writes a CpGrid view as VTK unstructured grid with raw binary
+/// appended data.
+///
+/// The cells are written as hexahedra straight from the cell corners of
+/// the grid data, without going through the Dune entity interface. In a
+/// parallel run every process writes the interior cells it owns to its
+/// own piece <basename>-p<rank>.vtu without any communication, and rank 0
+/// additionally writes the <basename>.pvtu index of all pieces. In a
+/// serial run only <basename>.vtu is written.
+///
+/// Data arrays are stored by reference, as with Dune::VTKWriter, and
+/// have to stay alive until write() has returned.
+class VtuWriter
+{
+public:
+    /// \brief Create a writer for a view of the grid.
+    /// \param grid The grid.
+    /// \param level The refinement level to write, -1 for the leaf view.
+    /// \param compress Whether to compress the data arrays with zlib.
+    ///                 Needs zlib support, otherwise write() throws.
+    explicit VtuWriter(const CpGrid& grid, int level = -1, bool compress = false);
+
+    /// \brief Add an array with values for all cells of the view.
+    /// \param values The values, components of a cell are consecutive.
+    /// \param name The name of the array in the file.
+    /// \param components The number of components per cell.
+    void addCellData(const std::vector<double>& values, const std::string& name,
+                     int components = 1);
+
+    /// \brief Add an array with values for all points of the view.
+    /// \param values The values, components of a point are consecutive.
+    /// \param name The name of the array in the file.
+    /// \param components The number of components per point.
+    void addPointData(const std::vector<double>& values, const std::string& name,
+                      int components = 1);
+
+    /// \brief Write the files of this process.
+    /// \param basename The name of the files without extension.
+    /// \return The name of the file to open, the .pvtu index in a
+    ///         parallel run and the .vtu file otherwise.
+    std::string write(const std::string& basename) const;
+
+private:
+    struct DataArray
+    {
+        const std::vector<double>* values;
+        std::string name;
+        int components;
+    };
+
+    const CpGridData& data_;
+    bool compress_;
+    std::vector<DataArray> cell_data_;
+    std::vector<DataArray> point_data_;
+};
+
+} // namespace cpgrid
+} // namespace Dune
+
+#endif // OPM_CPGRID_VTUWRITER_HEADER
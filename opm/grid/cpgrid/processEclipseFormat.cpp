@@ -100,11 +100,11 @@ namespace Dune
                        cpgrid::OrientedEntityTable<0, 1>& c2f,
                        cpgrid::OrientedEntityTable<1, 0>& f2c,
                        Opm::SparseTable<int>& f2p,
-                       std::vector<std::array<int,8> >& c2p,
+                       cpgrid::CellToPointTable& c2p,
                        std::vector<int>& face_to_output_face);
         void buildGeom(const processed_grid& output,
                        const cpgrid::OrientedEntityTable<0, 1>& c2f,
-                       const std::vector<std::array<int,8> >& c2p,
+                       const cpgrid::CellToPointTable& c2p,
                        const std::vector<int>& face_to_output_face,
                        const std::unordered_map<size_t, double>& aquifer_cell_volumes,
                        cpgrid::EntityVariable<cpgrid::Geometry<3, 3>, 0>& cell_geom,
@@ -1108,7 +1108,7 @@ namespace cpgrid
                        cpgrid::OrientedEntityTable<0, 1>& c2f,
                        cpgrid::OrientedEntityTable<1, 0>& f2c,
                        Opm::SparseTable<int>& f2p,
-                       std::vector<std::array<int,8> >& c2p,
+                       cpgrid::CellToPointTable& c2p,
                        std::vector<int>& face_to_output_face)
         {
             // Map local to global cell index.
@@ -1241,7 +1241,7 @@ namespace cpgrid
 
         void buildGeom(const processed_grid& output,
                        const cpgrid::OrientedEntityTable<0, 1>& c2f,
-                       const std::vector<std::array<int,8> >& c2p,
+                       const cpgrid::CellToPointTable& c2p,
                        const std::vector<int>& face_to_output_face,
                        const std::unordered_map<size_t, double>& aquifer_cell_volumes,
                        cpgrid::EntityVariable<cpgrid::Geometry<3, 3>, 0>& cell_geom,
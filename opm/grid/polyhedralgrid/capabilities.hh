@@ -49,7 +49,8 @@ namespace Dune
     template< int dim, int dimworld, class coord_t, int codim >
     struct canCommunicate< PolyhedralGrid< dim, dimworld, coord_t >, codim >
     {
-        static const bool v = false;
+        // data is only communicated for cells and vertices
+        static const bool v = (codim == 0 || codim == dim);
     };
 
 
@@ -0,0 +1,69 @@
+// -*- mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=2 sw=2 sts=2:
+#ifndef DUNE_POLYHEDRALGRID_ENTITY2INDEXDATAHANDLE_HH
+#define DUNE_POLYHEDRALGRID_ENTITY2INDEXDATAHANDLE_HH
+
+#include <cstddef>
+
+namespace Dune
+{
+
+  // PolyhedralGridEntity2IndexDataHandle
+  // ------------------------------------
+
+  /** \brief wrapper that turns a dune-grid data handle into one based on
+   *         entity indices, as required by VariableSizeCommunicator
+   *
+   *  \tparam  Grid        the PolyhedralGrid type
+   *  \tparam  DataHandle  data handle following Dune::CommDataHandleIF
+   *  \tparam  codim       codimension of the communicated entities
+   */
+  template< class Grid, class DataHandle, int codim >
+  class PolyhedralGridEntity2IndexDataHandle
+  {
+    typedef typename Grid::Traits::template Codim< codim >::EntityImpl EntityImpl;
+    typedef typename Grid::Traits::template Codim< codim >::EntitySeed EntitySeed;
+    typedef typename Grid::Traits::template Codim< codim >::Entity Entity;
+
+  public:
+    typedef typename DataHandle::DataType DataType;
+
+    PolyhedralGridEntity2IndexDataHandle ( const Grid& grid, DataHandle& data )
+    : grid_( grid ), data_( data )
+    {}
+
+    bool fixedSize ()
+    {
+      return data_.fixedSize( Grid::dimension, codim );
+    }
+
+    std::size_t size ( std::size_t i )
+    {
+      return data_.size( entity( i ) );
+    }
+
+    template< class B >
+    void gather ( B& buffer, std::size_t i )
+    {
+      data_.gather( buffer, entity( i ) );
+    }
+
+    template< class B >
+    void scatter ( B& buffer, std::size_t i, std::size_t s )
+    {
+      data_.scatter( buffer, entity( i ), s );
+    }
+
+  private:
+    Entity entity ( std::size_t i ) const
+    {
+      return Entity( EntityImpl( grid_.extraData(), EntitySeed( i ) ) );
+    }
+
+    const Grid& grid_;
+    DataHandle& data_;
+  };
+
+} // namespace Dune
+
+#endif // #ifndef DUNE_POLYHEDRALGRID_ENTITY2INDEXDATAHANDLE_HH
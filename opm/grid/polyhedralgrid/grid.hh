@@ -3,7 +3,11 @@
 #ifndef DUNE_POLYHEDRALGRID_GRID_HH
 #define DUNE_POLYHEDRALGRID_GRID_HH
 
+#include <algorithm>
+#include <array>
+#include <map>
 #include <set>
+#include <tuple>
 #include <vector>
 
 // Warning suppression for Dune includes.
@@ -17,11 +21,15 @@
 #include <dune/grid/common/grid.hh>
 
 #include <dune/common/parallel/communication.hh>
+#if HAVE_MPI
+#include <dune/common/parallel/variablesizecommunicator.hh>
+#endif
 
 //- polyhedralgrid includes
 #include <opm/grid/polyhedralgrid/capabilities.hh>
 #include <opm/grid/polyhedralgrid/declaration.hh>
 #include <opm/grid/polyhedralgrid/entity.hh>
+#include <opm/grid/polyhedralgrid/entity2indexdatahandle.hh>
 #include <opm/grid/polyhedralgrid/entityseed.hh>
 #include <opm/grid/polyhedralgrid/geometry.hh>
 #include <opm/grid/polyhedralgrid/gridview.hh>
@@ -36,8 +44,12 @@
 #include <opm/grid/cart_grid.h>
 #include <opm/grid/cpgpreprocess/preprocess.h>
 #include <opm/grid/GridManager.hpp>
+#include <opm/grid/common/UnstructuredGridPartitioning.hpp>
 #include <opm/grid/cornerpoint_grid.h>
 #include <opm/grid/MinpvProcessor.hpp>
+extern "C" {
+#include <opm/grid/cpgpreprocess/geometry.h>
+}
 
 #if HAVE_ECL_INPUT
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
@@ -177,6 +189,42 @@ namespace Dune
   public:
     typedef std::unique_ptr< UnstructuredGridType, UnstructuredGridDeleter > UnstructuredGridPtr;
 
+    /** \brief caller-owned topology and geometry arrays wrapped by
+     *         PolyhedralGrid( const ExternalGridArrays& )
+     *
+     *  The layout of each array is the one of the corresponding
+     *  UnstructuredGrid field. Coordinates, normals and centroids have
+     *  dimworld components.
+     */
+    struct ExternalGridArrays
+    {
+      int numCells = 0;
+      int numFaces = 0;
+      int numNodes = 0;
+
+      // topology, required
+      int* faceNodes = nullptr;
+      grid_size_t* faceNodePos = nullptr;
+      int* faceCells = nullptr;
+      int* cellFaces = nullptr;
+      grid_size_t* cellFacePos = nullptr;
+      double* nodeCoordinates = nullptr;
+
+      // optional
+      int* cellFaceTag = nullptr;
+      int* globalCell = nullptr;
+      std::array< int, 3 > cartDims = {{ 0, 0, 0 }};
+
+      // optional face geometry, used only if all three are given
+      double* faceCentroids = nullptr;
+      double* faceNormals = nullptr;
+      double* faceAreas = nullptr;
+
+      // optional cell geometry, used only if both are given
+      double* cellCentroids = nullptr;
+      double* cellVolumes = nullptr;
+    };
+
     static UnstructuredGridPtr
     allocateGrid ( std::size_t nCells, std::size_t nFaces, std::size_t nFaceNodes, std::size_t nCellFaces, std::size_t nNodes )
     {
@@ -393,6 +441,39 @@ namespace Dune
       init();
     }
 
+    /** \brief constructor wrapping caller-owned arrays without copying
+     *
+     *  The arrays are referenced, not copied, and must remain valid until the
+     *  grid is destroyed. Geometry that is not supplied is computed into
+     *  buffers owned by the grid.
+     *
+     *  \note As for the other constructors the grid initialization writes to
+     *        the topology: faceCells is reoriented and boundary faces are
+     *        marked with negative segment numbers, and for 2d grids with face
+     *        tags the second and third face of each cell are swapped.
+     *
+     *  \param[in]  arrays  description of the caller-owned arrays
+     */
+    explicit PolyhedralGrid ( const ExternalGridArrays& arrays )
+    : gridPtr_(),
+      grid_( wrapExternalArrays( arrays ) ),
+      comm_( MPIHelper::getCommunicator() ),
+      leafIndexSet_( *this ),
+      globalIdSet_( *this ),
+      localIdSet_( *this ),
+      nBndSegments_( 0 )
+    {
+      init();
+    }
+
+    ~PolyhedralGrid ()
+    {
+#if HAVE_MPI
+      freeInterfaces( cellInterfaces_ );
+      freeInterfaces( vertexInterfaces_ );
+#endif
+    }
+
     /** \} */
 
     /** \name Casting operators
@@ -612,9 +693,9 @@ namespace Dune
      *
      *  \param[in]  codim  codimension for with the information is desired
      */
-    int overlapSize ( int /* codim */) const
+    int overlapSize ( int codim ) const
     {
-      return 0;
+      return (codim == 0) ? overlapLayers_ : 0;
     }
 
     /** \brief obtain size of ghost region for the leaf grid
@@ -631,9 +712,9 @@ namespace Dune
      *  \param[in]  level  grid level (0, ..., maxLevel())
      *  \param[in]  codim  codimension (0, ..., dimension)
      */
-    int overlapSize ( int /* level */, int /* codim */ ) const
+    int overlapSize ( int /* level */, int codim ) const
     {
-      return 0;
+      return overlapSize( codim );
     }
 
     /** \brief obtain size of ghost region for a grid level
@@ -660,12 +741,12 @@ namespace Dune
      *  \param[in]  level       grid level to communicate
      */
     template< class DataHandle>
-    void communicate ( DataHandle& /* dataHandle */,
-                       InterfaceType /* interface */,
-                       CommunicationDirection /* direction */,
+    void communicate ( DataHandle& dataHandle,
+                       InterfaceType interface,
+                       CommunicationDirection direction,
                        int /* level */ ) const
     {
-        OPM_THROW(std::runtime_error, "communicate not implemented for polyhedreal grid!");
+      communicate( dataHandle, interface, direction );
     }
 
     /** \brief communicate information on leaf entities
@@ -679,13 +760,34 @@ namespace Dune
      *                          All_All_Interface)
      *  \param[in]  direction   communication direction (one of
      *                          ForwardCommunication, BackwardCommunication)
+     *
+     *  \note Only cells and vertices are communicated. Nothing happens
+     *        unless the grid has been distributed by loadBalance().
      */
     template< class DataHandle>
-    void communicate ( DataHandle& /* dataHandle */,
-                       InterfaceType /* interface */,
-                       CommunicationDirection /* direction */ ) const
+    void communicate ( DataHandle& dataHandle,
+                       InterfaceType interface,
+                       CommunicationDirection direction ) const
     {
-        OPM_THROW(std::runtime_error, "communicate not implemented for polyhedreal grid!");
+#if HAVE_MPI
+      if( !isDistributed() )
+        return;
+
+      if( dataHandle.contains( dim, 0 ) )
+      {
+        PolyhedralGridEntity2IndexDataHandle< Grid, DataHandle, 0 > wrapper( *this, dataHandle );
+        communicateCodim( wrapper, direction, getInterface( interface, cellInterfaces_ ) );
+      }
+      if( dataHandle.contains( dim, dim ) )
+      {
+        PolyhedralGridEntity2IndexDataHandle< Grid, DataHandle, dim > wrapper( *this, dataHandle );
+        communicateCodim( wrapper, direction, getInterface( interface, vertexInterfaces_ ) );
+      }
+#else
+      (void) dataHandle;
+      (void) interface;
+      (void) direction;
+#endif
     }
 
     /// \brief Switch to the global view.
@@ -715,18 +817,99 @@ namespace Dune
 
     // data handle interface different between geo and interface
 
-    /** \brief rebalance the load each process has to handle
+    /** \brief distribute the grid over all processes
      *
-     *  A parallel grid is redistributed such that each process has about
-     *  the same load (e.g., the same number of leaf entites).
+     *  The grid of rank 0 is partitioned there (using Zoltan or METIS if
+     *  available) and each process receives its interior cells plus
+     *  \em overlapLayers layers of overlap cells, see
+     *  Opm::distributeUnstructuredGrid(). The grids held by the other
+     *  processes are not used and may be empty.
+     *  The grid must own its UnstructuredGrid, which on return is replaced
+     *  by the local part, while the previous one is released.
      *
-     *  \note DUNE does not specify, how the load is measured.
+     *  Faces between a local cell and a cell on another process are boundary
+     *  intersections on the local grid.
+     *
+     *  \param[in]  overlapLayers  number of overlap cell layers
      *
      *  \returns \b true, if the grid has changed.
      */
-    bool loadBalance ()
+    bool loadBalance ( int overlapLayers = 1 )
+    {
+      if( comm_.size() == 1 )
+        return false;
+
+      if( !gridPtr_ )
+        OPM_THROW(std::logic_error, "loadBalance requires a PolyhedralGrid that owns its UnstructuredGrid!");
+      if( isDistributed() )
+        OPM_THROW(std::logic_error, "PolyhedralGrid has already been distributed!");
+
+#if HAVE_MPI
+      auto local = Opm::distributeUnstructuredGrid( comm_.rank() == 0 ? &grid_ : nullptr,
+                                                    overlapLayers, comm_, 0 );
+
+      // grid_ refers to *gridPtr_, so exchange the contents and release the
+      // previous (global) grid right away
+      std::swap( *gridPtr_, *local.grid );
+      local.grid.reset();
+
+      globalSizes_[ 0 ] = local.global_sizes[ 0 ];
+      globalSizes_[ 1 ] = local.global_sizes[ 1 ];
+      globalSizes_[ dim ] = local.global_sizes[ 2 ];
+
+      globalIndices_.assign( dim+1, std::vector< int >() );
+      globalIndices_[ 0 ].swap( local.global_cell );
+      globalIndices_[ 1 ].swap( local.global_face );
+      globalIndices_[ dim ].swap( local.global_node );
+
+      partitionTypes_.assign( dim+1, std::vector< PartitionType >() );
+      partitionTypes_[ 0 ].swap( local.cell_partition_type );
+      partitionTypes_[ 1 ].swap( local.face_partition_type );
+      partitionTypes_[ dim ].swap( local.node_partition_type );
+
+      overlapLayers_ = overlapLayers;
+
+      // the local grid is cut from the initialized global grid, so its 2d
+      // faces are already in reference element order
+      cellVertices_.clear();
+      geomTypes_.clear();
+      initEntities();
+      globalIdSet_.update();
+      localIdSet_.update();
+
+      buildInterfaces( local.shared_cells, cellInterfaces_ );
+      buildInterfaces( local.shared_nodes, vertexInterfaces_ );
+      return true;
+#else
+      (void) overlapLayers;
+      return false;
+#endif
+    }
+
+    /** \brief return true if the grid has been distributed by loadBalance() */
+    bool isDistributed () const
     {
-      return false ;
+      return !globalIndices_.empty();
+    }
+
+    /** \brief number of entities of the given codimension in the global grid */
+    int globalSize ( int codim ) const
+    {
+      return isDistributed() ? globalSizes_[ codim ] : size( codim );
+    }
+
+    /** \brief index of a local entity in the global grid */
+    int globalIndex ( int codim, int index ) const
+    {
+      return isDistributed() ? globalIndices_[ codim ][ index ] : index;
+    }
+
+    /** \brief partition type of the entity with the given seed */
+    template <class EntitySeed>
+    PartitionType partitionType ( const EntitySeed& seed ) const
+    {
+      return isDistributed() ? partitionTypes_[ EntitySeed::codimension ][ seed.index() ]
+                             : InteriorEntity;
     }
 
     /** \brief rebalance the load each process has to handle
@@ -961,6 +1144,70 @@ namespace Dune
         return cgrid;
     }
 
+    const UnstructuredGridType& wrapExternalArrays ( const ExternalGridArrays& arrays )
+    {
+      if( !arrays.faceNodes || !arrays.faceNodePos || !arrays.faceCells ||
+          !arrays.cellFaces || !arrays.cellFacePos || !arrays.nodeCoordinates )
+        DUNE_THROW( GridError, "Topology arrays and node coordinates are required to wrap a grid" );
+
+      UnstructuredGridType& g = wrappedGrid_;
+      g.dimensions       = dimworld;
+      g.number_of_cells  = arrays.numCells;
+      g.number_of_faces  = arrays.numFaces;
+      g.number_of_nodes  = arrays.numNodes;
+      g.face_nodes       = arrays.faceNodes;
+      g.face_nodepos     = arrays.faceNodePos;
+      g.face_cells       = arrays.faceCells;
+      g.cell_faces       = arrays.cellFaces;
+      g.cell_facepos     = arrays.cellFacePos;
+      g.cell_facetag     = arrays.cellFaceTag;
+      g.node_coordinates = arrays.nodeCoordinates;
+      g.global_cell      = arrays.globalCell;
+      std::copy( arrays.cartDims.begin(), arrays.cartDims.end(), g.cartdims );
+
+      const bool hasFaceGeometry = arrays.faceCentroids && arrays.faceNormals && arrays.faceAreas;
+      const bool hasCellGeometry = arrays.cellCentroids && arrays.cellVolumes;
+
+      const std::size_t nf = arrays.numFaces;
+      const std::size_t nc = arrays.numCells;
+      wrappedGeometry_.assign( ( hasFaceGeometry ? 0 : nf*( 2*dimworld + 1 ) ) +
+                               ( hasCellGeometry ? 0 : nc*( dimworld + 1 ) ), 0.0 );
+      double* buffer = wrappedGeometry_.data();
+
+      if( hasFaceGeometry )
+      {
+        g.face_centroids = arrays.faceCentroids;
+        g.face_normals   = arrays.faceNormals;
+        g.face_areas     = arrays.faceAreas;
+      }
+      else
+      {
+        g.face_centroids = buffer;  buffer += nf*dimworld;
+        g.face_normals   = buffer;  buffer += nf*dimworld;
+        g.face_areas     = buffer;  buffer += nf;
+        compute_face_geometry( g.dimensions, g.node_coordinates, g.number_of_faces,
+                               g.face_nodepos, g.face_nodes,
+                               g.face_normals, g.face_centroids, g.face_areas );
+      }
+
+      if( hasCellGeometry )
+      {
+        g.cell_centroids = arrays.cellCentroids;
+        g.cell_volumes   = arrays.cellVolumes;
+      }
+      else
+      {
+        g.cell_centroids = buffer;  buffer += nc*dimworld;
+        g.cell_volumes   = buffer;
+        compute_cell_geometry( g.dimensions, g.node_coordinates,
+                               g.face_nodepos, g.face_nodes, g.face_cells,
+                               g.face_normals, g.face_centroids,
+                               g.number_of_cells, g.cell_facepos, g.cell_faces,
+                               g.cell_centroids, g.cell_volumes );
+      }
+      return g;
+    }
+
   public:
     typedef typename Traits :: ExtraData ExtraData;
     ExtraData extraData () const  { return this; }
@@ -1318,6 +1565,27 @@ namespace Dune
 
   protected:
     void init ()
+    {
+      // for 2d Cartesian grids the face ordering is wrong
+      if( dim == 2 && grid_.cell_facetag )
+      {
+        const int numCells = size( 0 );
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for( int c = 0; c < numCells; ++c )
+        {
+          const int f = grid_.cell_facepos[ c ];
+          std::swap( grid_.cell_faces[ f+1 ], grid_.cell_faces[ f+2 ] );
+          std::swap( grid_.cell_facetag[ f+1 ], grid_.cell_facetag[ f+2 ] );
+        }
+      }
+
+      initEntities();
+    }
+
+    // set up the entity information, the topology is not modified
+    void initEntities ()
     {
       // copy Cartesian dimensions
       for( int i=0; i<3; ++i )
@@ -1333,8 +1601,11 @@ namespace Dune
       // sort vertices such that they comply with the dune reference cube
       if( grid_.cell_facetag )
       {
-        typedef std::array<int, 3> KeyType;
-        std::map< const KeyType, const int > vertexFaceTags;
+        // lookup table from the sorted face tags of a vertex (padded with
+        // 4, the first z tag, in 2d) to the vertex number of the reference cube
+        constexpr int numTags = 6;
+        std::array< int, numTags*numTags*numTags > vertexFaceTags;
+        vertexFaceTags.fill( -1 );
         const int vertexFacePattern [8][3] = {
                                 { 0, 2, 4 }, // vertex 0
                                 { 1, 2, 4 }, // vertex 1
@@ -1345,88 +1616,96 @@ namespace Dune
                                 { 0, 3, 5 }, // vertex 6
                                 { 1, 3, 5 }  // vertex 7
                                };
+        const auto keyIndex = [] ( const std::array< int, 3 >& key )
+        {
+          return ( key[ 0 ]*numTags + key[ 1 ] )*numTags + key[ 2 ];
+        };
 
         for( int i=0; i<8; ++i )
         {
-          KeyType key; key.fill( 4 ); // default is 4 which is the first z coord (for the 2d case)
+          std::array< int, 3 > key; key.fill( 4 ); // default is 4 which is the first z coord (for the 2d case)
           for( int j=0; j<dim; ++j )
           {
             key[ j ] = vertexFacePattern[ i ][ j ];
           }
 
-          vertexFaceTags.insert( std::make_pair( key, i ) );
+          // the first pattern inserted for a key wins, as for std::map::insert
+          if( vertexFaceTags[ keyIndex( key ) ] < 0 )
+            vertexFaceTags[ keyIndex( key ) ] = i;
         }
 
-        for (int c = 0; c < numCells; ++c)
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
         {
-          if( dim == 2 )
-          {
-            // for 2d Cartesian grids the face ordering is wrong
-            int f = grid_.cell_facepos[ c ];
-            std::swap( grid_.cell_faces[ f+1 ], grid_.cell_faces[ f+2 ] );
-            std::swap( grid_.cell_facetag[ f+1 ], grid_.cell_facetag[ f+2 ] );
-          }
-
-          typedef std::map<int,int> vertexmap_t;
-          typedef typename vertexmap_t :: iterator iterator;
+          // scratch space reused for all cells handled by this thread
+          std::vector< std::pair< int, int > > nodeTags;  // (node, face tag) for all face nodes
+          std::vector< std::pair< int, int > > cornerSlots; // (node, vertex number or -1)
 
-          std::vector< vertexmap_t > cell_pts( dim*2 );
-
-          for (unsigned hf = grid_.cell_facepos[ c ]; hf < grid_.cell_facepos[c+1]; ++hf)
+#ifdef _OPENMP
+#pragma omp for
+#endif
+          for (int c = 0; c < numCells; ++c)
           {
-            const int f = grid_.cell_faces[ hf ];
-            const int faceTag = grid_.cell_facetag[ hf ];
-
-            for (unsigned nodepos = grid_.face_nodepos[f]; nodepos < grid_.face_nodepos[f+1]; ++nodepos )
+            nodeTags.clear();
+            for (unsigned hf = grid_.cell_facepos[ c ]; hf < grid_.cell_facepos[c+1]; ++hf)
             {
-              const int node = grid_.face_nodes[ nodepos ];
-              iterator it = cell_pts[ faceTag ].find( node );
-              if( it == cell_pts[ faceTag ].end() )
-              {
-                 cell_pts[ faceTag ].insert( std::make_pair( node, 1 ) );
-              }
-              else
+              const int f = grid_.cell_faces[ hf ];
+              const int faceTag = grid_.cell_facetag[ hf ];
+              assert( faceTag >= 0 && faceTag < dim*2 );
+
+              for (unsigned nodepos = grid_.face_nodepos[f]; nodepos < grid_.face_nodepos[f+1]; ++nodepos )
               {
-                // increase vertex reference counter
-                (*it).second++;
+                nodeTags.emplace_back( grid_.face_nodes[ nodepos ], faceTag );
               }
             }
-          }
 
-          typedef std::map< int, std::set<int> > vertexlist_t;
-          vertexlist_t vertexList;
+            // sorting groups the references by node and, within a node, by tag
+            std::sort( nodeTags.begin(), nodeTags.end() );
 
-          for( int faceTag = 0; faceTag<dim*2; ++faceTag )
-          {
-            for( iterator it = cell_pts[ faceTag ].begin(),
-                 end = cell_pts[ faceTag ].end(); it != end; ++it )
+            // a vertex is a corner of each face tag for which it appears exactly once
+            cornerSlots.clear();
+            for( std::size_t i = 0, n = nodeTags.size(); i < n; )
             {
+              const int node = nodeTags[ i ].first;
+              std::array< int, 3 > key; key.fill( 4 ); // fill with 4 which is the first z coord
+              int numKeyTags = 0;
+              for( ; i < n && nodeTags[ i ].first == node; )
+              {
+                const int faceTag = nodeTags[ i ].second;
+                std::size_t j = i;
+                while( j < n && nodeTags[ j ] == nodeTags[ i ] )
+                  ++j;
+                if( j - i == 1 )
+                {
+                  if( numKeyTags < 3 )
+                    key[ numKeyTags ] = faceTag;
+                  ++numKeyTags;
+                }
+                i = j;
+              }
 
-              // only consider vertices with one appearance
-              if( (*it).second == 1 )
+              if( numKeyTags > 0 )
               {
-                vertexList[ (*it).first ].insert( faceTag );
+                assert( numKeyTags == dim );
+                const int vx = ( numKeyTags <= 3 ) ? vertexFaceTags[ keyIndex( key ) ] : -1;
+                assert( vx >= 0 );
+                cornerSlots.emplace_back( node, vx );
               }
             }
-          }
 
-          assert( int(vertexList.size()) == ( dim == 2 ? 4 : 8) );
+            assert( int(cornerSlots.size()) == ( dim == 2 ? 4 : 8) );
 
-          cellVertices_[ c ].resize( vertexList.size() );
-          for( auto it = vertexList.begin(), end = vertexList.end(); it != end; ++it )
-          {
-            assert( (*it).second.size() == dim );
-            KeyType key; key.fill( 4 ); // fill with 4 which is the first z coord
-
-            std::copy( (*it).second.begin(), (*it).second.end(), key.begin() );
-            auto vx = vertexFaceTags.find( key );
-            assert( vx != vertexFaceTags.end() );
-            if( vx != vertexFaceTags.end() )
+            cellVertices_[ c ].resize( cornerSlots.size() );
+            for( const auto& [ node, vx ] : cornerSlots )
             {
-              if( (*vx).second >= int(cellVertices_[ c ].size()) )
-                cellVertices_[ c ].resize( (*vx).second+1 );
-              // store node number on correct local position
-              cellVertices_[ c ][ (*vx).second ] = (*it).first ;
+              if( vx >= 0 )
+              {
+                if( vx >= int(cellVertices_[ c ].size()) )
+                  cellVertices_[ c ].resize( vx+1 );
+                // store node number on correct local position
+                cellVertices_[ c ][ vx ] = node ;
+              }
             }
           }
         }
@@ -1654,7 +1933,119 @@ namespace Dune
 
     }
 
+#if HAVE_MPI
+    // true if an entity with partition type \p type is a source (or
+    // destination) of the communication interface \p iftype
+    static bool interfaceContains ( int iftype, bool source, PartitionType type )
+    {
+      const bool interiorBorder = (type == InteriorEntity || type == BorderEntity);
+      switch( iftype )
+      {
+      case InteriorBorder_InteriorBorder_Interface:
+        return interiorBorder;
+      case InteriorBorder_All_Interface:
+        return source ? interiorBorder : true;
+      case Overlap_OverlapFront_Interface:
+        return source ? type == OverlapEntity : (type == OverlapEntity || type == FrontEntity);
+      case Overlap_All_Interface:
+        return source ? type == OverlapEntity : true;
+      default:
+        return true;
+      }
+    }
+
+    template< int iftype >
+    static void addToInterface ( const std::map< int, std::vector< Opm::SharedUnstructuredEntity > >& shared,
+                                 InterfaceTuple& interfaces )
+    {
+      InterfaceMap& interfaceMap = std::get< iftype >( interfaces );
+      for( const auto& [ rank, entities ] : shared )
+      {
+        std::size_t numSend = 0, numRecv = 0;
+        for( const auto& e : entities )
+        {
+          numSend += interfaceContains( iftype, true, e.mine ) && interfaceContains( iftype, false, e.other );
+          numRecv += interfaceContains( iftype, true, e.other ) && interfaceContains( iftype, false, e.mine );
+        }
+        if( numSend == 0 && numRecv == 0 )
+          continue;
+
+        auto& info = interfaceMap[ rank ];
+        info.first.reserve( numSend );
+        info.second.reserve( numRecv );
+        for( const auto& e : entities )
+        {
+          if( interfaceContains( iftype, true, e.mine ) && interfaceContains( iftype, false, e.other ) )
+            info.first.add( e.local );
+          if( interfaceContains( iftype, true, e.other ) && interfaceContains( iftype, false, e.mine ) )
+            info.second.add( e.local );
+        }
+      }
+    }
+
+    static void buildInterfaces ( const std::map< int, std::vector< Opm::SharedUnstructuredEntity > >& shared,
+                                  InterfaceTuple& interfaces )
+    {
+      freeInterfaces( interfaces );
+      addToInterface< InteriorBorder_InteriorBorder_Interface >( shared, interfaces );
+      addToInterface< InteriorBorder_All_Interface >( shared, interfaces );
+      addToInterface< Overlap_OverlapFront_Interface >( shared, interfaces );
+      addToInterface< Overlap_All_Interface >( shared, interfaces );
+      addToInterface< All_All_Interface >( shared, interfaces );
+    }
+
+    static void freeInterfaces ( InterfaceMap& interfaceMap )
+    {
+      for( auto& entry : interfaceMap )
+      {
+        entry.second.first.free();
+        entry.second.second.free();
+      }
+      interfaceMap.clear();
+    }
+
+    static void freeInterfaces ( InterfaceTuple& interfaces )
+    {
+      std::apply( [] ( auto&... maps ) { ( freeInterfaces( maps ), ... ); }, interfaces );
+    }
+
+    static const InterfaceMap& getInterface ( InterfaceType iftype, const InterfaceTuple& interfaces )
+    {
+      switch( iftype )
+      {
+      case InteriorBorder_InteriorBorder_Interface:
+        return std::get< InteriorBorder_InteriorBorder_Interface >( interfaces );
+      case InteriorBorder_All_Interface:
+        return std::get< InteriorBorder_All_Interface >( interfaces );
+      case Overlap_OverlapFront_Interface:
+        return std::get< Overlap_OverlapFront_Interface >( interfaces );
+      case Overlap_All_Interface:
+        return std::get< Overlap_All_Interface >( interfaces );
+      case All_All_Interface:
+        return std::get< All_All_Interface >( interfaces );
+      default:
+        OPM_THROW(std::runtime_error, "Invalid Interface type was used during communication");
+      }
+    }
+
+    template< class DataHandleWrapper >
+    void communicateCodim ( DataHandleWrapper& wrapper, CommunicationDirection direction,
+                            const InterfaceMap& interface ) const
+    {
+      Communicator communicator( comm_, interface );
+      if( direction == ForwardCommunication )
+        communicator.forward( wrapper );
+      else
+        communicator.backward( wrapper );
+    }
+#endif // HAVE_MPI
+
   protected:
+    // storage used when wrapping caller-owned arrays, declared before grid_
+    // since grid_ is bound to wrappedGrid_ in that case
+    UnstructuredGridType wrappedGrid_ {};
+    std::vector< double > wrappedGeometry_;
+
     UnstructuredGridPtr gridPtr_;
     const UnstructuredGridType& grid_;
 
@@ -1665,6 +2056,19 @@ namespace Dune
 
     std::vector< GlobalCoordinate > unitOuterNormals_;
 
+    // parallel information, only set after loadBalance()
+    std::vector< std::vector< int > > globalIndices_;
+    std::array< int, dim+1 > globalSizes_;
+    std::vector< std::vector< PartitionType > > partitionTypes_;
+    int overlapLayers_ = 0;
+#if HAVE_MPI
+    typedef Dune::VariableSizeCommunicator<> Communicator;
+    typedef typename Communicator::InterfaceMap InterfaceMap;
+    typedef std::tuple< InterfaceMap, InterfaceMap, InterfaceMap, InterfaceMap, InterfaceMap > InterfaceTuple;
+    InterfaceTuple cellInterfaces_;
+    InterfaceTuple vertexInterfaces_;
+#endif
+
     mutable LeafIndexSet leafIndexSet_;
     mutable GlobalIdSet globalIdSet_;
     mutable LocalIdSet localIdSet_;
@@ -138,10 +138,11 @@ namespace Dune
     }
 
     template< class DataHandle, class Data >
-    void communicate ( CommDataHandleIF< DataHandle, Data > /*&dataHandle*/,
-                       InterfaceType /*interface*/,
-                       CommunicationDirection /*direction*/ ) const
+    void communicate ( CommDataHandleIF< DataHandle, Data >& dataHandle,
+                       InterfaceType interface,
+                       CommunicationDirection direction ) const
     {
+      grid().communicate( dataHandle, interface, direction );
     }
 
   protected:
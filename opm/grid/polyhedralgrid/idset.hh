@@ -25,13 +25,19 @@ namespace Dune
     typedef IdSet< Grid, This, IdType > Base;
 
     explicit PolyhedralGridIdSet (const Grid& grid)
-        : grid_( grid ),
-          globalCellPtr_( grid_.globalCellPtr() )
+        : grid_( grid )
     {
+      update();
+    }
+
+    //! recompute the cached data, needed after the grid has been distributed
+    void update ()
+    {
+      globalCellPtr_ = grid_.globalCellPtr();
       codimOffset_[ 0 ] = 0;
       for( int i=1; i<=dim; ++i )
       {
-        codimOffset_[ i ] = codimOffset_[ i-1 ] + grid.size( i-1 );
+        codimOffset_[ i ] = codimOffset_[ i-1 ] + grid_.globalSize( i-1 );
       }
     }
 
@@ -45,7 +51,7 @@ namespace Dune
         return IdType( globalCellPtr_[ index ] );
       else
       {
-        return codimOffset_[ codim ] + index;
+        return codimOffset_[ codim ] + grid_.globalIndex( codim, index );
       }
     }
 
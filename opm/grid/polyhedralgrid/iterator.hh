@@ -34,19 +34,49 @@ namespace Dune
     : Base( data )
     {
       if( beginIterator )
-        entityImpl() = EntityImpl( data, EntitySeed( 0 ) );
+        findEntity( data, 0 );
     }
 
     /** \brief increment */
     void increment ()
     {
-      int index = entityImpl().seed().index();
-      ++index;
+      findEntity( entityImpl().data(), entityImpl().seed().index() + 1 );
+    }
+
+  protected:
+    /** \brief move to the first entity from \p index on that belongs to pitype */
+    void findEntity ( ExtraData data, int index )
+    {
+      const int size = data->size( codim );
+      for( ; index < size; ++index )
+      {
+        const EntitySeed seed( index );
+        if( pitype == All_Partition || contains( data->partitionType( seed ) ) )
+        {
+          entityImpl() = EntityImpl( data, seed );
+          return;
+        }
+      }
+      entityImpl() = EntityImpl( data );
+    }
 
-      if( index >= entityImpl().data()->size( codim ) )
-        entityImpl() = EntityImpl( entityImpl().data() );
-      else
-        entityImpl() = EntityImpl( entityImpl().data(), EntitySeed( index ) );
+    static bool contains ( PartitionType type )
+    {
+      switch( pitype )
+      {
+      case Interior_Partition:
+        return type == InteriorEntity;
+      case InteriorBorder_Partition:
+        return type == InteriorEntity || type == BorderEntity;
+      case Overlap_Partition:
+        return type != FrontEntity && type != GhostEntity;
+      case OverlapFront_Partition:
+        return type != GhostEntity;
+      case Ghost_Partition:
+        return type == GhostEntity;
+      default:
+        return true;
+      }
     }
   };
 
@@ -24,6 +24,12 @@
 /**
  * \file
  * Routines to assist in the calculation of two-point transmissibilities.
+ *
+ * The routines are threaded with OpenMP if available.  One-sided
+ * transmissibilities are computed cell by cell, the two-point
+ * transmissibilities face by face.  Besides UnstructuredGrid they accept
+ * Dune::CpGrid, for which they are instantiated in the library, and
+ * Opm::ImplicitCartesianGrid, which needs no stored geometry.
  */
 
 /**
@@ -102,4 +108,15 @@ tpfa_eff_trans_compute(const Grid   *G      ,
                        double       *trans );
 
 #include "TransTpfa_impl.hpp"
+
+extern template void
+tpfa_htrans_compute<Dune::CpGrid>(const Dune::CpGrid*, const double*, double*);
+
+extern template void
+tpfa_trans_compute<Dune::CpGrid>(const Dune::CpGrid*, const double*, double*);
+
+extern template void
+tpfa_eff_trans_compute<Dune::CpGrid>(const Dune::CpGrid*, const double*,
+                                     const double*, double*);
+
 #endif  /* OPM_TRANS_TPFA_HEADER_INCLUDED */
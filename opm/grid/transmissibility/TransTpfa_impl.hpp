@@ -1,8 +1,15 @@
-#include <opm/common/utility/numeric/blas_lapack.h>
 #include <opm/grid/transmissibility/trans_tpfa.h>
+#include <opm/grid/GridArrays.hpp>
 #include <opm/grid/GridHelpers.hpp>
+#include <opm/grid/ImplicitCartesianGridHelpers.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cassert>
 #include <cmath>
+#include <iterator>
+#include <type_traits>
+#include <vector>
 
 namespace Dune
 {
@@ -21,122 +28,219 @@ double faceArea(const Dune::CpGrid&, int);
 
 namespace
 {
-inline const double* multiplyFaceNormalWithArea(const Dune::CpGrid& grid, int face_index, const double* in)
+/// Write the area weighted normal of a face into out.
+inline void scaledFaceNormal(const Dune::CpGrid& grid, int face_index,
+                             const double* in, double* out)
 {
-    int d=Opm::UgGridHelpers::dimensions(grid);
-    double* out=new double[d];
-    double area=Opm::UgGridHelpers::faceArea(grid, face_index);
-    
-    for(int i=0;i<d;++i)
-        out[i]=in[i]*area;
-    return out;
+    const int d = Opm::UgGridHelpers::dimensions(grid);
+    const double area = Opm::UgGridHelpers::faceArea(grid, face_index);
+
+    for (int i = 0; i < d; ++i) {
+        out[i] = in[i] * area;
+    }
 }
 
-inline void maybeFreeFaceNormal(const Dune::CpGrid&, const double* array)
+inline void scaledFaceNormal(const UnstructuredGrid& grid, int,
+                             const double* in, double* out)
 {
-    delete[] array;
+    for (int i = 0; i < grid.dimensions; ++i) {
+        out[i] = in[i];
+    }
 }
 
-inline const double* multiplyFaceNormalWithArea(const UnstructuredGrid&, int, const double* in)
+inline void scaledFaceNormal(const Opm::UgGridHelpers::GridArrays& grid, int,
+                             const double* in, double* out)
 {
-    return in;
+    for (int i = 0; i < grid.dimensions(); ++i) {
+        out[i] = in[i];
+    }
 }
 
-inline void maybeFreeFaceNormal(const UnstructuredGrid&, const double*)
-{}
+inline void scaledFaceNormal(const Opm::ImplicitCartesianGrid&, int,
+                             const std::array<double, 3>& in, double* out)
+{
+    for (int i = 0; i < 3; ++i) {
+        out[i] = in[i];
+    }
 }
 
-/* ---------------------------------------------------------------------- */
-/* htrans <- sum(C(:,i) .* K(cellNo,:) .* N(:,j), 2) ./ sum(C.*C, 2) */
-/* ---------------------------------------------------------------------- */
+/// CpGrid is handled through GridArrays, which views the grid storage and
+/// computes the remaining arrays once in parallel, instead of going through
+/// the per-entity accessors in the loops below.
 template<class Grid>
-void
-tpfa_htrans_compute(const Grid* G, const double *perm, double *htrans)
-/* ---------------------------------------------------------------------- */
+constexpr bool tpfaUseGridArrays = std::is_same_v<Grid, Dune::CpGrid>;
+
+/// Position of the first half-face of each cell in the half-face
+/// ordering, i.e., the cell_facepos array of an UnstructuredGrid.
+template<class Grid>
+std::vector<int> tpfaHalfFacePos(const Grid& grid)
+{
+    using namespace Opm::UgGridHelpers;
+    const auto c2f = cell2Faces(grid);
+    const int nc = numCells(grid);
+
+    std::vector<int> pos(nc + 1, 0);
+    for (int c = 0; c < nc; ++c) {
+        const auto faces = c2f[c];
+        pos[c + 1] = pos[c] + std::distance(faces.begin(), faces.end());
+    }
+    return pos;
+}
+
+/// For each face f, the half-faces seen from face_cells(f, 0) and
+/// face_cells(f, 1) at positions 2*f and 2*f + 1, or -1 if the face has no
+/// neighbour on that side.  This allows the harmonic averages to be
+/// computed independently per face.  Empty if a face has the same cell on
+/// both sides, as that cell then lists the face more than once.
+template<class Grid>
+std::vector<int> tpfaFaceHalfFaces(const Grid& grid, const std::vector<int>& hfpos)
+{
+    using namespace Opm::UgGridHelpers;
+    const auto c2f = cell2Faces(grid);
+    const auto face_cells = faceCells(grid);
+    const int nc = numCells(grid);
+    const int nf = numFaces(grid);
+
+    for (int f = 0; f < nf; ++f) {
+        if (face_cells(f, 0) >= 0 && face_cells(f, 0) == face_cells(f, 1)) {
+            return {};
+        }
+    }
+
+    std::vector<int> hf(2 * nf, -1);
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for (int c = 0; c < nc; ++c) {
+        int i = hfpos[c];
+        for (const int f : c2f[c]) {
+            hf[2 * f + (face_cells(f, 0) == c ? 0 : 1)] = i++;
+        }
+    }
+    return hf;
+}
+
+/// trans[f] <- 1 / sum_i 1/(totmob[c_i] * htrans[i]) over the half-faces i
+/// of face f, with the mobility factor left out if totmob is null.  Faces
+/// are independent unless tpfaFaceHalfFaces() is unavailable, in which case
+/// the half-faces are accumulated serially.
+template<class Grid>
+void tpfaHarmonicTrans(const Grid& grid, const double* totmob,
+                       const double* htrans, double* trans)
+{
+    using namespace Opm::UgGridHelpers;
+    const int nf = numFaces(grid);
+    const auto face_cells = faceCells(grid);
+    const std::vector<int> hfpos = tpfaHalfFacePos(grid);
+    const std::vector<int> hf = tpfaFaceHalfFaces(grid, hfpos);
+
+    if (!hf.empty()) {
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (int f = 0; f < nf; f++) {
+            double t = 0.0;
+            for (int side = 0; side < 2; side++) {
+                if (hf[2*f + side] >= 0) {
+                    t += 1.0 / ((totmob ? totmob[face_cells(f, side)] : 1.0)
+                                * htrans[hf[2*f + side]]);
+                }
+            }
+            trans[f] = 1.0 / t;
+        }
+        return;
+    }
+
+    const auto c2f = cell2Faces(grid);
+    const int nc = numCells(grid);
+    std::fill(trans, trans + nf, 0.0);
+    for (int c = 0; c < nc; c++) {
+        int i = hfpos[c];
+        for (const int f : c2f[c]) {
+            trans[f] += 1.0 / ((totmob ? totmob[c] : 1.0) * htrans[i++]);
+        }
+    }
+    for (int f = 0; f < nf; f++) {
+        trans[f] = 1.0 / trans[f];
+    }
+}
+
+/// htrans <- sum(C(:,i) .* K(cellNo,:) .* N(:,j), 2) ./ sum(C.*C, 2)
+template<class Grid>
+void tpfaHalfTrans(const Grid& grid, const double* perm, double* htrans)
 {
     using namespace Opm::UgGridHelpers;
-    int    d, j;
-    double s, dist, denom;
-
-    double Kn[3];
-    typename CellCentroidTraits<Grid>::IteratorType cc = beginCellCentroids(*G);
-    typename Cell2FacesTraits<Grid>::Type c2f = cell2Faces(*G);
-    typename FaceCellTraits<Grid>::Type face_cells = faceCells(*G);
-    
-    const double *n;
-    const double *K;
-
-    MAT_SIZE_T nrows, ncols, ldA, incx, incy;
-    double a1, a2;
-
-    d = dimensions(*G);
-
-    nrows = ncols    = ldA = d;
-    incx  = incy     = 1      ;
-    a1    = 1.0;  a2 = 0.0    ;
-
-    for (int c =0, i = 0; c < numCells(*G); c++) {
-        K  = perm + (c * d * d);
-        
-        typedef typename Cell2FacesTraits<Grid>::Type::row_type FaceRow;
-        FaceRow faces = c2f[c];
-        
-        for(typename FaceRow::const_iterator f=faces.begin(), end=faces.end();
-            f!=end; ++f, ++i)
-        {
-            s = 2.0*(face_cells(*f, 0) == c) - 1.0;
-            n = faceNormal(*G, *f);
-            const double* nn=multiplyFaceNormalWithArea(*G, *f, n);
-            const double* fc = &(faceCentroid(*G, *f)[0]);
-            dgemv_("No Transpose", &nrows, &ncols,
-                   &a1, K, &ldA, nn, &incx, &a2, &Kn[0], &incy);
-            maybeFreeFaceNormal(*G, nn);
-            
-            htrans[i] = denom = 0.0;
-            for (j = 0; j < d; j++) {
-                dist = fc[j] - getCoordinate(cc, j);
-
-                htrans[i] += s * dist * Kn[j];
-                denom     +=     dist * dist;
+    const int d = dimensions(grid);
+    const int nc = numCells(grid);
+    const auto c2f = cell2Faces(grid);
+    const auto face_cells = faceCells(grid);
+    const std::vector<int> hfpos = tpfaHalfFacePos(grid);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for (int c = 0; c < nc; c++) {
+        const double* K  = perm + (c * d * d);
+        const auto cc = cellCentroid(grid, c);
+
+        int i = hfpos[c];
+        for (const int f : c2f[c]) {
+            const double s = 2.0*(face_cells(f, 0) == c) - 1.0;
+
+            double nn[3];
+            scaledFaceNormal(grid, f, faceNormal(grid, f), nn);
+            const auto fc = faceCentroid(grid, f);
+
+            // Kn <- K * nn, K stored column major.
+            double Kn[3] = { 0.0, 0.0, 0.0 };
+            for (int k = 0; k < d; k++) {
+                for (int j = 0; j < d; j++) {
+                    Kn[j] += K[j + k*d] * nn[k];
+                }
+            }
+
+            double num = 0.0, denom = 0.0;
+            for (int j = 0; j < d; j++) {
+                const double dist = fc[j] - cc[j];
+
+                num   += s * dist * Kn[j];
+                denom +=     dist * dist;
             }
 
             assert (denom > 0);
-            htrans[i] /= denom;
-            htrans[i]  = std::abs(htrans[i]);
+            htrans[i++] = std::abs(num / denom);
         }
-        // Move to next cell centroid.
-        cc = increment(cc, 1, d);
     }
 }
 
+}
 
+/* ---------------------------------------------------------------------- */
+/* htrans <- sum(C(:,i) .* K(cellNo,:) .* N(:,j), 2) ./ sum(C.*C, 2) */
 /* ---------------------------------------------------------------------- */
 template<class Grid>
 void
-tpfa_trans_compute(const Grid* G, const double *htrans, double *trans)
+tpfa_htrans_compute(const Grid* G, const double *perm, double *htrans)
 /* ---------------------------------------------------------------------- */
 {
-    using namespace Opm::UgGridHelpers;
-
-    for (int f = 0; f < numFaces(*G); f++) {
-        trans[f] = 0.0;
+    if constexpr (tpfaUseGridArrays<Grid>) {
+        tpfaHalfTrans(Opm::UgGridHelpers::GridArrays(*G), perm, htrans);
+    } else {
+        tpfaHalfTrans(*G, perm, htrans);
     }
+}
 
-    typename Cell2FacesTraits<Grid>::Type c2f = cell2Faces(*G);
 
-    for (int c = 0, i = 0; c < numCells(*G); c++) {
-        typedef typename Cell2FacesTraits<Grid>::Type::row_type FaceRow;
-        FaceRow faces = c2f[c];
-        
-        for(typename FaceRow::const_iterator f=faces.begin(), end=faces.end();
-            f!=end; ++f, ++i)
-        {
-            trans[*f] += 1.0 / htrans[i];
-        }
-    }
-
-    for (int f = 0; f < numFaces(*G); f++) {
-        trans[f] = 1.0 / trans[f];
+/* ---------------------------------------------------------------------- */
+template<class Grid>
+void
+tpfa_trans_compute(const Grid* G, const double *htrans, double *trans)
+/* ---------------------------------------------------------------------- */
+{
+    if constexpr (tpfaUseGridArrays<Grid>) {
+        tpfaHarmonicTrans(Opm::UgGridHelpers::GridArrays(*G), nullptr, htrans, trans);
+    } else {
+        tpfaHarmonicTrans(*G, nullptr, htrans, trans);
     }
 }
 
@@ -150,26 +254,9 @@ tpfa_eff_trans_compute(const Grid*        G,
                        double       *trans)
 /* ---------------------------------------------------------------------- */
 {
-    using namespace Opm::UgGridHelpers;
-
-    for (int f = 0; f < numFaces(*G); f++) {
-        trans[f] = 0.0;
-    }
-
-    typename Cell2FacesTraits<Grid>::Type c2f = cell2Faces(*G);
-
-    for (int c = 0, i = 0; c < numCells(*G); c++) {
-        typedef typename Cell2FacesTraits<Grid>::Type::row_type FaceRow;
-        FaceRow faces = c2f[c];
-        
-        for(typename FaceRow::const_iterator f=faces.begin(), end=faces.end();
-            f!=end; ++f, ++i)
-        {
-            trans[*f] += 1.0 / (totmob[c] * htrans[i]);
-        }
-    }
-
-             for (int f = 0; f < numFaces(*G); f++) {
-        trans[f] = 1.0 / trans[f];
+    if constexpr (tpfaUseGridArrays<Grid>) {
+        tpfaHarmonicTrans(Opm::UgGridHelpers::GridArrays(*G), totmob, htrans, trans);
+    } else {
+        tpfaHarmonicTrans(*G, totmob, htrans, trans);
     }
 }
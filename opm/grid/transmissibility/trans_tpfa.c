@@ -4,7 +4,6 @@
 #include <stdlib.h>
 #include <string.h>
 
-#include <opm/common/utility/numeric/blas_lapack.h>
 #include <opm/grid/transmissibility/trans_tpfa.h>
 
 
@@ -12,6 +11,107 @@
 #include "TransTpfa.hpp"
 #endif
 
+/* ---------------------------------------------------------------------- */
+/* For each face f, the half-faces seen from face_cells[2*f + 0] and
+ * face_cells[2*f + 1] at positions 2*f + 0 and 2*f + 1, or -1 if the face
+ * has no neighbour on that side.  Returns NULL on allocation failure, and
+ * if a face has the same cell on both sides, as that cell then lists the
+ * face more than once. */
+/* ---------------------------------------------------------------------- */
+static int *
+face_halffaces(const struct UnstructuredGrid *G)
+/* ---------------------------------------------------------------------- */
+{
+    int c, f, *hf;
+    unsigned i;
+
+    for (f = 0; f < G->number_of_faces; f++) {
+        if ((G->face_cells[2*f + 0] >= 0) &&
+            (G->face_cells[2*f + 0] == G->face_cells[2*f + 1])) {
+            return NULL;
+        }
+    }
+
+    hf = malloc(2 * G->number_of_faces * sizeof *hf);
+
+    if (hf != NULL) {
+        for (f = 0; f < 2 * G->number_of_faces; f++) {
+            hf[f] = -1;
+        }
+
+#ifdef _OPENMP
+#pragma omp parallel for private(f, i)
+#endif
+        for (c = 0; c < G->number_of_cells; c++) {
+            for (i = G->cell_facepos[c]; i < G->cell_facepos[c + 1]; i++) {
+                f = G->cell_faces[i];
+
+                hf[2*f + (G->face_cells[2*f + 0] != c)] = (int) i;
+            }
+        }
+    }
+
+    return hf;
+}
+
+
+/* ---------------------------------------------------------------------- */
+/* trans[f] <- 1 / sum_i 1/(totmob[c_i] * htrans[i]) over the half-faces i
+ * of face f, with the mobility factor left out if totmob is NULL. */
+/* ---------------------------------------------------------------------- */
+static void
+harmonic_trans(const struct UnstructuredGrid *G,
+               const double                  *totmob,
+               const double                  *htrans,
+               double                        *trans)
+/* ---------------------------------------------------------------------- */
+{
+    int c, f, side, *hf;
+    unsigned i;
+    double t;
+
+    hf = face_halffaces(G);
+
+    if (hf != NULL) {
+#ifdef _OPENMP
+#pragma omp parallel for private(t, side)
+#endif
+        for (f = 0; f < G->number_of_faces; f++) {
+            t = 0.0;
+            for (side = 0; side < 2; side++) {
+                if (hf[2*f + side] >= 0) {
+                    t += 1.0 / ((totmob != NULL ? totmob[G->face_cells[2*f + side]] : 1.0)
+                                * htrans[hf[2*f + side]]);
+                }
+            }
+
+            trans[f] = 1.0 / t;
+        }
+
+        free(hf);
+        return;
+    }
+
+    /* Serial accumulation over the half-faces if the face to half-face
+     * map is unavailable. */
+    for (f = 0; f < G->number_of_faces; f++) {
+        trans[f] = 0.0;
+    }
+
+    for (c = i = 0; c < G->number_of_cells; c++) {
+        for (; i < G->cell_facepos[c + 1]; i++) {
+            f = G->cell_faces[i];
+
+            trans[f] += 1.0 / ((totmob != NULL ? totmob[c] : 1.0) * htrans[i]);
+        }
+    }
+
+    for (f = 0; f < G->number_of_faces; f++) {
+        trans[f] = 1.0 / trans[f];
+    }
+}
+
+
 /* ---------------------------------------------------------------------- */
 /* htrans <- sum(C(:,i) .* K(cellNo,:) .* N(:,j), 2) ./ sum(C.*C, 2) */
 /* ---------------------------------------------------------------------- */
@@ -23,48 +123,51 @@ tpfa_htrans_compute(struct UnstructuredGrid *G, const double *perm, double *htra
     return tpfa_htrans_compute<UnstructuredGrid>(G, totmob, htrans, trans);
     #endif
     
-    int    c, d, f, j;
-    double s, dist, denom;
+    int    c, d, f, j, k;
+    double s, dist, num, denom;
     unsigned i;
 
     double Kn[3];
     const double *cc, *fc, *n;
     const double *K;
 
-    MAT_SIZE_T nrows, ncols, ldA, incx, incy;
-    double a1, a2;
-
     d = G->dimensions;
 
-    nrows = ncols    = ldA = d;
-    incx  = incy     = 1      ;
-    a1    = 1.0;  a2 = 0.0    ;
-
-    for (c = i = 0; c < G->number_of_cells; c++) {
+    /* Cells are independent; each writes its own half-faces only. */
+#ifdef _OPENMP
+#pragma omp parallel for private(f, j, k, s, dist, num, denom, i, Kn, cc, fc, n, K)
+#endif
+    for (c = 0; c < G->number_of_cells; c++) {
         K  = perm + (c * d * d);
         cc = G->cell_centroids + (c * d);
 
-        for (; i < G->cell_facepos[c + 1]; i++) {
+        for (i = G->cell_facepos[c]; i < G->cell_facepos[c + 1]; i++) {
             f = G->cell_faces[i];
             s = 2.0*(G->face_cells[2*f + 0] == c) - 1.0;
 
             n  = G->face_normals   + (f * d);
             fc = G->face_centroids + (f * d);
 
-            dgemv_("No Transpose", &nrows, &ncols,
-                   &a1, K, &ldA, n, &incx, &a2, &Kn[0], &incy);
+            /* Kn <- K * n, K stored column major. */
+            for (j = 0; j < d; j++) {
+                Kn[j] = 0.0;
+            }
+            for (k = 0; k < d; k++) {
+                for (j = 0; j < d; j++) {
+                    Kn[j] += K[j + k*d] * n[k];
+                }
+            }
 
-            htrans[i] = denom = 0.0;
+            num = denom = 0.0;
             for (j = 0; j < d; j++) {
                 dist = fc[j] - cc[j];
 
-                htrans[i] += s * dist * Kn[j];
-                denom     +=     dist * dist;
+                num   += s * dist * Kn[j];
+                denom +=     dist * dist;
             }
 
             assert (denom > 0);
-            htrans[i] /= denom;
-            htrans[i]  = fabs(htrans[i]);
+            htrans[i] = fabs(num / denom);
         }
     }
 }
@@ -79,24 +182,7 @@ tpfa_trans_compute(struct UnstructuredGrid *G, const double *htrans, double *tra
     return tpfa_trans_compute<UnstructuredGrid>(G, totmob, htrans, trans);
     #endif
     
-    int c, f;
-    unsigned i;
-
-    for (f = 0; f < G->number_of_faces; f++) {
-        trans[f] = 0.0;
-    }
-
-    for (c = i = 0; c < G->number_of_cells; c++) {
-        for (; i < G->cell_facepos[c + 1]; i++) {
-            f = G->cell_faces[i];
-
-            trans[f] += 1.0 / htrans[i];
-        }
-    }
-
-    for (f = 0; f < G->number_of_faces; f++) {
-        trans[f] = 1.0 / trans[f];
-    }
+    harmonic_trans(G, NULL, htrans, trans);
 }
 
 
@@ -112,22 +198,5 @@ tpfa_eff_trans_compute(struct UnstructuredGrid       *G,
     return tpfa_eff_trans_compute<UnstructuredGrid>(G, totmob, htrans, trans);
     #endif
     
-    int c, f;
-    unsigned i;
-
-    for (f = 0; f < G->number_of_faces; f++) {
-        trans[f] = 0.0;
-    }
-
-    for (c = i = 0; c < G->number_of_cells; c++) {
-        for (; i < G->cell_facepos[c + 1]; i++) {
-            f = G->cell_faces[i];
-
-            trans[f] += 1.0 / (totmob[c] * htrans[i]);
-        }
-    }
-
-    for (f = 0; f < G->number_of_faces; f++) {
-        trans[f] = 1.0 / trans[f];
-    }
+    harmonic_trans(G, totmob, htrans, trans);
 }
@@ -0,0 +1,196 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#include <opm/grid/utility/CartesianToCompressedMap.hpp>
+
+#include <atomic>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+namespace Opm
+{
+
+namespace
+{
+
+    // For each of num_slots slots, the lowest entry index i with slot(i)
+    // equal to that slot, or num_entries if there is none. Computed with
+    // an atomic minimum, such that duplicated slots do not race.
+    template <class Slot>
+    std::unique_ptr<std::atomic<int>[]> firstEntryPerSlot(const int num_slots,
+                                                          const int num_entries,
+                                                          const Slot& slot)
+    {
+        std::unique_ptr<std::atomic<int>[]> first(new std::atomic<int>[num_slots]);
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (int s = 0; s < num_slots; ++s) {
+            first[s].store(num_entries, std::memory_order_relaxed);
+        }
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (int i = 0; i < num_entries; ++i) {
+            auto& f = first[slot(i)];
+            int current = f.load(std::memory_order_relaxed);
+            while (i < current && !f.compare_exchange_weak(current, i, std::memory_order_relaxed)) {
+            }
+        }
+        return first;
+    }
+
+} // anonymous namespace
+
+    CartesianToCompressedMap::CartesianToCompressedMap(const int cartesian_size,
+                                                       const int num_cells,
+                                                       const int* global_cell,
+                                                       const double dense_fraction)
+        : cartesian_size_(cartesian_size)
+    {
+        if (global_cell) {
+            build(num_cells, global_cell, nullptr, dense_fraction);
+        } else {
+            std::vector<int> identity(num_cells);
+            std::iota(identity.begin(), identity.end(), 0);
+            build(num_cells, identity.data(), nullptr, dense_fraction);
+        }
+    }
+
+    CartesianToCompressedMap::CartesianToCompressedMap(const int cartesian_size,
+                                                       const int num_entries,
+                                                       const int* cartesian_indices,
+                                                       const int* values,
+                                                       const double dense_fraction)
+        : cartesian_size_(cartesian_size)
+    {
+        build(num_entries, cartesian_indices, values, dense_fraction);
+    }
+
+    void CartesianToCompressedMap::build(const int num_entries,
+                                         const int* cartesian_indices,
+                                         const int* values,
+                                         const double dense_fraction)
+    {
+        bool out_of_range = false;
+#ifdef _OPENMP
+#pragma omp parallel for reduction(||:out_of_range)
+#endif
+        for (int i = 0; i < num_entries; ++i) {
+            out_of_range = out_of_range
+                || cartesian_indices[i] < 0 || cartesian_indices[i] >= cartesian_size_;
+        }
+        if (out_of_range) {
+            throw std::invalid_argument("CartesianToCompressedMap: Cartesian index outside [0, "
+                                        + std::to_string(cartesian_size_) + ").");
+        }
+        is_dense_ = num_entries >= dense_fraction * cartesian_size_;
+        if (is_dense_) {
+            buildDense(num_entries, cartesian_indices, values);
+        } else {
+            buildSparse(num_entries, cartesian_indices, values);
+        }
+    }
+
+    // values == nullptr means values[i] == i.
+    void CartesianToCompressedMap::buildDense(const int num_entries,
+                                              const int* cartesian_indices,
+                                              const int* values)
+    {
+        const auto first = firstEntryPerSlot(cartesian_size_, num_entries,
+                                             [cartesian_indices](const int i) { return cartesian_indices[i]; });
+        dense_.resize(cartesian_size_);
+        std::size_t num_active = 0;
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+:num_active)
+#endif
+        for (int c = 0; c < cartesian_size_; ++c) {
+            const int i = first[c].load(std::memory_order_relaxed);
+            if (i < num_entries) {
+                dense_[c] = values ? values[i] : i;
+                ++num_active;
+            } else {
+                dense_[c] = -1;
+            }
+        }
+        num_active_ = num_active;
+    }
+
+    void CartesianToCompressedMap::buildSparse(const int num_entries,
+                                               const int* cartesian_indices,
+                                               const int* values)
+    {
+        const int num_blocks = (cartesian_size_ + 63) / 64;
+        active_mask_.assign(num_blocks, 0);
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (int i = 0; i < num_entries; ++i) {
+            const int c = cartesian_indices[i];
+            const std::uint64_t bit = std::uint64_t(1) << (c & 63);
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+            active_mask_[c >> 6] |= bit;
+        }
+
+        block_offset_.resize(num_blocks + 1);
+        block_offset_[0] = 0;
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (int b = 0; b < num_blocks; ++b) {
+            block_offset_[b + 1] = popcount(active_mask_[b]);
+        }
+        std::partial_sum(block_offset_.begin(), block_offset_.end(), block_offset_.begin());
+        num_active_ = block_offset_.back();
+
+        compressed_.resize(num_active_);
+        const auto position = [this](const int c)
+        {
+            const std::uint64_t bit = std::uint64_t(1) << (c & 63);
+            return block_offset_[c >> 6] + popcount(active_mask_[c >> 6] & (bit - 1));
+        };
+        const auto first = firstEntryPerSlot(num_active_, num_entries,
+                                             [&position, cartesian_indices](const int i)
+                                             { return position(cartesian_indices[i]); });
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (int p = 0; p < static_cast<int>(num_active_); ++p) {
+            const int i = first[p].load(std::memory_order_relaxed);
+            compressed_[p] = values ? values[i] : i;
+        }
+    }
+
+    int CartesianToCompressedMap::at(const int cartesian_index) const
+    {
+        const int compressed = (*this)[cartesian_index];
+        if (compressed < 0) {
+            throw std::out_of_range("CartesianToCompressedMap: Cartesian index "
+                                    + std::to_string(cartesian_index) + " is not active.");
+        }
+        return compressed;
+    }
+
+} // namespace Opm
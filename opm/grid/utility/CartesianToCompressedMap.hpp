@@ -0,0 +1,170 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_CARTESIANTOCOMPRESSEDMAP_HEADER_INCLUDED
+#define OPM_CARTESIANTOCOMPRESSEDMAP_HEADER_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Opm
+{
+
+    /// Inverse of a compressed-to-Cartesian map (such as global_cell),
+    /// with O(1) lookup and no hashing.
+    ///
+    /// Two representations are used, selected at construction from the
+    /// fraction of active Cartesian cells:
+    ///
+    ///   - dense:  one int per Cartesian cell, -1 for inactive cells.
+    ///   - sparse: one bit per Cartesian cell, grouped in 64-bit blocks
+    ///             with the number of active cells preceding each block,
+    ///             and the compressed indices in Cartesian order. A lookup
+    ///             is a block offset plus a popcount.
+    ///
+    /// The sparse variant needs roughly 0.2 bytes per Cartesian cell plus
+    /// 4 bytes per active cell, compared to 4 bytes per Cartesian cell for
+    /// the dense one. Construction is threaded (OpenMP) in both cases.
+    ///
+    /// If a Cartesian index appears more than once in the input, the
+    /// first occurrence wins, like for cartesianToCompressed().
+    class CartesianToCompressedMap
+    {
+    public:
+        /// Use dense storage when at least this fraction of the Cartesian
+        /// cells is active.
+        static constexpr double defaultDenseFraction = 0.25;
+
+        /// Empty map.
+        CartesianToCompressedMap() = default;
+
+        /// Construct the inverse of a compressed-to-Cartesian map.
+        /// \param[in] cartesian_size  Number of cells in the logical Cartesian grid.
+        /// \param[in] num_cells       Number of compressed (active) cells.
+        /// \param[in] global_cell     Either null, meaning { 0, 1, 2, ... }, or an array
+        ///                            of size num_cells with Cartesian indices.
+        /// \param[in] dense_fraction  See defaultDenseFraction.
+        CartesianToCompressedMap(const int cartesian_size,
+                                 const int num_cells,
+                                 const int* global_cell,
+                                 const double dense_fraction = defaultDenseFraction);
+
+        /// Construct a map from arbitrary (Cartesian index, value) pairs, where
+        /// values are non-negative, e.g. leaf indices of the cells of one level.
+        /// \param[in] cartesian_size     Number of cells in the logical Cartesian grid.
+        /// \param[in] num_entries        Number of pairs.
+        /// \param[in] cartesian_indices  Array of size num_entries.
+        /// \param[in] values             Array of size num_entries.
+        /// \param[in] dense_fraction     See defaultDenseFraction.
+        CartesianToCompressedMap(const int cartesian_size,
+                                 const int num_entries,
+                                 const int* cartesian_indices,
+                                 const int* values,
+                                 const double dense_fraction);
+
+        /// \return compressed index of the given Cartesian cell, or -1 if the
+        ///         cell is inactive or out of range.
+        int operator[](const int cartesian_index) const
+        {
+            if (cartesian_index < 0 || cartesian_index >= cartesian_size_) {
+                return -1;
+            }
+            if (is_dense_) {
+                return dense_[cartesian_index];
+            }
+            const std::uint64_t mask = active_mask_[cartesian_index >> 6];
+            const std::uint64_t bit = std::uint64_t(1) << (cartesian_index & 63);
+            if ((mask & bit) == 0) {
+                return -1;
+            }
+            return compressed_[block_offset_[cartesian_index >> 6] + popcount(mask & (bit - 1))];
+        }
+
+        /// \return compressed index of the given Cartesian cell.
+        /// \throw std::out_of_range if the cell is inactive or out of range,
+        ///        like std::unordered_map::at().
+        int at(const int cartesian_index) const;
+
+        /// \return true if the given Cartesian cell is active.
+        bool contains(const int cartesian_index) const
+        {
+            return (*this)[cartesian_index] >= 0;
+        }
+
+        /// \return 1 if the given Cartesian cell is active, 0 otherwise,
+        ///         like std::unordered_map::count().
+        std::size_t count(const int cartesian_index) const
+        {
+            return contains(cartesian_index) ? 1 : 0;
+        }
+
+        /// \return number of active (distinct) Cartesian cells.
+        std::size_t size() const
+        {
+            return num_active_;
+        }
+
+        /// \return number of cells in the logical Cartesian grid.
+        int cartesianSize() const
+        {
+            return cartesian_size_;
+        }
+
+        /// \return true if the dense representation is used.
+        bool isDense() const
+        {
+            return is_dense_;
+        }
+
+    private:
+        static int popcount(const std::uint64_t x)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return __builtin_popcountll(x);
+#else
+            int count = 0;
+            for (std::uint64_t y = x; y != 0; y &= y - 1) {
+                ++count;
+            }
+            return count;
+#endif
+        }
+
+        void build(const int num_entries,
+                   const int* cartesian_indices,
+                   const int* values,
+                   const double dense_fraction);
+        void buildDense(const int num_entries, const int* cartesian_indices, const int* values);
+        void buildSparse(const int num_entries, const int* cartesian_indices, const int* values);
+
+        int cartesian_size_ = 0;
+        std::size_t num_active_ = 0;
+        bool is_dense_ = true;
+        // Dense representation.
+        std::vector<int> dense_;
+        // Sparse representation.
+        std::vector<std::uint64_t> active_mask_;
+        std::vector<int> block_offset_;
+        std::vector<int> compressed_;
+    };
+
+} // namespace Opm
+
+#endif // OPM_CARTESIANTOCOMPRESSEDMAP_HEADER_INCLUDED
@@ -0,0 +1,182 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef OPM_COLOURED_ELEMENT_CHUNKS_HEADER
+#define OPM_COLOURED_ELEMENT_CHUNKS_HEADER
+
+#include <opm/grid/utility/ElementChunks.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+namespace Opm
+{
+
+/// Element chunks grouped into colours such that threaded loops over the
+/// chunks of one colour may update both cells of every face without
+/// atomics or locks.
+///
+/// The chunks are those of ElementChunks. A chunk's write set is its own
+/// cells plus their face neighbours. Two chunks get different colours if
+/// their write sets overlap, i.e. if they are adjacent or share a
+/// neighbouring cell.
+///
+/// Typical face-based assembly, visiting each interior face once from the
+/// cell with the lower index:
+/// ColouredElementChunks chunks(gridview, Dune::Partitions::all, num_chunks);
+/// for (std::size_t colour = 0; colour < chunks.numColours(); ++colour) {
+///     #pragma omp parallel for
+///     for (const auto& chunk : chunks.colour(colour)) {
+///         for (const auto& elem : chunk) {
+///             for (const auto& is : intersections(gridview, elem)) {
+///                 // Update elem and is.outside() without synchronisation.
+///             }
+///         }
+///     }
+/// }
+template <class GridView, class PartitionSet>
+class ColouredElementChunks
+{
+private:
+    using Chunks = ElementChunks<GridView, PartitionSet>;
+
+public:
+    using Chunk = typename Chunks::Chunk;
+
+    ColouredElementChunks(const GridView& gv,
+                          const PartitionSet included_partition,
+                          const std::size_t num_chunks)
+    {
+        const Chunks chunks(gv, included_partition, num_chunks);
+        const auto& index_set = gv.indexSet();
+        const std::size_t num_cells = gv.size(0);
+
+        std::vector<Chunk> all_chunks;
+        all_chunks.reserve(chunks.size());
+        for (const auto& chunk : chunks) {
+            all_chunks.push_back(chunk);
+        }
+
+        const int num_all_chunks = all_chunks.size();
+
+        // Cells written by each chunk, sorted and unique.
+        std::vector<std::vector<int>> write_sets(num_all_chunks);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+        for (int c = 0; c < num_all_chunks; ++c) {
+            auto& cells = write_sets[c];
+            for (const auto& elem : all_chunks[c]) {
+                cells.push_back(index_set.index(elem));
+                for (const auto& is : intersections(gv, elem)) {
+                    if (is.neighbor()) {
+                        cells.push_back(index_set.index(is.outside()));
+                    }
+                }
+            }
+            std::sort(cells.begin(), cells.end());
+            cells.erase(std::unique(cells.begin(), cells.end()), cells.end());
+        }
+
+        // Chunks writing to each cell, as compressed rows.
+        std::vector<int> writer_start(num_cells + 1, 0);
+        for (const auto& cells : write_sets) {
+            for (const int cell : cells) {
+                ++writer_start[cell + 1];
+            }
+        }
+        std::partial_sum(writer_start.begin(), writer_start.end(), writer_start.begin());
+        std::vector<int> writers(writer_start.back());
+        {
+            std::vector<int> pos(writer_start.begin(), writer_start.end() - 1);
+            for (int c = 0; c < num_all_chunks; ++c) {
+                for (const int cell : write_sets[c]) {
+                    writers[pos[cell]++] = c;
+                }
+            }
+        }
+
+        // Chunks writing to the same cell conflict. The marker records the
+        // chunk a conflict was last listed for, so each is listed once.
+        std::vector<std::vector<int>> conflicts(num_all_chunks);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            std::vector<int> marker(num_all_chunks, -1);
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+            for (int c = 0; c < num_all_chunks; ++c) {
+                for (const int cell : write_sets[c]) {
+                    for (int i = writer_start[cell]; i < writer_start[cell + 1]; ++i) {
+                        const int other = writers[i];
+                        if (other != c && marker[other] != c) {
+                            marker[other] = c;
+                            conflicts[c].push_back(other);
+                        }
+                    }
+                }
+            }
+        }
+
+        // Greedy colouring in chunk order. Chunks follow the element
+        // ordering, so for logically Cartesian grids only a few colours
+        // are needed.
+        std::vector<int> chunk_colour(all_chunks.size(), -1);
+        std::vector<char> used;
+        for (int c = 0; c < num_all_chunks; ++c) {
+            used.assign(conflicts[c].size() + 1, 0);
+            for (const int other : conflicts[c]) {
+                const int oc = chunk_colour[other];
+                if (oc >= 0 && oc < static_cast<int>(used.size())) {
+                    used[oc] = 1;
+                }
+            }
+            const int colour = std::find(used.begin(), used.end(), 0) - used.begin();
+            chunk_colour[c] = colour;
+            if (colour >= static_cast<int>(colours_.size())) {
+                colours_.resize(colour + 1);
+            }
+            colours_[colour].push_back(all_chunks[c]);
+        }
+    }
+
+    /// Number of colours.
+    std::size_t numColours() const
+    {
+        return colours_.size();
+    }
+
+    /// The chunks of a colour. Chunks of the same colour have disjoint
+    /// write sets and may be processed concurrently.
+    const std::vector<Chunk>& colour(const std::size_t c) const
+    {
+        return colours_[c];
+    }
+
+private:
+    std::vector<std::vector<Chunk>> colours_;
+};
+
+
+} // namespace Opm
+
+#endif // OPM_COLOURED_ELEMENT_CHUNKS_HEADER
@@ -22,9 +22,18 @@
 
 #include <opm/grid/utility/IteratorRange.hpp>
 
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace Opm
 {
 
@@ -100,20 +109,289 @@ namespace Opm
          */
         Range
         cells(const RegionId r) const {
-            const auto id = rev_.binid.find(r);
+            const auto i = rev_.bin(r);
 
-            if (id == rev_.binid.end()) {
+            if (i == npos) {
                 // Region 'r' not an active region.  Return empty.
                 return Range(rev_.c.end(), rev_.c.end());
             }
 
-            const auto i = id->second;
-
             return Range(rev_.c.begin() + rev_.p[i + 0],
                          rev_.c.begin() + rev_.p[i + 1]);
         }
 
+        /**
+         * Region-wise sums of several cell fields.
+         *
+         * Threaded over cells, accumulating into per-thread bins that
+         * are combined at the end.  Cells in regions outside [0,
+         * num_regions) are ignored.
+         *
+         * \tparam Field Cell field type, indexable by cell, e.g.,
+         *               std::vector<double> or const double*.
+         *
+         * \param[in] fields Cell fields.
+         *
+         * \param[in] num_regions Number of regions, one more than the
+         *                        largest region ID of interest.
+         *
+         * \return Sums, region major: the sum of field @c f in region
+         *         @c r is element <CODE>r*fields.size() + f</CODE>.
+         */
+        template <class Field>
+        std::vector<double>
+        sum(const std::vector<Field>& fields, const std::size_t num_regions) const
+        {
+            const auto nf = fields.size();
+            return this->reduce(num_regions, nf, 0.0,
+                                [&fields, nf](const CellId c, double* acc)
+                                {
+                                    for (std::size_t f = 0; f < nf; ++f) {
+                                        acc[f] += fields[f][c];
+                                    }
+                                },
+                                [](double& a, const double b) { a += b; });
+        }
+
+        /**
+         * Region-wise sums of several cell fields across all ranks of a
+         * parallel run, using a single collective reduction.
+         *
+         * \tparam Comm Communication object such as
+         *              Dune::Communication, providing sum(T*, int).
+         *
+         * \see sum(const std::vector<Field>&, std::size_t).
+         */
+        template <class Field, class Comm>
+        std::vector<double>
+        sum(const std::vector<Field>& fields, const std::size_t num_regions,
+            const Comm& comm) const
+        {
+            auto result = this->sum(fields, num_regions);
+            comm.sum(result.data(), result.size());
+            return result;
+        }
+
+        /**
+         * Region-wise minima of several cell fields.  Regions without
+         * cells get std::numeric_limits<double>::max().
+         *
+         * \see sum(const std::vector<Field>&, std::size_t).
+         */
+        template <class Field>
+        std::vector<double>
+        minimum(const std::vector<Field>& fields, const std::size_t num_regions) const
+        {
+            const auto nf = fields.size();
+            return this->reduce(num_regions, nf, std::numeric_limits<double>::max(),
+                                [&fields, nf](const CellId c, double* acc)
+                                {
+                                    for (std::size_t f = 0; f < nf; ++f) {
+                                        acc[f] = std::min(acc[f], static_cast<double>(fields[f][c]));
+                                    }
+                                },
+                                [](double& a, const double b) { a = std::min(a, b); });
+        }
+
+        /**
+         * Region-wise minima of several cell fields across all ranks.
+         *
+         * \see minimum(const std::vector<Field>&, std::size_t).
+         */
+        template <class Field, class Comm>
+        std::vector<double>
+        minimum(const std::vector<Field>& fields, const std::size_t num_regions,
+                const Comm& comm) const
+        {
+            auto result = this->minimum(fields, num_regions);
+            comm.min(result.data(), result.size());
+            return result;
+        }
+
+        /**
+         * Region-wise maxima of several cell fields.  Regions without
+         * cells get std::numeric_limits<double>::lowest().
+         *
+         * \see sum(const std::vector<Field>&, std::size_t).
+         */
+        template <class Field>
+        std::vector<double>
+        maximum(const std::vector<Field>& fields, const std::size_t num_regions) const
+        {
+            const auto nf = fields.size();
+            return this->reduce(num_regions, nf, std::numeric_limits<double>::lowest(),
+                                [&fields, nf](const CellId c, double* acc)
+                                {
+                                    for (std::size_t f = 0; f < nf; ++f) {
+                                        acc[f] = std::max(acc[f], static_cast<double>(fields[f][c]));
+                                    }
+                                },
+                                [](double& a, const double b) { a = std::max(a, b); });
+        }
+
+        /**
+         * Region-wise maxima of several cell fields across all ranks.
+         *
+         * \see maximum(const std::vector<Field>&, std::size_t).
+         */
+        template <class Field, class Comm>
+        std::vector<double>
+        maximum(const std::vector<Field>& fields, const std::size_t num_regions,
+                const Comm& comm) const
+        {
+            auto result = this->maximum(fields, num_regions);
+            comm.max(result.data(), result.size());
+            return result;
+        }
+
+        /**
+         * Region-wise weighted averages of several cell fields, e.g.,
+         * pore volume weighted pressures.  Regions with zero total
+         * weight get zero.
+         *
+         * \param[in] weight Cell weights.
+         *
+         * \see sum(const std::vector<Field>&, std::size_t).
+         */
+        template <class Field, class Weight>
+        std::vector<double>
+        weightedAverage(const std::vector<Field>& fields, const Weight& weight,
+                        const std::size_t num_regions) const
+        {
+            auto acc = this->weightedSums(fields, weight, num_regions);
+            return this->divideByWeight(acc, fields.size(), num_regions);
+        }
+
+        /**
+         * Region-wise weighted averages of several cell fields across
+         * all ranks, reducing sums and weights in one collective.
+         *
+         * \see weightedAverage(const std::vector<Field>&, const Weight&, std::size_t).
+         */
+        template <class Field, class Weight, class Comm>
+        std::vector<double>
+        weightedAverage(const std::vector<Field>& fields, const Weight& weight,
+                        const std::size_t num_regions, const Comm& comm) const
+        {
+            auto acc = this->weightedSums(fields, weight, num_regions);
+            comm.sum(acc.data(), acc.size());
+            return this->divideByWeight(acc, fields.size(), num_regions);
+        }
+
     private:
+        /**
+         * Bin number of regions that are not active.
+         */
+        static constexpr typename std::vector<CellId>::size_type npos =
+            std::numeric_limits<typename std::vector<CellId>::size_type>::max();
+
+        /**
+         * Whether region @c r is in [0, n).
+         */
+        static bool
+        inRange(const RegionId r, const std::size_t n)
+        {
+            if constexpr (std::is_signed_v<RegionId>) {
+                if (r < RegionId(0)) {
+                    return false;
+                }
+            }
+            return static_cast<std::size_t>(r) < n;
+        }
+
+        /**
+         * Threaded region-wise reduction.  Calls update(c, acc) for each
+         * cell @c c, where @c acc points to the @c width accumulators of
+         * the cell's region in the calling thread's bins.  Bins start at
+         * @c init and are combined by combine(a, b).
+         */
+        template <class Update, class Combine>
+        std::vector<double>
+        reduce(const std::size_t num_regions, const std::size_t width,
+               const double init, Update&& update, Combine&& combine) const
+        {
+            const std::size_t n = num_regions * width;
+            const std::size_t num_cells = reg_.size();
+
+            int num_threads = 1;
+#ifdef _OPENMP
+            num_threads = std::max(1, std::min(omp_get_max_threads(),
+                                               static_cast<int>(num_cells / 1024 + 1)));
+#endif
+            std::vector<double> acc(num_threads * n, init);
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(num_threads)
+#endif
+            {
+                int t = 0;
+#ifdef _OPENMP
+                t = omp_get_thread_num();
+#endif
+                double* bins = acc.data() + t*n;
+#ifdef _OPENMP
+#pragma omp for
+#endif
+                for (std::size_t c = 0; c < num_cells; ++c) {
+                    const auto r = reg_[c];
+                    if (inRange(r, num_regions)) {
+                        update(static_cast<CellId>(c), bins + static_cast<std::size_t>(r)*width);
+                    }
+                }
+            }
+
+            // Combine the bins of all threads into the first.
+            for (int t = 1; t < num_threads; ++t) {
+                for (std::size_t i = 0; i < n; ++i) {
+                    combine(acc[i], acc[t*n + i]);
+                }
+            }
+            acc.resize(n);
+
+            return acc;
+        }
+
+        /**
+         * Region-wise sums of weight*field for each field, followed by
+         * the sum of the weights.
+         */
+        template <class Field, class Weight>
+        std::vector<double>
+        weightedSums(const std::vector<Field>& fields, const Weight& weight,
+                     const std::size_t num_regions) const
+        {
+            const auto nf = fields.size();
+            return this->reduce(num_regions, nf + 1, 0.0,
+                                [&fields, &weight, nf](const CellId c, double* acc)
+                                {
+                                    const double w = weight[c];
+                                    for (std::size_t f = 0; f < nf; ++f) {
+                                        acc[f] += w * fields[f][c];
+                                    }
+                                    acc[nf] += w;
+                                },
+                                [](double& a, const double b) { a += b; });
+        }
+
+        /**
+         * Weighted averages from the result of weightedSums().
+         */
+        static std::vector<double>
+        divideByWeight(const std::vector<double>& acc, const std::size_t nf,
+                       const std::size_t num_regions)
+        {
+            std::vector<double> avg(num_regions * nf, 0.0);
+            for (std::size_t r = 0; r < num_regions; ++r) {
+                const double w = acc[r*(nf + 1) + nf];
+                if (w != 0.0) {
+                    for (std::size_t f = 0; f < nf; ++f) {
+                        avg[r*nf + f] = acc[r*(nf + 1) + f] / w;
+                    }
+                }
+            }
+            return avg;
+        }
+
         /**
          * Copy of forward region mapping (cell-to-region).
          */
@@ -128,9 +406,36 @@ namespace Opm
             std::unordered_map<RegionId, Pos> binid;
             std::vector<RegionId>             active;
 
+            /**
+             * Dense alternative to 'binid' for integer region IDs in a
+             * small range: dense[r - dense_min] is the bin of region
+             * 'r', or npos.
+             */
+            std::vector<Pos> dense;
+            RegionId         dense_min{};
+
             std::vector<Pos>    p;   /**< Region start pointers */
             std::vector<CellId> c;   /**< Region cells */
 
+            /**
+             * Bin of region 'r', or npos if 'r' is not active.
+             */
+            Pos
+            bin(const RegionId r) const
+            {
+                if (! dense.empty()) {
+                    if (r < dense_min) {
+                        return npos;
+                    }
+
+                    const auto i = static_cast<std::size_t>(r - dense_min);
+                    return (i < dense.size()) ? dense[i] : npos;
+                }
+
+                const auto id = binid.find(r);
+                return (id == binid.end()) ? npos : id->second;
+            }
+
             /**
              * Compute reverse mapping.  Standard linear insertion
              * sort algorithm.
@@ -139,13 +444,15 @@ namespace Opm
             init(const Region& reg)
             {
                 binid.clear();
-                for (const auto& r : reg) {
-                    ++binid[r];
-                }
-
-                p     .clear();  p.emplace_back(0);
+                dense.clear();
                 active.clear();
-                {
+                p     .clear();  p.emplace_back(0);
+
+                if (! initDense(reg)) {
+                    for (const auto& r : reg) {
+                        ++binid[r];
+                    }
+
                     Pos n = 0;
                     for (auto& id : binid) {
                         active.push_back(id.first);
@@ -166,13 +473,58 @@ namespace Opm
                 {
                     CellId i = 0;
                     for (const auto& r : reg) {
-                        auto& pos  = p[ binid[r] + 1 ];
+                        auto& pos  = p[ bin(r) + 1 ];
                         c[ pos++ ] = i++;
                     }
                 }
 
                 p[0] = 0;
             }
+
+            /**
+             * Count region sizes in a dense bin array if the region IDs
+             * are integers spanning at most about as many values as
+             * there are cells.  Active regions are then sorted.
+             *
+             * \return Whether the dense bins are used.
+             */
+            bool
+            initDense(const Region& reg)
+            {
+                if constexpr (std::is_integral_v<RegionId>) {
+                    if (reg.size() == 0) {
+                        return false;
+                    }
+
+                    const auto [lo, hi] = std::minmax_element(reg.begin(), reg.end());
+                    const auto span = static_cast<double>(*hi) - static_cast<double>(*lo) + 1;
+                    if (span > std::max(static_cast<double>(reg.size()), 1024.0)) {
+                        return false;
+                    }
+
+                    dense_min = *lo;
+                    std::vector<Pos> count(static_cast<std::size_t>(span), 0);
+                    for (const auto& r : reg) {
+                        ++count[static_cast<std::size_t>(r - dense_min)];
+                    }
+
+                    dense.assign(count.size(), npos);
+                    Pos n = 0;
+                    for (std::size_t i = 0; i < count.size(); ++i) {
+                        if (count[i] > 0) {
+                            active.push_back(static_cast<RegionId>(dense_min + i));
+                            p     .push_back(count[i]);
+
+                            dense[i] = n++;
+                        }
+                    }
+
+                    return true;
+                }
+                else {
+                    return false;
+                }
+            }
         } rev_; /**< Reverse mapping instance */
     };
 
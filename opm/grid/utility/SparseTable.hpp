@@ -40,6 +40,7 @@
 #include <algorithm>
 #include <opm/common/ErrorMacros.hpp>
 #include <opm/grid/utility/IteratorRange.hpp>
+#include <opm/grid/utility/firstTouch.hpp>
 
 #include <ostream>
 
@@ -137,12 +138,38 @@ namespace Opm
             data_.swap(other.data_);
         }
 
+        /// Move the storage to memory first touched in parallel, such that
+        /// the rows [row_blocks[c], row_blocks[c + 1]) are placed on the
+        /// NUMA node of thread c. \see Opm::firstTouch()
+        void firstTouch(const std::vector<std::size_t>& row_blocks)
+        {
+            std::vector<std::size_t> data_blocks(row_blocks.size());
+            for (std::size_t c = 0; c < row_blocks.size(); ++c) {
+                data_blocks[c] = row_start_[std::min(row_blocks[c], row_start_.size() - 1)];
+            }
+            Opm::firstTouch(data_, data_blocks);
+            Opm::firstTouch(row_start_, row_blocks);
+        }
+
         /// Returns the number of data elements.
         int dataSize() const
         {
             return data_.size();
         }
 
+        /// Returns the table data, the rows stored one after another.
+        const T* tableData() const
+        {
+            return data_.data();
+        }
+
+        /// Returns the size() + 1 positions in tableData() where the rows
+        /// start, the last being dataSize().
+        const int* rowStarts() const
+        {
+            return row_start_.data();
+        }
+
         /// Returns the size of a table row.
         int rowSize(int row) const
         {
@@ -161,8 +188,8 @@ namespace Opm
         }
 
         /// Defining the row type, returned by operator[].
-        using row_type = iterator_range<typename std::vector<T>::const_iterator>;
-        using mutable_row_type = mutable_iterator_range<typename std::vector<T>::iterator>;
+        using row_type = iterator_range<typename std::vector<T, FirstTouchAllocator<T>>::const_iterator>;
+        using mutable_row_type = mutable_iterator_range<typename std::vector<T, FirstTouchAllocator<T>>::iterator>;
 
         /// Returns a row of the table.
         row_type operator[](int row) const
@@ -249,10 +276,10 @@ namespace Opm
         }
 
     private:
-        std::vector<T> data_;
+        std::vector<T, FirstTouchAllocator<T>> data_;
         // Like in the compressed row sparse matrix format,
         // row_start_.size() is equal to the number of rows + 1.
-        std::vector<int> row_start_;
+        std::vector<int, FirstTouchAllocator<int>> row_start_;
 
 	template <class IntegerIter>
 	void setRowStartsFromSizes(IntegerIter rowsize_beg, IntegerIter rowsize_end)
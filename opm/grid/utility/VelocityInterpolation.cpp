@@ -22,6 +22,7 @@
 #include <opm/grid/UnstructuredGrid.h>
 #include <opm/common/utility/numeric/blas_lapack.h>
 
+#include <cassert>
 #include <iostream>
 
 namespace Opm
@@ -34,6 +35,23 @@ namespace Opm
     {
     }
 
+    /// Interpolate velocity at many points, one after the other.
+    /// \param[in]  num_points  Number of points.
+    /// \param[in]  dim         Number of coordinates of each point.
+    /// \param[in]  cells       Cell of each point.
+    /// \param[in]  x           Coordinates of the points, point by point.
+    /// \param[out] v           Interpolated velocities, point by point.
+    void VelocityInterpolationInterface::interpolateBatch(const int num_points,
+                                                          const int dim,
+                                                          const int* cells,
+                                                          const double* x,
+                                                          double* v) const
+    {
+        for (int p = 0; p < num_points; ++p) {
+            interpolate(cells[p], x + dim*p, v + dim*p);
+        }
+    }
+
 
 
     // --------  Methods of class VelocityInterpolationConstant  --------
@@ -82,6 +100,28 @@ namespace Opm
     }
 
 
+    /// Interpolate velocity at many points.
+    /// \param[in]  num_points  Number of points.
+    /// \param[in]  dim         Number of coordinates of each point.
+    /// \param[in]  cells       Cell of each point.
+    /// \param[in]  x           Coordinates of the points, point by point.
+    /// \param[out] v           Interpolated velocities, point by point.
+    void VelocityInterpolationConstant::interpolateBatch(const int num_points,
+                                                         const int dim,
+                                                         const int* cells,
+                                                         const double* x,
+                                                         double* v) const
+    {
+        assert(dim == grid_.dimensions);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int p = 0; p < num_points; ++p) {
+            VelocityInterpolationConstant::interpolate(cells[p], x + dim*p, v + dim*p);
+        }
+    }
+
+
     // --------  Methods of class VelocityInterpolationECVI  --------
 
 
@@ -183,5 +223,45 @@ namespace Opm
         }
     }
 
+    /// Interpolate velocity at many points.
+    /// \param[in]  num_points  Number of points.
+    /// \param[in]  dim         Number of coordinates of each point.
+    /// \param[in]  cells       Cell of each point.
+    /// \param[in]  x           Coordinates of the points, point by point.
+    /// \param[out] v           Interpolated velocities, point by point.
+    void VelocityInterpolationECVI::interpolateBatch(const int num_points,
+                                                     const int dim,
+                                                     const int* cells,
+                                                     const double* x,
+                                                     double* v) const
+    {
+        assert(dim == grid_.dimensions);
+        const SparseTable<WachspressCoord::CornerInfo>& all_ci = bcmethod_.cornerInfo();
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            std::vector<double> bary_coord(bcmethod_.maxNumCorners());
+            std::vector<double> work(bcmethod_.maxNumFaces());
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+            for (int p = 0; p < num_points; ++p) {
+                const int cell = cells[p];
+                bcmethod_.cartToBary(cell, x + dim*p, bary_coord.data(), work.data());
+                // Corner ids are consecutive within a cell.
+                const int n = bcmethod_.numCorners(cell);
+                const double* cv = corner_velocity_.data() + dim*all_ci[cell][0].corner_id;
+                double* vp = v + dim*p;
+                std::fill(vp, vp + dim, 0.0);
+                for (int i = 0; i < n; ++i) {
+                    for (int dd = 0; dd < dim; ++dd) {
+                        vp[dd] += cv[dim*i + dd] * bary_coord[i];
+                    }
+                }
+            }
+        }
+    }
+
 
 } // namespace Opm
@@ -47,6 +47,24 @@ namespace Opm
         virtual void interpolate(const int cell,
                                  const double* x,
                                  double* v) const = 0;
+
+        /// Interpolate velocity at many points.
+        /// The default implementation calls interpolate() for one point
+        /// after the other.
+        /// \param[in]  num_points  Number of points.
+        /// \param[in]  dim         Number of coordinates of each point,
+        ///                         equal to grid.dimensions.
+        /// \param[in]  cells       Cell of each point.
+        ///                         Must be array of length num_points.
+        /// \param[in]  x           Coordinates of the points, point by point.
+        ///                         Must be array of length num_points*dim.
+        /// \param[out] v           Interpolated velocities, point by point.
+        ///                         Must be array of length num_points*dim.
+        virtual void interpolateBatch(const int num_points,
+                                      const int dim,
+                                      const int* cells,
+                                      const double* x,
+                                      double* v) const;
     };
 
 
@@ -74,6 +92,23 @@ namespace Opm
         void interpolate(const int cell,
                          const double* x,
                          double* v) const override;
+
+        /// Interpolate velocity at many points.
+        /// Runs threaded over the points when OpenMP is enabled.
+        /// \param[in]  num_points  Number of points.
+        /// \param[in]  dim         Number of coordinates of each point,
+        ///                         equal to grid.dimensions.
+        /// \param[in]  cells       Cell of each point.
+        ///                         Must be array of length num_points.
+        /// \param[in]  x           Coordinates of the points, point by point.
+        ///                         Must be array of length num_points*dim.
+        /// \param[out] v           Interpolated velocities, point by point.
+        ///                         Must be array of length num_points*dim.
+        void interpolateBatch(const int num_points,
+                              const int dim,
+                              const int* cells,
+                              const double* x,
+                              double* v) const override;
     private:
         const UnstructuredGrid& grid_;
         const double* flux_;
@@ -107,6 +142,27 @@ namespace Opm
         void interpolate(const int cell,
                          const double* x,
                          double* v) const override;
+
+        /// Interpolate velocity at many points.
+        /// Unlike interpolate(), this is thread safe, and it runs threaded
+        /// over the points when OpenMP is enabled. The barycentric
+        /// coordinates are computed from face data cached by the
+        /// constructor, evaluating each face factor once per point.
+        /// Points should be sorted by cell for best memory locality.
+        /// \param[in]  num_points  Number of points.
+        /// \param[in]  dim         Number of coordinates of each point,
+        ///                         equal to grid.dimensions.
+        /// \param[in]  cells       Cell of each point.
+        ///                         Must be array of length num_points.
+        /// \param[in]  x           Coordinates of the points, point by point.
+        ///                         Must be array of length num_points*dim.
+        /// \param[out] v           Interpolated velocities, point by point.
+        ///                         Must be array of length num_points*dim.
+        void interpolateBatch(const int num_points,
+                              const int dim,
+                              const int* cells,
+                              const double* x,
+                              double* v) const override;
     private:
         WachspressCoord bcmethod_;
         const UnstructuredGrid& grid_;
@@ -20,6 +20,7 @@
 #include "config.h"
 #include <opm/grid/utility/WachspressCoord.hpp>
 #include <opm/grid/UnstructuredGrid.h>
+#include <algorithm>
 #include <cmath>
 #include <map>
 #include <set>
@@ -156,10 +157,39 @@ namespace Opm
                                     vert_adj_faces.begin(), vert_adj_faces.end(),
                                     vert_nonadj_faces.begin());
                 nonadj_faces_.appendRow(vert_nonadj_faces.begin(), vert_nonadj_faces.end());
+                const int* hf_begin = grid.cell_faces + grid.cell_facepos[cell];
+                const int* hf_end = grid.cell_faces + grid.cell_facepos[cell + 1];
+                for (int& face : vert_nonadj_faces) {
+                    face = std::find(hf_begin, hf_end, face) - hf_begin;
+                }
+                nonadj_local_.appendRow(vert_nonadj_faces.begin(), vert_nonadj_faces.end());
+                corner_volume_.push_back(corner_vol);
             }
             corner_info_.appendRow(cell_corner_info.begin(), cell_corner_info.end());
+            corner_start_.push_back(corner_id_count - cell_corner_info.size());
+            max_faces_ = std::max(max_faces_, int(cell_faces.size()));
+            max_corners_ = std::max(max_corners_, int(cell_corner_info.size()));
         }
+        corner_start_.push_back(corner_id_count);
         assert(corner_id_count == corner_info_.dataSize());
+
+        // Face planes by half-face, oriented outwards from the cell.
+        const int num_hf = grid.cell_facepos[num_cells];
+        hf_normal_.resize(dim*num_hf);
+        hf_offset_.resize(num_hf);
+        for (int cell = 0; cell < num_cells; ++cell) {
+            for (int hface = grid.cell_facepos[cell]; hface < grid.cell_facepos[cell + 1]; ++hface) {
+                const int face = grid.cell_faces[hface];
+                const double sign = (grid.face_cells[2*face] == cell) ? 1.0 : -1.0;
+                double offset = 0.0;
+                for (int dd = 0; dd < dim; ++dd) {
+                    const double normal = sign*grid.face_normals[dim*face + dd];
+                    hf_normal_[dd*num_hf + hface] = normal;
+                    offset += normal*grid.face_centroids[dim*face + dd];
+                }
+                hf_offset_[hface] = offset;
+            }
+        }
     }
 
 
@@ -240,4 +270,66 @@ namespace Opm
 
 
 
+    /// Compute generalized barycentric coordinates for some point x
+    /// with respect to the vertices of a grid cell, using face data
+    /// cached by the constructor.
+    /// \param[in]  cell   Cell in which to compute coordinates.
+    /// \param[in]  x      Coordinates of point in cartesian coordinates.
+    ///                    Must be array of length grid.dimensions.
+    /// \param[out] xb     Coordinates of point in barycentric coordinates.
+    ///                    Must be array of length numCorners(cell).
+    /// \param[out] work   Workspace. Must be array of length maxNumFaces().
+    void WachspressCoord::cartToBary(const int cell,
+                                     const double* x,
+                                     double* xb,
+                                     double* work) const
+    {
+        const int dim = grid_.dimensions;
+        const int num_hf = hf_offset_.size();
+        const int hf0 = grid_.cell_facepos[cell];
+        const int num_faces = grid_.cell_facepos[cell + 1] - hf0;
+        // Factor n_j * (c_j - x) of each face, with outward normals.
+        for (int j = 0; j < num_faces; ++j) {
+            work[j] = hf_offset_[hf0 + j];
+        }
+        for (int dd = 0; dd < dim; ++dd) {
+            const double* normal = hf_normal_.data() + dd*num_hf + hf0;
+            for (int j = 0; j < num_faces; ++j) {
+                work[j] -= normal[j]*x[dd];
+            }
+        }
+        const int c0 = corner_start_[cell];
+        const int n = corner_start_[cell + 1] - c0;
+        double totw = 0.0;
+        for (int i = 0; i < n; ++i) {
+            double w = corner_volume_[c0 + i];
+            for (const int j : nonadj_local_[c0 + i]) {
+                w *= work[j];
+            }
+            xb[i] = w;
+            totw += w;
+        }
+        for (int i = 0; i < n; ++i) {
+            xb[i] /= totw;
+        }
+    }
+
+
+
+    /// Largest number of faces of any cell.
+    int WachspressCoord::maxNumFaces() const
+    {
+        return max_faces_;
+    }
+
+
+
+    /// Largest number of corners of any cell.
+    int WachspressCoord::maxNumCorners() const
+    {
+        return max_corners_;
+    }
+
+
+
 } // namespace Opm
@@ -56,6 +56,31 @@ namespace Opm
                         const double* x,
                         double* xb) const;
 
+        /// Compute generalized barycentric coordinates for some point x
+        /// with respect to the vertices of a grid cell, using face data
+        /// cached by the constructor.
+        ///
+        /// Gives the same result as the other overload, but evaluates
+        /// the factor of each face once instead of once per corner, and
+        /// reads the face data from contiguous per-cell arrays. Thread
+        /// safe as long as each thread uses its own workspace.
+        /// \param[in]  cell   Cell in which to compute coordinates.
+        /// \param[in]  x      Coordinates of point in cartesian coordinates.
+        ///                    Must be array of length grid.dimensions.
+        /// \param[out] xb     Coordinates of point in barycentric coordinates.
+        ///                    Must be array of length numCorners(cell).
+        /// \param[out] work   Workspace. Must be array of length maxNumFaces().
+        void cartToBary(const int cell,
+                        const double* x,
+                        double* xb,
+                        double* work) const;
+
+        /// Largest number of faces of any cell.
+        int maxNumFaces() const;
+
+        /// Largest number of corners of any cell.
+        int maxNumCorners() const;
+
         // A corner is here defined as a {cell, vertex} pair where the
         // vertex is adjacent to the cell.
         struct CornerInfo
@@ -78,6 +103,16 @@ namespace Opm
         SparseTable<CornerInfo> corner_info_;   // Corner info by cell.
         std::vector<int> adj_faces_;    // Set of adjacent faces, by corner id. Contains dim face indices per corner.
         SparseTable<int> nonadj_faces_; // Set of nonadjacent faces, by corner id.
+
+        // Cached data for the workspace version of cartToBary(), stored by
+        // half-face (the cell_faces ordering) and by corner id.
+        std::vector<double> hf_normal_;     // Outward face normals, dim arrays of length #half-faces.
+        std::vector<double> hf_offset_;     // Outward normal times face centroid, by half-face.
+        std::vector<double> corner_volume_; // Corner volumes, by corner id.
+        std::vector<int> corner_start_;     // First corner id of each cell, size #cells + 1.
+        SparseTable<int> nonadj_local_;     // Nonadjacent faces as positions within the cell's faces, by corner id.
+        int max_faces_ = 0;
+        int max_corners_ = 0;
     };
 
 } // namespace Opm
@@ -0,0 +1,290 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef OPM_WEIGHTED_ELEMENT_CHUNKS_HEADER
+#define OPM_WEIGHTED_ELEMENT_CHUNKS_HEADER
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace Opm
+{
+
+/// Element chunks balanced by per-element cost, executed with work
+/// stealing.
+///
+/// Like ElementChunks the chunks are contiguous ranges of the element
+/// iteration, stored as iterator pairs, but the boundaries are placed such
+/// that every chunk has about the same total cost. Costs can be given per
+/// element, or learned from the chunk timings recorded by run():
+///
+/// WeightedElementChunks chunks(gridview, Dune::Partitions::all, num_chunks);
+/// for (int sweep = 0; sweep < num_sweeps; ++sweep) {
+///     chunks.run([&](const auto& chunk) {
+///         for (const auto& elem : chunk) {
+///             // Do something with elem
+///         }
+///     });
+///     chunks.rebalance();
+/// }
+///
+/// run() assigns each thread a fixed contiguous block of chunks and lets
+/// threads that finish early steal remaining chunks from the others, using
+/// one atomic counter per thread and no locks. Since the boundaries only
+/// change when rebalance() finds a sufficiently large imbalance, threads
+/// revisit the same elements from sweep to sweep.
+///
+/// The chunks can also be used directly in an OpenMP loop, as with
+/// ElementChunks.
+template <class GridView, class PartitionSet>
+class WeightedElementChunks
+{
+private:
+    using Iter = decltype(std::begin(elements(std::declval<const GridView&>(), PartitionSet())));
+    using Storage = std::vector<Iter>;
+    using StorageIter = decltype(Storage().cbegin());
+
+public:
+    /// Create chunks with uniform element costs.
+    WeightedElementChunks(const GridView& gv,
+                          const PartitionSet included_partition,
+                          const std::size_t num_chunks)
+        : WeightedElementChunks(gv, included_partition, num_chunks, std::vector<double>())
+    {
+    }
+
+    /// Create chunks balancing the given element costs.
+    ///
+    /// \param[in] weights  Cost of each element, indexed by the index set
+    ///                     of the grid view. Empty means uniform costs.
+    WeightedElementChunks(const GridView& gv,
+                          const PartitionSet included_partition,
+                          const std::size_t num_chunks,
+                          const std::vector<double>& weights)
+        : gv_(gv)
+        , partition_(included_partition)
+        , num_chunks_(num_chunks)
+    {
+        if (num_chunks < 1) {
+            throw std::logic_error("WeightedElementChunks must create at least one chunk.");
+        }
+        const auto& index_set = gv.indexSet();
+        for (const auto& elem : elements(gv, included_partition)) {
+            costs_.push_back(weights.empty() ? 1.0 : weights[index_set.index(elem)]);
+        }
+        createChunkIterators();
+    }
+
+    struct Chunk
+    {
+        Chunk(const Iter& i1, const Iter& i2) : pi_(i1, i2) {}
+        auto begin() const { return pi_.first; }
+        auto end() const { return pi_.second; }
+        std::pair<Iter, Iter> pi_;
+    };
+
+    struct ChunkIterator : public StorageIter
+    {
+        explicit ChunkIterator(const StorageIter& itit) : StorageIter(itit) {}
+        Chunk operator*() const
+        {
+            const StorageIter it = *this;
+            return Chunk{*it, *(it+1)};
+        }
+    };
+
+    auto begin() const
+    {
+        return ChunkIterator(grid_chunk_iterators_.begin());
+    }
+    auto end() const
+    {
+        return ChunkIterator(--grid_chunk_iterators_.end());
+    }
+    auto size() const
+    {
+        return grid_chunk_iterators_.size() - 1;
+    }
+
+    /// The chunk with the given number.
+    Chunk operator[](const std::size_t chunk) const
+    {
+        return Chunk{grid_chunk_iterators_[chunk], grid_chunk_iterators_[chunk + 1]};
+    }
+
+    /// Number of elements in each chunk.
+    const std::vector<std::size_t>& chunkSizes() const
+    {
+        return chunk_sizes_;
+    }
+
+    /// Call f(chunk) for every chunk, threaded with work stealing, and
+    /// record the time spent in each chunk.
+    template <class F>
+    void run(F&& f)
+    {
+        chunk_times_.assign(size(), 0.0);
+        const auto run_chunk = [&](const std::size_t chunk) {
+            const auto start = std::chrono::steady_clock::now();
+            f((*this)[chunk]);
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            chunk_times_[chunk] = elapsed.count();
+        };
+#ifdef _OPENMP
+        const std::size_t num_threads = std::min<std::size_t>(omp_get_max_threads(), size());
+        if (num_threads > 1) {
+            // Thread t owns chunks [first[t], first[t + 1]) and takes them
+            // in order through next[t]. Thieves take from the same counter.
+            std::vector<std::size_t> first(num_threads + 1);
+            for (std::size_t t = 0; t <= num_threads; ++t) {
+                first[t] = t * size() / num_threads;
+            }
+            std::vector<std::atomic<std::size_t>> next(num_threads);
+            for (std::size_t t = 0; t < num_threads; ++t) {
+                next[t].store(first[t], std::memory_order_relaxed);
+            }
+#pragma omp parallel num_threads(num_threads)
+            {
+                const std::size_t self = omp_get_thread_num();
+                for (std::size_t k = 0; k < num_threads; ++k) {
+                    const std::size_t victim = (self + k) % num_threads;
+                    for (std::size_t chunk = next[victim].fetch_add(1, std::memory_order_relaxed);
+                         chunk < first[victim + 1];
+                         chunk = next[victim].fetch_add(1, std::memory_order_relaxed)) {
+                        run_chunk(chunk);
+                    }
+                }
+            }
+            return;
+        }
+#endif
+        for (std::size_t chunk = 0; chunk < size(); ++chunk) {
+            run_chunk(chunk);
+        }
+    }
+
+    /// Time spent in each chunk during the last call to run().
+    const std::vector<double>& chunkTimes() const
+    {
+        return chunk_times_;
+    }
+
+    /// Rebalance using the chunk timings recorded by run(). Does nothing
+    /// if run() has not been called.
+    /// \see rebalance(const std::vector<double>&, double)
+    bool rebalance(const double tolerance = 0.1)
+    {
+        if (chunk_times_.empty()) {
+            return false;
+        }
+        return rebalance(chunk_times_, tolerance);
+    }
+
+    /// Update the element costs from measured chunk costs and move the
+    /// chunk boundaries if the costliest chunk exceeds the mean chunk cost
+    /// by more than the given relative tolerance.
+    ///
+    /// The element costs of each chunk are scaled to sum to the measured
+    /// cost, keeping their relative sizes within the chunk.
+    /// \return Whether the chunk boundaries changed.
+    bool rebalance(const std::vector<double>& chunk_costs, const double tolerance = 0.1)
+    {
+        if (chunk_costs.size() != size()) {
+            throw std::invalid_argument("WeightedElementChunks::rebalance() needs one cost per chunk.");
+        }
+        const double total = std::accumulate(chunk_costs.begin(), chunk_costs.end(), 0.0);
+        const double max_cost = *std::max_element(chunk_costs.begin(), chunk_costs.end());
+        if (total <= 0.0 || max_cost <= (1.0 + tolerance) * total / size()) {
+            return false;
+        }
+        auto pos = costs_.begin();
+        for (std::size_t chunk = 0; chunk < size(); ++chunk) {
+            const auto chunk_end = pos + chunk_sizes_[chunk];
+            const double old_cost = std::accumulate(pos, chunk_end, 0.0);
+            for (; pos != chunk_end; ++pos) {
+                *pos = old_cost > 0.0
+                    ? *pos * chunk_costs[chunk] / old_cost
+                    : chunk_costs[chunk] / chunk_sizes_[chunk];
+            }
+        }
+        const auto old_sizes = chunk_sizes_;
+        createChunkIterators();
+        return chunk_sizes_ != old_sizes;
+    }
+
+private:
+    /// Place the chunk boundaries where the cumulative cost crosses
+    /// multiples of the mean chunk cost.
+    void createChunkIterators()
+    {
+        double total = std::accumulate(costs_.begin(), costs_.end(), 0.0);
+        if (total <= 0.0) {
+            std::fill(costs_.begin(), costs_.end(), 1.0);
+            total = costs_.size();
+        }
+        grid_chunk_iterators_.clear();
+        grid_chunk_iterators_.reserve(num_chunks_ + 1);
+        chunk_sizes_.assign(num_chunks_, 0);
+
+        const auto& range = elements(gv_, partition_);
+        auto it = std::begin(range);
+        const auto end = std::end(range);
+        grid_chunk_iterators_.push_back(it);
+        double cumulative = 0.0;
+        std::size_t chunk = 0;
+        for (std::size_t pos = 0; it != end; ++it, ++pos) {
+            // Start the next chunk when the midpoint of this element lies
+            // beyond the end of the current one, never leaving it empty.
+            if (chunk + 1 < num_chunks_ && chunk_sizes_[chunk] > 0
+                && cumulative + 0.5 * costs_[pos] > total * (chunk + 1) / num_chunks_) {
+                grid_chunk_iterators_.push_back(it);
+                ++chunk;
+            }
+            ++chunk_sizes_[chunk];
+            cumulative += costs_[pos];
+        }
+        // Empty chunks at the end if there are more chunks than elements.
+        while (grid_chunk_iterators_.size() < num_chunks_ + 1) {
+            grid_chunk_iterators_.push_back(end);
+        }
+    }
+
+    GridView gv_;
+    PartitionSet partition_;
+    std::size_t num_chunks_;
+    std::vector<double> costs_;
+    Storage grid_chunk_iterators_;
+    std::vector<std::size_t> chunk_sizes_;
+    std::vector<double> chunk_times_;
+};
+
+
+} // namespace Opm
+
+#endif // OPM_WEIGHTED_ELEMENT_CHUNKS_HEADER
@@ -33,6 +33,8 @@ namespace Opm
     //                         to active/compressed,
     //                         or the map { {0, 0}, {1, 1}, ... , {num_cells - 1, num_cells - 1} }
     //                         if global_cell was null.
+    // For frequent lookups on large grids, prefer CartesianToCompressedMap,
+    // which avoids hashing both at construction and at lookup.
     std::unordered_map<int, int> cartesianToCompressed(const int num_cells,
                                                        const int* global_cell);
 
@@ -0,0 +1,179 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef OPM_FIRSTTOUCH_HEADER_INCLUDED
+#define OPM_FIRSTTOUCH_HEADER_INCLUDED
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Opm
+{
+
+    /// Boundaries of the chunks created by createChunkIterators() for a
+    /// range of num_elem elements, as num_chunks + 1 element positions.
+    /// Chunk c covers positions [b[c], b[c + 1]).
+    inline std::vector<std::size_t> chunkBoundaries(const std::size_t num_elem,
+                                                    const std::size_t num_chunks)
+    {
+        std::vector<std::size_t> b(num_chunks + 1, num_elem);
+        b[0] = 0;
+        if (num_chunks > 1) {
+            const std::size_t chunk_size = std::max(num_elem / num_chunks, std::size_t(1));
+            for (std::size_t c = 1; c < num_chunks; ++c) {
+                b[c] = std::min(c * chunk_size, num_elem);
+            }
+        }
+        return b;
+    }
+
+
+    template <class T, class A>
+    class FirstTouchAllocator;
+
+    namespace detail
+    {
+        /// True while firstTouch() resizes its new storage on this thread.
+        inline bool& deferDefaultConstruction()
+        {
+            static thread_local bool defer = false;
+            return defer;
+        }
+
+        template <class Alloc>
+        struct IsFirstTouchAllocator : std::false_type {};
+
+        template <class T, class A>
+        struct IsFirstTouchAllocator<FirstTouchAllocator<T, A>> : std::true_type {};
+    } // namespace detail
+
+
+    /// Allocator adaptor for arrays that firstTouch() moves.
+    ///
+    /// It behaves like A, except that the argument-less construct() calls
+    /// made while firstTouch() resizes its new storage do nothing, leaving
+    /// the new pages unwritten. firstTouch() then copy-constructs each
+    /// element from the thread owning its block.
+    template <class T, class A = std::allocator<T>>
+    class FirstTouchAllocator : public A
+    {
+        using Traits = std::allocator_traits<A>;
+
+    public:
+        template <class U>
+        struct rebind
+        {
+            using other = FirstTouchAllocator<U, typename Traits::template rebind_alloc<U>>;
+        };
+
+        using A::A;
+
+        template <class U>
+        void construct(U* ptr)
+        {
+            if (!detail::deferDefaultConstruction()) {
+                Traits::construct(static_cast<A&>(*this), ptr);
+            }
+        }
+
+        template <class U, class... Args>
+        void construct(U* ptr, Args&&... args)
+        {
+            Traits::construct(static_cast<A&>(*this), ptr, std::forward<Args>(args)...);
+        }
+    };
+
+
+    /// Move the storage of a vector to new memory, writing the elements
+    /// [b[c], b[c + 1]) from thread c of an OpenMP team of b.size() - 1
+    /// threads with a static schedule.
+    ///
+    /// Operating systems with a first-touch policy place each page on the
+    /// NUMA node of the thread that first writes to it. For a vector using
+    /// FirstTouchAllocator with elements that are nothrow copy
+    /// constructible, the new storage is not written before the threads
+    /// copy-construct the elements, so loops over the same chunks with a
+    /// static schedule, such as OpenMP loops over an ElementChunks object
+    /// with one chunk per thread, then access memory local to the thread.
+    /// For other vectors the resize already writes the new storage from
+    /// the calling thread, and this only copies the elements in parallel.
+    ///
+    /// The vector keeps its size and contents. Without OpenMP this only
+    /// copies the vector.
+    template <class Vector>
+    void firstTouch(Vector& v, const std::vector<std::size_t>& b)
+    {
+        using Alloc = typename Vector::allocator_type;
+        constexpr bool deferred = detail::IsFirstTouchAllocator<Alloc>::value
+            && std::is_nothrow_copy_constructible<typename Vector::value_type>::value;
+
+        Vector fresh(v.get_allocator());
+        if constexpr (deferred) {
+            struct Defer
+            {
+                Defer() { detail::deferDefaultConstruction() = true; }
+                ~Defer() { detail::deferDefaultConstruction() = false; }
+            } defer;
+            fresh.resize(v.size());
+        } else {
+            fresh.resize(v.size());
+        }
+
+        // Write the elements [begin, end) of fresh, constructing them if
+        // the resize above did not.
+        const auto place = [&v, &fresh](const std::size_t begin, const std::size_t end) {
+            if constexpr (deferred) {
+                auto alloc = fresh.get_allocator();
+                for (std::size_t i = begin; i < end; ++i) {
+                    std::allocator_traits<Alloc>::construct(alloc, fresh.data() + i, v[i]);
+                }
+            } else {
+                std::copy(v.begin() + begin, v.begin() + end, fresh.begin() + begin);
+            }
+        };
+
+        if (v.size() > 0 && b.size() > 1) {
+            const int num_blocks = b.size() - 1;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1) num_threads(num_blocks)
+#endif
+            for (int c = 0; c < num_blocks; ++c) {
+                const std::size_t begin = std::min(b[c], v.size());
+                const std::size_t end = std::min(b[c + 1], v.size());
+                if (end > begin) {
+                    place(begin, end);
+                }
+            }
+            // Elements outside the blocks.
+            const std::size_t first = std::min(b.front(), v.size());
+            const std::size_t last = std::max(first, std::min(b.back(), v.size()));
+            place(0, first);
+            place(last, v.size());
+        } else {
+            place(0, v.size());
+        }
+        v.swap(fresh);
+    }
+
+} // namespace Opm
+
+#endif // OPM_FIRSTTOUCH_HEADER_INCLUDED
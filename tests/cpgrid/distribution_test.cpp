@@ -27,7 +27,9 @@
 #include <opm/grid/utility/platform_dependent/reenable_warnings.h>
 #include <dune/grid/common/mcmgmapper.hh>
 
+#include <cstdio>
 #include <numeric>
+#include <string>
 
 #if defined(HAVE_ZOLTAN) && defined(HAVE_METIS)
 const int partition_methods[] = {1,2};
@@ -820,6 +822,120 @@ BOOST_AUTO_TEST_CASE(cellGatherScatterWithMPIWithoutZoltan)
 #endif
 }
 
+// Scattering and gathering data has to keep working after the
+// topology and geometry of the global view have been released.
+BOOST_AUTO_TEST_CASE(cellGatherScatterAfterReleasingGlobalView)
+{
+    Dune::CpGrid grid;
+    std::array<int, 3> dims={{8, 4, 2}};
+    std::array<double, 3> size={{ 8.0, 4.0, 2.0}};
+    grid.createCartesian(dims, size);
+    const Dune::CpGrid::GlobalIdSet& unbalanced_gid_set=grid.globalIdSet();
+
+    if (!grid.loadBalance(1, 0))
+    {
+        // Nothing was distributed, so there is no global view to release.
+        BOOST_CHECK_THROW(grid.releaseGlobalView(), std::logic_error);
+        return;
+    }
+    auto global_grid = grid;
+    global_grid.switchToGlobalView();
+    const std::vector<int> global_cell = global_grid.globalCell();
+    const int global_size = global_grid.size(0);
+
+    grid.releaseGlobalView();
+    BOOST_REQUIRE(grid.globalViewReleased());
+    BOOST_CHECK_THROW(grid.switchToGlobalView(), std::logic_error);
+    BOOST_REQUIRE(global_grid.size(0) == global_size);
+
+    auto scatter_handle = CheckGlobalCellHandle(global_cell, grid.globalCell());
+    auto gather_handle  = CheckGlobalCellHandle(grid.globalCell(), global_cell);
+#if HAVE_MPI
+    Dune::VariableSizeCommunicator<> scatter_gather_comm(grid.comm(), grid.cellScatterGatherInterface(), 8*4*2*8);
+    scatter_gather_comm.forward(scatter_handle);
+    scatter_gather_comm.backward(gather_handle);
+#else
+    (void) scatter_handle;
+    (void) gather_handle;
+#endif
+
+    std::vector<int> point_ids(grid.leafIndexSet().size(3)), cell_ids(grid.leafIndexSet().size(0));
+    LoadBalanceGlobalIdDataHandle lb_gid_data(unbalanced_gid_set,
+                                              grid,
+                                              point_ids,
+                                              cell_ids);
+    grid.scatterData(lb_gid_data);
+    GatherGlobalIdDataHandle gather_gid_set_data(unbalanced_gid_set,
+                                                 grid.leafIndexSet(),
+                                                 point_ids,
+                                                 cell_ids);
+    grid.gatherData(gather_gid_set_data);
+}
+
+BOOST_AUTO_TEST_CASE(distributedCheckpointRestart)
+{
+    Dune::CpGrid grid;
+    std::array<int, 3> dims={{8, 4, 2}};
+    std::array<double, 3> size={{ 8.0, 4.0, 2.0}};
+    grid.createCartesian(dims, size);
+    const std::string basename = "distribution_test_checkpoint";
+
+    if (!grid.loadBalance(1, 0))
+    {
+        // Nothing was distributed, so there is nothing to checkpoint.
+        BOOST_CHECK_THROW(grid.writeDistributedCheckpoint(basename), std::logic_error);
+        return;
+    }
+    const auto written_hash = grid.writeDistributedCheckpoint(basename);
+
+    Dune::CpGrid restarted;
+    BOOST_CHECK_THROW(restarted.readDistributedCheckpoint(basename + "_missing"), std::runtime_error);
+    const auto read_hash = restarted.readDistributedCheckpoint(basename);
+    BOOST_CHECK_EQUAL(read_hash, written_hash);
+    BOOST_CHECK_THROW(restarted.switchToGlobalView(), std::logic_error);
+    BOOST_CHECK_THROW(grid.readDistributedCheckpoint(basename), std::logic_error);
+
+    for (int codim : {0, 1, 3})
+        BOOST_REQUIRE_EQUAL(restarted.size(codim), grid.size(codim));
+    BOOST_CHECK(restarted.globalCell() == grid.globalCell());
+    BOOST_CHECK(restarted.logicalCartesianSize() == grid.logicalCartesianSize());
+
+    const auto& gv = grid.leafGridView();
+    const auto& restarted_gv = restarted.leafGridView();
+    auto restarted_element = restarted_gv.begin<0>();
+    for (const auto& element : elements(gv))
+    {
+        BOOST_CHECK_EQUAL(restarted_element->partitionType(), element.partitionType());
+        BOOST_CHECK_EQUAL(restarted.globalIdSet().id(*restarted_element), grid.globalIdSet().id(element));
+        BOOST_CHECK_CLOSE(restarted_element->geometry().volume(), element.geometry().volume(), 1e-12);
+        const auto center = element.geometry().center();
+        const auto restarted_center = restarted_element->geometry().center();
+        for (int d = 0; d < 3; ++d)
+            BOOST_CHECK_CLOSE(restarted_center[d], center[d], 1e-12);
+        ++restarted_element;
+    }
+    auto restarted_vertex = restarted_gv.begin<3>();
+    for (const auto& vertex : vertices(gv))
+    {
+        BOOST_CHECK_EQUAL(restarted_vertex->partitionType(), vertex.partitionType());
+        BOOST_CHECK_EQUAL(restarted.globalIdSet().id(*restarted_vertex), grid.globalIdSet().id(vertex));
+        ++restarted_vertex;
+    }
+
+#if HAVE_MPI
+    // Owner to overlap communication has to work on the restarted grid.
+    const auto& restarted_ids = restarted.globalIdSet();
+    std::vector<int> ids(restarted.size(0), -1);
+    for (const auto& element : elements(restarted_gv, Dune::Partitions::interior))
+        ids[restarted_gv.indexSet().index(element)] = restarted_ids.id(element);
+    restarted.cellCommunication().copyOwnerToAll(ids, ids);
+    for (const auto& element : elements(restarted_gv))
+        BOOST_CHECK_EQUAL(ids[restarted_gv.indexSet().index(element)], restarted_ids.id(element));
+#endif
+
+    std::remove((basename + "." + std::to_string(grid.comm().rank())).c_str());
+}
+
 BOOST_AUTO_TEST_CASE(intersectionOverlap)
 {
 for (auto partition_method : partition_methods) {
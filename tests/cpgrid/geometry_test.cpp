@@ -397,7 +397,7 @@ void refine_and_check(const cpgrid::Geometry<3, 3>& parent_geometry,
     cpgrid::OrientedEntityTable<0, 1>& cell_to_face = child_view_data.cell_to_face_;
     Opm::SparseTable<int>& face_to_point = child_view_data.face_to_point_;
     DefaultGeometryPolicy& geometries = child_view_data.geometry_;
-    std::vector<std::array<int, 8>>& cell_to_point = child_view_data.cell_to_point_;
+    cpgrid::CellToPointTable& cell_to_point = child_view_data.cell_to_point_;
     cpgrid::OrientedEntityTable<1,0>& face_to_cell = child_view_data.face_to_cell_;
     cpgrid::EntityVariable<enum face_tag, 1>& face_tags = child_view_data.face_tag_;
     cpgrid::SignedEntityVariable<Dune::FieldVector<double,3>, 1>& face_normals = child_view_data.face_normals_;
@@ -166,6 +166,15 @@ SCHEDULE
 
     // Invalid LGR should throw an exception
     BOOST_CHECK_THROW(Opm::lgrIJK(grid, "LGR2DOESNOTEXIST"), std::runtime_error);
+    BOOST_CHECK_THROW(Opm::lgrIJKWithCompressedMap(grid, "LGR2DOESNOTEXIST"), std::runtime_error);
+
+    // The dense map variant agrees with the hash map one.
+    const auto [compressedMap, compressedIJK] = Opm::lgrIJKWithCompressedMap(grid, "LGR1");
+    BOOST_CHECK(compressedIJK == lgr1IJK);
+    BOOST_CHECK_EQUAL(compressedMap.size(), lgrCartesianIdxToCellIdx.size());
+    for (const auto& [cartesianIdx, cellIdx] : lgrCartesianIdxToCellIdx) {
+        BOOST_CHECK_EQUAL(compressedMap.at(cartesianIdx), cellIdx);
+    }
 
     // LGR1 dimension 6x6x3
     //  Visual representation per k-layer:
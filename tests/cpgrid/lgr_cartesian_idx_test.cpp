@@ -124,6 +124,8 @@ void checkGlobalCellLgr(Dune::CpGrid& grid)
 
     const auto& localCartesianIdxSets_to_leafIdx = grid.mapLocalCartesianIndexSetsToLeafIndexSet();
     const auto& leafIdx_to_localCartesianIdxSets = grid.mapLeafIndexSetToLocalCartesianIndexSets();
+    const auto& localCartesianIdx_to_leafIdx = grid.mapLocalCartesianIndicesToLeafIndices();
+    BOOST_CHECK_EQUAL(localCartesianIdx_to_leafIdx.size(), localCartesianIdxSets_to_leafIdx.size());
     
     for (int level = 0; level < grid.maxLevel(); ++level)
     {
@@ -134,9 +136,11 @@ void checkGlobalCellLgr(Dune::CpGrid& grid)
                 const auto& leaf_idx = localCartesianIdxSets_to_leafIdx[element.level()].at(global_cell_level);
                 BOOST_CHECK_EQUAL( leafIdx_to_localCartesianIdxSets[leaf_idx][0], element.level());
                 BOOST_CHECK_EQUAL( leafIdx_to_localCartesianIdxSets[leaf_idx][1], global_cell_level);
+                BOOST_CHECK_EQUAL( localCartesianIdx_to_leafIdx[element.level()][global_cell_level], leaf_idx);
             }
             else {
                 BOOST_CHECK_THROW( localCartesianIdxSets_to_leafIdx[element.level()].at(global_cell_level), std::out_of_range);
+                BOOST_CHECK_EQUAL( localCartesianIdx_to_leafIdx[element.level()][global_cell_level], -1);
             }
         }
     }
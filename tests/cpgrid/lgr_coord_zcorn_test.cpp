@@ -52,6 +52,7 @@
 
 
 #include <array>
+#include <map>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -80,6 +81,41 @@ void createGridAndAddTestLgr(Dune::CpGrid& grid,
                               {"LGR1"});
 }
 
+// Check that streamCOORDandZCORN() produces the arrays of lgrCOORDandZCORN() for all levels.
+void checkStreamedCOORDandZCORN(const Dune::CpGrid& grid)
+{
+    std::vector<int> levels;
+    std::map<int, std::array<std::vector<double>, 2>> streamed;
+    std::map<int, bool> in_order;
+    for (const auto& [lgr_name, level] : grid.getLgrNameToLevel()) {
+        levels.push_back(level);
+        streamed[level];
+        in_order[level] = true;
+    }
+
+    Opm::streamCOORDandZCORN(grid, levels,
+                             [&streamed, &in_order](int level, Opm::CornerPointArray array, std::size_t offset,
+                                                    const double* values, std::size_t count)
+                             {
+                                 // Called concurrently for different levels, so no checks in here.
+                                 auto& arr = streamed.at(level)[array == Opm::CornerPointArray::ZCORN];
+                                 in_order.at(level) = in_order.at(level) && arr.size() == offset;
+                                 arr.insert(arr.end(), values, values + count);
+                             });
+
+    // With several processes only rank 0 receives the values.
+    if (grid.comm().rank() != 0) {
+        return;
+    }
+    for (const auto& [lgr_name, level] : grid.getLgrNameToLevel()) {
+        const auto [lgrCartesianIdxToCellIdx, lgrIJK] = Opm::lgrIJKWithCompressedMap(grid, lgr_name);
+        const auto [lgrCOORD, lgrZCORN] = Opm::lgrCOORDandZCORN(grid, level, lgrCartesianIdxToCellIdx, lgrIJK);
+        BOOST_CHECK(in_order[level]);
+        BOOST_CHECK(streamed[level][0] == lgrCOORD);
+        BOOST_CHECK(streamed[level][1] == lgrZCORN);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(fullActiveParentCellsBlock)
 {
     const std::string deck_string = R"(
@@ -128,7 +164,7 @@ SCHEDULE
     Dune::CpGrid grid;
     createGridAndAddTestLgr(grid, deck_string);
 
-    const auto [lgrCartesianIdxToCellIdx, lgr1IJK] = Opm::lgrIJK(grid, "LGR1");
+    const auto [lgrCartesianIdxToCellIdx, lgr1IJK] = Opm::lgrIJKWithCompressedMap(grid, "LGR1");
 
     const int lgr1_level = grid.getLgrNameToLevel().at("LGR1");
 
@@ -140,6 +176,8 @@ SCHEDULE
         std::cout << coord << std::endl;
     }
     std::cout<< std::endl;
+
+    checkStreamedCOORDandZCORN(grid);
 }
 
 
@@ -212,7 +250,7 @@ SCHEDULE
 
     const int lgr1_level = grid.getLgrNameToLevel().at("LGR1");
 
-    const auto [lgrCartesianIdxToCellIdx, lgr1IJK] = Opm::lgrIJK(grid, "LGR1");
+    const auto [lgrCartesianIdxToCellIdx, lgr1IJK] = Opm::lgrIJKWithCompressedMap(grid, "LGR1");
 
     const auto [lgrCOORD, lgrZCORN] = Opm::lgrCOORDandZCORN(grid, lgr1_level, lgrCartesianIdxToCellIdx, lgr1IJK);
     const int nx = 8;
@@ -266,6 +304,8 @@ SCHEDULE
             }
         }
     }
+
+    checkStreamedCOORDandZCORN(grid);
 }
 
 
@@ -337,7 +377,7 @@ SCHEDULE
 
     const int lgr1_level = grid.getLgrNameToLevel().at("LGR1");
 
-    const auto [lgrCartesianIdxToCellIdx, lgr1IJK] = Opm::lgrIJK(grid, "LGR1");
+    const auto [lgrCartesianIdxToCellIdx, lgr1IJK] = Opm::lgrIJKWithCompressedMap(grid, "LGR1");
 
     // If a pillar within the LGR block is "inactive," its COORD values are set to
     // std::numeric_limits<double>::max() to indicate the inactive status
@@ -411,8 +451,80 @@ SCHEDULE
 
     const int lgr1_level = grid.getLgrNameToLevel().at("LGR1");
 
-    const auto [lgrCartesianIdxToCellIdx, lgr1IJK] = Opm::lgrIJK(grid, "LGR1");
+    const auto [lgrCartesianIdxToCellIdx, lgr1IJK] = Opm::lgrIJKWithCompressedMap(grid, "LGR1");
 
     // All inactive cells, therefore lgrCOORD(...) throws an exception
     BOOST_CHECK_THROW(Opm::lgrCOORDandZCORN(grid, lgr1_level, lgrCartesianIdxToCellIdx, lgr1IJK), std::logic_error);
 }
+
+BOOST_AUTO_TEST_CASE(distributedStreamMatchesSerialArrays)
+{
+    // Every column has its own depth, so neighbouring columns disagree on the
+    // shared pillars as across faults.
+    const std::string deck_string = R"(
+RUNSPEC
+DIMENS
+  4 2 2 /
+GRID
+DX
+  16*100 /
+DY
+  16*100 /
+DZ
+  16*10 /
+TOPS
+  1000 1003 1001 1007
+  1002 1005 1004 1006 /
+PORO
+  16*0.15 /
+)";
+    const std::vector<std::array<int, 3>> cells_per_dim_vec = {{2, 2, 2}};
+    const std::vector<std::array<int, 3>> startIJK_vec = {{0, 0, 0}};
+    const std::vector<std::array<int, 3>> endIJK_vec = {{4, 2, 2}};
+    const std::vector<std::string> lgr_name_vec = {"LGR1"};
+
+    // The grid on every process, as the reference.
+    Dune::CpGrid serial_grid;
+    Opm::createGridAndAddLgrs(serial_grid, deck_string, cells_per_dim_vec, startIJK_vec, endIJK_vec, lgr_name_vec);
+    const int level = serial_grid.getLgrNameToLevel().at("LGR1");
+    const auto [lgrCartesianIdxToCellIdx, lgrIJK] = Opm::lgrIJKWithCompressedMap(serial_grid, "LGR1");
+    const auto [lgrCOORD, lgrZCORN] = Opm::lgrCOORDandZCORN(serial_grid, level, lgrCartesianIdxToCellIdx, lgrIJK);
+
+    Dune::CpGrid grid;
+    {
+        const auto deck = Opm::Parser{}.parseString(deck_string);
+        Opm::EclipseState ecl_state(deck);
+        Opm::EclipseGrid eclipse_grid = ecl_state.getInputGrid();
+        grid.processEclipseFormat(&eclipse_grid, &ecl_state, false, false, false);
+    }
+    if (grid.comm().size() > 1) {
+        // Columns with i < 2 on rank 0, except that the lower layer of column (1,0)
+        // is on rank 1, so its top and bottom cells are on different processes.
+        std::vector<int> parts(16);
+        for (int cell = 0; cell < 16; ++cell) {
+            parts[cell] = (cell % 4) < 2 ? 0 : 1;
+        }
+        parts[1 + 8] = 1;
+        grid.loadBalance(parts, false /*ownerFirst*/, true /*addCornerCells*/);
+    }
+    grid.addLgrsUpdateLeafView(cells_per_dim_vec, startIJK_vec, endIJK_vec, lgr_name_vec);
+
+    std::array<std::vector<double>, 2> streamed;
+    int num_calls = 0;
+    Opm::streamCOORDandZCORN(grid, {level},
+                             [&streamed, &num_calls](int, Opm::CornerPointArray array, std::size_t offset,
+                                                     const double* values, std::size_t count)
+                             {
+                                 auto& arr = streamed[array == Opm::CornerPointArray::ZCORN];
+                                 BOOST_CHECK_EQUAL(arr.size(), offset);
+                                 arr.insert(arr.end(), values, values + count);
+                                 ++num_calls;
+                             });
+
+    if (grid.comm().rank() == 0) {
+        BOOST_CHECK(streamed[0] == lgrCOORD);
+        BOOST_CHECK(streamed[1] == lgrZCORN);
+    } else {
+        BOOST_CHECK_EQUAL(num_calls, 0);
+    }
+}
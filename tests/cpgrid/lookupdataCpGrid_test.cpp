@@ -204,6 +204,36 @@ BOOST_AUTO_TEST_CASE(one_lgr_grid)
     lookup_check(grid);
 }
 
+BOOST_AUTO_TEST_CASE(fieldPropIdxCacheFollowsGridChanges)
+{
+    Dune::CpGrid grid;
+    grid.createCartesian({4,3,3}, {1.0, 1.0, 1.0});
+    const auto leaf_view = grid.leafGridView();
+    const Opm::LookUpData<Dune::CpGrid, Dune::GridView<Dune::DefaultLeafGridViewTraits<Dune::CpGrid>>> lookUpData(leaf_view);
+
+    // Concurrent const calls build the cache only once, under a lock.
+    std::vector<std::size_t> sizes(8);
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for (int i = 0; i < 8; ++i) {
+        sizes[i] = lookUpData.fieldPropIdxOnLeaf().size();
+    }
+    for (const auto size : sizes) {
+        BOOST_CHECK_EQUAL(size, 36);
+    }
+
+    const auto generation = grid.generation();
+    grid.addLgrsUpdateLeafView({{2,2,2}}, {{1,0,1}}, {{3,2,3}}, {"LGR1"});
+    BOOST_CHECK(grid.generation() != generation);
+
+    const auto& fieldPropIdxOnLeaf = lookUpData.fieldPropIdxOnLeaf();
+    BOOST_REQUIRE_EQUAL(fieldPropIdxOnLeaf.size(), leaf_view.size(0));
+    for (const auto& elem : elements(leaf_view)) {
+        BOOST_CHECK_EQUAL(fieldPropIdxOnLeaf[elem.index()], lookUpData.getFieldPropIdx(elem));
+    }
+}
+
 BOOST_AUTO_TEST_CASE(single_cell_lgr_grid)
 {
     // Create a grid
@@ -311,6 +341,30 @@ void fieldProp_check(const Dune::CpGrid& grid, Opm::EclipseGrid eclGrid, const s
 
     const auto& porvOnLeaf = lookUpData.assignFieldPropsDoubleOnLeaf(fpm, "PORV");
 
+    // Bulk assignment, against values computed here from the field properties of the origin or father cell.
+    const auto& doublePropsOnLeaf = lookUpData.bulkAssignFieldPropsDoubleOnLeaf(fpm, {"PORO", "PORV"});
+    const auto& intPropsOnLeaf = lookUpData.bulkAssignFieldPropsIntOnLeaf<int>(fpm, {"EQLNUM"}, true);
+    BOOST_REQUIRE_EQUAL(doublePropsOnLeaf.size(), 2);
+    BOOST_REQUIRE_EQUAL(intPropsOnLeaf.size(), 1);
+    BOOST_REQUIRE_EQUAL(doublePropsOnLeaf[0].size(), leaf_view.size(0));
+    BOOST_REQUIRE_EQUAL(doublePropsOnLeaf[1].size(), leaf_view.size(0));
+    BOOST_REQUIRE_EQUAL(intPropsOnLeaf[0].size(), leaf_view.size(0));
+    for (const auto& elem : elements(leaf_view)) {
+        const auto elemIdx = mapper.index(elem);
+        const auto originIdx = elem.getOrigin().index();
+        const double expectedPorv = elem.hasFather()
+            ? porv[elem.father().index()] * elem.geometry().volume() / elem.father().geometry().volume()
+            : porv[originIdx];
+        BOOST_CHECK_EQUAL(doublePropsOnLeaf[0][elemIdx], poro[originIdx]);
+        BOOST_CHECK_CLOSE(doublePropsOnLeaf[1][elemIdx], expectedPorv, 1e-12);
+        BOOST_CHECK_EQUAL(intPropsOnLeaf[0][elemIdx], eqlnum[originIdx] - 1);
+    }
+    const auto& fieldPropIdxOnLeaf = lookUpData.fieldPropIdxOnLeaf();
+    BOOST_REQUIRE_EQUAL(fieldPropIdxOnLeaf.size(), leaf_view.size(0));
+    for (const auto& elem : elements(leaf_view)) {
+        BOOST_CHECK_EQUAL(fieldPropIdxOnLeaf[mapper.index(elem)], lookUpData.getFieldPropIdx(elem));
+    }
+
     for (const auto& elem : elements(leaf_view))
     {
         const auto elemIdx = mapper.index(elem);
@@ -87,7 +87,7 @@ Opm::EclipseGrid createAndSetUpGrid(const std::string& deck_string,
     grid.addLgrsUpdateLeafView(cells_per_dim_vec, startIJK_vec, endIJK_vec, lgr_name_vec);
 
     //Create a new EclpseGrid for output using dims and zcorn and coords from level zero
-    const auto [l0CartesianIdxToCellIdx, l0IJK] = Opm::lgrIJK(grid, "GLOBAL");
+    const auto [l0CartesianIdxToCellIdx, l0IJK] = Opm::lgrIJKWithCompressedMap(grid, "GLOBAL");
     const auto [l0COORD, l0ZCORN] = Opm::lgrCOORDandZCORN(grid, 0, l0CartesianIdxToCellIdx, l0IJK);
     Opm::EclipseGrid eclipse_grid_output(global_grid_dim, l0COORD, l0ZCORN);
 
@@ -101,7 +101,7 @@ Opm::EclipseGrid createAndSetUpGrid(const std::string& deck_string,
             continue;
         }
 
-        const auto [lgrCartesianIdxToCellIdx, lgrIJK] = Opm::lgrIJK(grid, lgr_name);
+        const auto [lgrCartesianIdxToCellIdx, lgrIJK] = Opm::lgrIJKWithCompressedMap(grid, lgr_name);
         const auto [lgrCOORD, lgrZCORN] = Opm::lgrCOORDandZCORN(grid, lgr_level, lgrCartesianIdxToCellIdx, lgrIJK);
 
         eclipse_grid_output.set_lgr_refinement(lgr_name, lgrCOORD, lgrZCORN);
@@ -0,0 +1,156 @@
+#include <config.h>
+
+#define BOOST_TEST_MODULE VtuWriterTests
+#define BOOST_TEST_NO_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <opm/grid/CpGrid.hpp>
+#include <opm/grid/cpgrid/VtuWriter.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+std::string readFile(const std::string& name)
+{
+    std::ifstream in(name, std::ios::binary);
+    BOOST_REQUIRE(in);
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+std::string attribute(const std::string& file, const std::string& tag, const std::string& name)
+{
+    const auto tag_pos = file.find(tag);
+    BOOST_REQUIRE(tag_pos != std::string::npos);
+    const auto pos = file.find(name + "=\"", tag_pos);
+    BOOST_REQUIRE(pos != std::string::npos);
+    const auto begin = pos + name.size() + 2;
+    return file.substr(begin, file.find('"', begin) - begin);
+}
+
+/// The values of an uncompressed appended array, found by the start of its
+/// DataArray tag.
+template<class T>
+std::vector<T> appendedArray(const std::string& file, const std::string& tag)
+{
+    const auto offset = std::stoull(attribute(file, tag, "offset"));
+    const auto data = file.find('_', file.find("<AppendedData")) + 1 + offset;
+    std::uint64_t bytes;
+    std::memcpy(&bytes, file.data() + data, sizeof(bytes));
+    std::vector<T> values(bytes / sizeof(T));
+    std::memcpy(values.data(), file.data() + data + sizeof(bytes), bytes);
+    return values;
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(serialVtu)
+{
+    Dune::CpGrid grid;
+    grid.createCartesian({2, 3, 4}, {1.0, 2.0, 3.0});
+    if (grid.comm().size() > 1)
+        return;
+
+    std::vector<double> cell_index(grid.size(0));
+    for (int c = 0; c < grid.size(0); ++c)
+        cell_index[c] = c;
+    std::vector<double> point_index(grid.size(3));
+    for (int p = 0; p < grid.size(3); ++p)
+        point_index[p] = p;
+
+    Dune::cpgrid::VtuWriter writer(grid);
+    writer.addCellData(cell_index, "index");
+    writer.addPointData(point_index, "index");
+    BOOST_CHECK_THROW(writer.addCellData(point_index, "wrong"), std::invalid_argument);
+    const std::string name = writer.write("vtu_writer_test");
+    BOOST_REQUIRE_EQUAL(name, "vtu_writer_test.vtu");
+
+    const std::string file = readFile(name);
+    BOOST_CHECK_EQUAL(attribute(file, "<Piece", "NumberOfPoints"), "60");
+    BOOST_CHECK_EQUAL(attribute(file, "<Piece", "NumberOfCells"), "24");
+
+    const auto cell_data = appendedArray<double>(file, "<CellData");
+    BOOST_CHECK(cell_data == cell_index);
+    const auto points = appendedArray<double>(file, "<Points");
+    const auto connectivity = appendedArray<std::int32_t>(file, "Name=\"connectivity\"");
+    const auto offsets = appendedArray<std::int64_t>(file, "Name=\"offsets\"");
+    const auto types = appendedArray<std::uint8_t>(file, "Name=\"types\"");
+    BOOST_REQUIRE_EQUAL(points.size(), 3 * 60u);
+    BOOST_REQUIRE_EQUAL(connectivity.size(), 8 * 24u);
+    BOOST_REQUIRE_EQUAL(offsets.size(), 24u);
+    BOOST_REQUIRE_EQUAL(types.size(), 24u);
+
+    // The VTK hexahedron corners are the Dune corners 0, 1, 3, 2, 4, 5, 7, 6.
+    const int dune_corner[8] = { 0, 1, 3, 2, 4, 5, 7, 6 };
+    for (const auto& element : elements(grid.leafGridView())) {
+        const int c = grid.leafGridView().indexSet().index(element);
+        BOOST_CHECK_EQUAL(offsets[c], 8 * (c + 1));
+        BOOST_CHECK_EQUAL(int(types[c]), 12);
+        for (int k = 0; k < 8; ++k) {
+            const auto corner = element.geometry().corner(dune_corner[k]);
+            const int p = connectivity[8 * c + k];
+            for (int d = 0; d < 3; ++d)
+                BOOST_CHECK_CLOSE(points[3 * p + d], corner[d], 1e-12);
+        }
+    }
+    std::remove(name.c_str());
+
+#if HAVE_ZLIB
+    Dune::cpgrid::VtuWriter compressed_writer(grid, -1, true);
+    compressed_writer.addCellData(cell_index, "index");
+    const std::string compressed = readFile(compressed_writer.write("vtu_writer_test"));
+    BOOST_CHECK_EQUAL(attribute(compressed, "<VTKFile", "compressor"), "vtkZLibDataCompressor");
+    std::remove(name.c_str());
+#else
+    BOOST_CHECK_THROW(Dune::cpgrid::VtuWriter(grid, -1, true), std::logic_error);
+#endif
+}
+
+BOOST_AUTO_TEST_CASE(parallelVtu)
+{
+    Dune::CpGrid grid;
+    grid.createCartesian({8, 4, 2}, {1.0, 1.0, 1.0});
+    if (!grid.loadBalance())
+        return;
+
+    int interior = 0;
+    for ([[maybe_unused]] const auto& element : elements(grid.leafGridView(), Dune::Partitions::interior))
+        ++interior;
+
+    Dune::cpgrid::VtuWriter writer(grid);
+    const std::string name = writer.write("vtu_writer_test_parallel");
+    BOOST_CHECK_EQUAL(name, "vtu_writer_test_parallel.pvtu");
+
+    const std::string piece_name = "vtu_writer_test_parallel-p" + std::to_string(grid.comm().rank()) + ".vtu";
+    const std::string piece = readFile(piece_name);
+    BOOST_CHECK_EQUAL(std::stoi(attribute(piece, "<Piece", "NumberOfCells")), interior);
+    BOOST_CHECK_EQUAL(grid.comm().sum(interior), 8 * 4 * 2);
+
+    grid.comm().barrier();
+    if (grid.comm().rank() == 0) {
+        const std::string pvtu = readFile(name);
+        for (int r = 0; r < grid.comm().size(); ++r)
+            BOOST_CHECK(pvtu.find("vtu_writer_test_parallel-p" + std::to_string(r) + ".vtu") != std::string::npos);
+        std::remove(name.c_str());
+    }
+    std::remove(piece_name.c_str());
+}
+
+bool
+init_unit_test_func()
+{
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    Dune::MPIHelper::instance(argc, argv);
+    boost::unit_test::unit_test_main(&init_unit_test_func, argc, argv);
+}
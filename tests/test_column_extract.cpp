@@ -7,6 +7,7 @@
 #include <boost/test/unit_test.hpp>
 #include <opm/grid/ColumnExtract.hpp>
 #include <opm/grid/GridManager.hpp>
+#include <opm/grid/CpGrid.hpp>
 
 #if HAVE_ECL_INPUT
 #include <opm/input/eclipse/Parser/Parser.hpp>
@@ -14,8 +15,12 @@
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 #endif
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <iostream>
+#include <utility>
+#include <vector>
 
 BOOST_AUTO_TEST_CASE(SingleColumnTest)
 {
@@ -62,6 +67,94 @@ BOOST_AUTO_TEST_CASE(FourByFourColumnTest)
 
 
 
+BOOST_AUTO_TEST_CASE(CompressedColumnTest)
+{
+    const int size_x = 4, size_y = 3, size_z = 5;
+    Opm::GridManager manager(size_x, size_y, size_z);
+
+    Opm::GridColumns columns;
+    Opm::extractColumns(*manager.c_grid(), columns);
+
+    BOOST_CHECK_EQUAL(columns.size(), size_x * size_y);
+    BOOST_CHECK(columns.spans_ranks.empty());
+    for (int c = 0; c < columns.size(); ++c) {
+        BOOST_CHECK_EQUAL(columns.pillar[c], c);
+        BOOST_REQUIRE_EQUAL(columns[c].size(), std::size_t(size_z));
+        for (int k = 0; k < size_z; ++k) {
+            BOOST_CHECK_EQUAL(columns[c][k], c + k*size_x*size_y);
+        }
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(CpGridColumnTest)
+{
+    int argc = boost::unit_test::framework::master_test_suite().argc;
+    char** argv = boost::unit_test::framework::master_test_suite().argv;
+    Dune::MPIHelper::instance(argc, argv);
+
+    const std::array<int, 3> dims = { 3, 4, 6 };
+    Dune::CpGrid grid;
+    grid.createCartesian(dims, { 1.0, 1.0, 1.0 });
+
+    Opm::GridManager manager(dims[0], dims[1], dims[2]);
+    std::vector<std::vector<int>> expected;
+    Opm::extractColumn(*manager.c_grid(), expected);
+
+    Opm::GridColumns columns;
+    Opm::extractColumns(grid, columns);
+    BOOST_REQUIRE_EQUAL(columns.size(), int(expected.size()));
+    for (int c = 0; c < columns.size(); ++c) {
+        BOOST_CHECK_EQUAL_COLLECTIONS(columns[c].begin(), columns[c].end(),
+                                      expected[c].begin(), expected[c].end());
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(DistributedCpGridColumnTest)
+{
+    int argc = boost::unit_test::framework::master_test_suite().argc;
+    char** argv = boost::unit_test::framework::master_test_suite().argv;
+    Dune::MPIHelper::instance(argc, argv);
+
+    const std::array<int, 3> dims = { 4, 3, 6 };
+    Dune::CpGrid grid;
+    grid.createCartesian(dims, { 1.0, 1.0, 1.0 });
+    if (grid.comm().size() < 2) {
+        return;
+    }
+
+    // Pillars with i < 2 go to rank 0 and the others to rank 1, except that
+    // the lower half of pillar 0 goes to rank 1 as well.
+    const int num_pillars = dims[0] * dims[1];
+    std::vector<int> parts(grid.size(0));
+    for (int c = 0; c < grid.size(0); ++c) {
+        const int pillar = c % num_pillars;
+        const int k = c / num_pillars;
+        parts[c] = (pillar % dims[0] < 2 && !(pillar == 0 && k >= dims[2] / 2)) ? 0 : 1;
+    }
+    grid.loadBalance(parts);
+
+    Opm::GridColumns columns;
+    Opm::extractColumns(grid, columns);
+    BOOST_REQUIRE_EQUAL(int(columns.spans_ranks.size()), columns.size());
+
+    const auto& global_cell = grid.globalCell();
+    int has_split_column = 0;
+    for (int c = 0; c < columns.size(); ++c) {
+        const bool split = columns.pillar[c] == 0;
+        BOOST_CHECK_EQUAL(bool(columns.spans_ranks[c]), split);
+        has_split_column += split;
+        for (const int cell : columns[c]) {
+            BOOST_CHECK_EQUAL(global_cell[cell] % num_pillars, columns.pillar[c]);
+        }
+    }
+    // Both ranks that own part of pillar 0 see it as a split column.
+    if (grid.comm().rank() < 2) {
+        BOOST_CHECK_GT(has_split_column, 0);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(DisjointColumn)
 {
     std::string grdecl =
@@ -154,6 +247,22 @@ BOOST_AUTO_TEST_CASE(DisjointColumn)
 
     BOOST_CHECK_EQUAL(columns.size(), correct_answer.size());
 
+    // Same columns in compressed row storage, ordered by pillar.
+    Opm::GridColumns csr;
+    Opm::extractColumns(*manager.c_grid(), csr);
+    BOOST_CHECK_EQUAL(csr.size(), columns.size());
+    VVI sorted_columns(columns);
+    std::sort(sorted_columns.begin(), sorted_columns.end(),
+              [&manager](const std::vector<int>& a, const std::vector<int>& b)
+              {
+                  const int* gc = manager.c_grid()->global_cell;
+                  return std::make_pair(gc[a[0]] % 9, gc[a[0]]) < std::make_pair(gc[b[0]] % 9, gc[b[0]]);
+              });
+    for (int c = 0; c < csr.size(); ++c) {
+        BOOST_CHECK_EQUAL_COLLECTIONS(csr[c].begin(), csr[c].end(),
+                                      sorted_columns[c].begin(), sorted_columns[c].end());
+    }
+
     for (VVI::iterator
         xb = correct_answer.begin(), xe = correct_answer.end(),
         cb = columns       .begin();
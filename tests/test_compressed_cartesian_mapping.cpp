@@ -25,6 +25,10 @@
 
 #include <opm/grid/utility/compressedToCartesian.hpp>
 #include <opm/grid/utility/cartesianToCompressed.hpp>
+#include <opm/grid/utility/CartesianToCompressedMap.hpp>
+
+#include <stdexcept>
+#include <vector>
 
 BOOST_AUTO_TEST_CASE(mapping)
 {
@@ -69,3 +73,76 @@ BOOST_AUTO_TEST_CASE(nullmapping)
         BOOST_CHECK_EQUAL(compressed_to_cartesian[i], i);
     }
 }
+
+BOOST_AUTO_TEST_CASE(inverseMap)
+{
+    const std::vector<int> global_cell{0, 1, 2, 3, 5, 6, 8, 9, 70, 3};
+    const int num_cells = global_cell.size();
+    const int cartesian_size = 100;
+
+    const std::unordered_map<int, int> expected =
+        Opm::cartesianToCompressed(num_cells, global_cell.data());
+
+    // Dense (every fraction >= 0) and sparse (no fraction >= 1.1) storage.
+    for (const double dense_fraction : { 0.0, 1.1 }) {
+        const Opm::CartesianToCompressedMap inverse(cartesian_size, num_cells,
+                                                    global_cell.data(), dense_fraction);
+        BOOST_CHECK_EQUAL(inverse.isDense(), dense_fraction == 0.0);
+        BOOST_CHECK_EQUAL(inverse.size(), expected.size());
+        BOOST_CHECK_EQUAL(inverse.cartesianSize(), cartesian_size);
+        for (int cartesian_index = -1; cartesian_index <= cartesian_size; ++cartesian_index) {
+            const auto it = expected.find(cartesian_index);
+            BOOST_CHECK_EQUAL(inverse[cartesian_index], it == expected.end() ? -1 : it->second);
+            BOOST_CHECK_EQUAL(inverse.contains(cartesian_index), it != expected.end());
+        }
+    }
+
+    const std::vector<int> leaf_indices{ 17, 4, 9 };
+    const std::vector<int> cartesian_indices{ 3, 64, 63 };
+    const Opm::CartesianToCompressedMap to_leaf(cartesian_size, 3, cartesian_indices.data(),
+                                                leaf_indices.data(), 0.5);
+    BOOST_CHECK(!to_leaf.isDense());
+    BOOST_CHECK_EQUAL(to_leaf[3], 17);
+    BOOST_CHECK_EQUAL(to_leaf[64], 4);
+    BOOST_CHECK_EQUAL(to_leaf[63], 9);
+    BOOST_CHECK_EQUAL(to_leaf[62], -1);
+
+    BOOST_CHECK_THROW(Opm::CartesianToCompressedMap(5, num_cells, global_cell.data()), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(duplicateCartesianIndices)
+{
+    // Many entries per Cartesian cell, such that threads compete for the same slots.
+    const int cartesian_size = 1000;
+    std::vector<int> cartesian_indices;
+    for (int repeat = 0; repeat < 200; ++repeat) {
+        for (int c = 0; c < cartesian_size; c += 7) {
+            cartesian_indices.push_back(c);
+        }
+    }
+    const int num_entries = cartesian_indices.size();
+    for (const double dense_fraction : { 0.0, 100.0 }) {
+        const Opm::CartesianToCompressedMap inverse(cartesian_size, num_entries, cartesian_indices.data(),
+                                                    nullptr, dense_fraction);
+        BOOST_CHECK_EQUAL(inverse.isDense(), dense_fraction == 0.0);
+        BOOST_CHECK_EQUAL(inverse.size(), static_cast<std::size_t>((cartesian_size + 6) / 7));
+        for (int c = 0; c < cartesian_size; ++c) {
+            // First occurrence wins.
+            BOOST_CHECK_EQUAL(inverse[c], c % 7 == 0 ? c / 7 : -1);
+            BOOST_CHECK_EQUAL(inverse.count(c), c % 7 == 0 ? 1u : 0u);
+        }
+        BOOST_CHECK_EQUAL(inverse.at(14), 2);
+        BOOST_CHECK_THROW(inverse.at(1), std::out_of_range);
+        BOOST_CHECK_THROW(inverse.at(cartesian_size), std::out_of_range);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(nullInverseMap)
+{
+    const int num_cells = 30;
+    const Opm::CartesianToCompressedMap inverse(num_cells, num_cells, nullptr);
+    BOOST_CHECK(inverse.isDense());
+    for (int i = 0; i < num_cells; ++i) {
+        BOOST_CHECK_EQUAL(inverse[i], i);
+    }
+}
@@ -134,6 +134,35 @@ void testGrid(Grid& grid, const std::string& name, const size_t nElem, const siz
 
 }
 
+void testEclGeometry(const Dune::CpGrid& grid)
+{
+    const auto& geometry = grid.eclGeometry();
+    if (&geometry != &grid.eclGeometry())
+        std::cout << "ECL geometry is not cached\n";
+
+    const auto& gridView = grid.leafGridView();
+    for (const auto& element : Dune::elements(gridView)) {
+        const int cell = element.index();
+        if (geometry.cell_center_depth[cell] != grid.cellCenterDepth(cell))
+            std::cout << "ECL cell center depth of element " << cell << " is wrong\n";
+
+        int pos = geometry.cell_face_start[cell];
+        for (const auto& intersection : Dune::intersections(gridView, element)) {
+            const auto center = grid.faceCenterEcl(cell, intersection.indexInInside(), intersection);
+            if ((geometry.face_center[pos++] - center).two_norm() != 0.0)
+                std::cout << "ECL face center " << intersection.indexInInside()
+                          << " of element " << cell << " is wrong\n";
+        }
+        if (pos != geometry.cell_face_start[cell + 1])
+            std::cout << "number of ECL face centers is wrong for element " << cell << "\n";
+    }
+
+    for (int face = 0; face < grid.numFaces(); ++face) {
+        if ((geometry.face_area_normal[face] - grid.faceAreaNormalEcl(face)).two_norm() != 0.0)
+            std::cout << "ECL area normal of face " << face << " is wrong\n";
+    }
+}
+
 int main(int argc, char** argv )
 {
     // initialize MPI
@@ -198,6 +227,7 @@ int main(int argc, char** argv )
 
     Dune::GridPtr< Grid > gridPtr( dgfFile );
     testGrid( *gridPtr, "CpGrid_dgf", 64, 125 );
+    testEclGeometry( *gridPtr );
 
     return 0;
 }
@@ -28,12 +28,27 @@
 #define BOOST_TEST_MODULE ElementChunksTest
 #include <boost/test/unit_test.hpp>
 
+#include <opm/grid/utility/ColouredElementChunks.hpp>
 #include <opm/grid/utility/ElementChunks.hpp>
+#include <opm/grid/utility/WeightedElementChunks.hpp>
+#include <opm/grid/utility/firstTouch.hpp>
 
 #include <opm/grid/CpGrid.hpp>
+#include <opm/grid/polyhedralgrid.hh>
 
 #include <dune/grid/common/partitionset.hh>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
 struct Fixture
 {
     Fixture()
@@ -100,3 +115,280 @@ BOOST_FIXTURE_TEST_CASE(ElementChunksTests, Fixture)
     testCase(gv, all, 11, { 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0 });
     testCase(gv, interior, 11, { 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0 });
 }
+
+template <class GridView>
+void
+testColouring(const GridView& gv, const std::size_t num_chunks)
+{
+    Opm::ColouredElementChunks chunks(gv, Dune::Partitions::all, num_chunks);
+    const auto& index_set = gv.indexSet();
+    BOOST_CHECK_GE(chunks.numColours(), 1u);
+
+    std::vector<int> visits(gv.size(0), 0);
+    for (std::size_t colour = 0; colour < chunks.numColours(); ++colour) {
+        // Cells written by each chunk must not overlap within a colour.
+        std::vector<int> writer(gv.size(0), -1);
+        int chunk_num = 0;
+        for (const auto& chunk : chunks.colour(colour)) {
+            std::set<int> written;
+            for (const auto& elem : chunk) {
+                ++visits[index_set.index(elem)];
+                written.insert(index_set.index(elem));
+                for (const auto& is : intersections(gv, elem)) {
+                    if (is.neighbor()) {
+                        written.insert(index_set.index(is.outside()));
+                    }
+                }
+            }
+            for (const int cell : written) {
+                BOOST_CHECK_EQUAL(writer[cell], -1);
+                writer[cell] = chunk_num;
+            }
+            ++chunk_num;
+        }
+    }
+    // Every element is in exactly one chunk.
+    for (const int v : visits) {
+        BOOST_CHECK_EQUAL(v, 1);
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(ColouredElementChunksCpGrid, Fixture)
+{
+    std::array<int, 3> dims = { 12, 10, 6 };
+    std::array<double, 3> cellsz = { 1.0, 1.0, 1.0 };
+    Dune::CpGrid grid;
+    grid.createCartesian(dims, cellsz);
+    const auto& gv = grid.leafGridView();
+    for (const std::size_t num_chunks : { 1, 2, 7, 16, 64, 1000 }) {
+        testColouring(gv, num_chunks);
+    }
+
+    // Chunks of whole layers only touch the layers above and below.
+    Opm::ColouredElementChunks layers(gv, Dune::Partitions::all, 6);
+    BOOST_CHECK_EQUAL(layers.numColours(), 3u);
+}
+
+BOOST_FIXTURE_TEST_CASE(ColouredElementChunksPolyhedralGrid, Fixture)
+{
+    Dune::PolyhedralGrid<3, 3> grid({ 9, 8, 5 }, { 1.0, 1.0, 1.0 });
+    const auto& gv = grid.leafGridView();
+    for (const std::size_t num_chunks : { 1, 3, 10, 40 }) {
+        testColouring(gv, num_chunks);
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(WeightedElementChunksTests, Fixture)
+{
+    std::array<int, 3> dims = { 8, 1, 1 };
+    std::array<double, 3> cellsz = { 1.0, 1.0, 1.0 };
+    Dune::CpGrid grid;
+    grid.createCartesian(dims, cellsz);
+    const auto& gv = grid.leafGridView();
+    using namespace Dune::Partitions;
+    BOOST_CHECK_THROW(Opm::WeightedElementChunks(gv, all, 0), std::logic_error);
+
+    // Uniform costs.
+    {
+        Opm::WeightedElementChunks chunks(gv, all, 3);
+        const std::vector<std::size_t> expected = { 3, 2, 3 };
+        BOOST_CHECK(chunks.chunkSizes() == expected);
+        BOOST_CHECK(countChunks(chunks) == std::vector<int>({ 3, 2, 3 }));
+    }
+
+    // More chunks than elements.
+    {
+        Opm::WeightedElementChunks chunks(gv, all, 11);
+        BOOST_CHECK(countChunks(chunks) == std::vector<int>({ 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0 }));
+    }
+
+    // Given element costs.
+    {
+        const std::vector<double> weights = { 3.0, 3.0, 3.0, 3.0, 1.0, 1.0, 1.0, 1.0 };
+        Opm::WeightedElementChunks chunks(gv, all, 2, weights);
+        BOOST_CHECK(countChunks(chunks) == std::vector<int>({ 3, 5 }));
+    }
+
+    // Learned costs, boundaries stay put once balanced.
+    {
+        Opm::WeightedElementChunks chunks(gv, all, 2);
+        BOOST_CHECK(!chunks.rebalance());
+        BOOST_CHECK(!chunks.rebalance({ 1.0, 1.05 }));
+        BOOST_CHECK(chunks.rebalance({ 12.0, 4.0 }));
+        BOOST_CHECK(countChunks(chunks) == std::vector<int>({ 3, 5 }));
+        BOOST_CHECK(!chunks.rebalance({ 9.0, 7.0 }, 0.2));
+        BOOST_CHECK_THROW(chunks.rebalance(std::vector<double>{ 1.0 }), std::invalid_argument);
+    }
+
+    // Every element is visited once by run().
+    {
+        Opm::WeightedElementChunks chunks(gv, all, 5);
+        std::vector<int> visits(gv.size(0), 0);
+        chunks.run([&](const auto& chunk) {
+            for (const auto& elem : chunk) {
+                ++visits[gv.indexSet().index(elem)];
+            }
+        });
+        BOOST_CHECK(visits == std::vector<int>(gv.size(0), 1));
+        BOOST_CHECK_EQUAL(chunks.chunkTimes().size(), 5u);
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(FirstTouchPreservesGrid, Fixture)
+{
+    std::array<int, 3> dims = { 5, 4, 3 };
+    std::array<double, 3> cellsz = { 1.0, 2.0, 3.0 };
+    Dune::CpGrid grid;
+    grid.createCartesian(dims, cellsz);
+    const auto& gv = grid.leafGridView();
+
+    const auto snapshot = [&]() {
+        std::vector<double> values;
+        for (const auto& elem : elements(gv)) {
+            const auto& geom = elem.geometry();
+            values.push_back(geom.volume());
+            for (int c = 0; c < geom.corners(); ++c) {
+                for (const double x : geom.corner(c)) {
+                    values.push_back(x);
+                }
+            }
+            for (const auto& is : intersections(gv, elem)) {
+                values.push_back(is.neighbor() ? gv.indexSet().index(is.outside()) : -1);
+                values.push_back(is.geometry().volume());
+                for (const double x : is.centerUnitOuterNormal()) {
+                    values.push_back(x);
+                }
+            }
+        }
+        for (const int g : grid.globalCell()) {
+            values.push_back(g);
+        }
+        for (int f = 0; f < grid.numFaces(); ++f) {
+            values.push_back(grid.faceCell(f, 0));
+            values.push_back(grid.faceCell(f, 1));
+            for (int v = 0; v < grid.numFaceVertices(f); ++v) {
+                values.push_back(grid.faceVertex(f, v));
+            }
+        }
+        return values;
+    };
+
+    const auto before = snapshot();
+    grid.firstTouch(3);
+    const auto after = snapshot();
+    BOOST_CHECK(before == after);
+}
+
+BOOST_AUTO_TEST_CASE(FirstTouchPreservesVectors)
+{
+    const auto blocks = Opm::chunkBoundaries(1000, 4);
+
+    std::vector<int, Opm::FirstTouchAllocator<int>> ints(1000);
+    for (std::size_t i = 0; i < ints.size(); ++i) {
+        ints[i] = 3 * i + 1;
+    }
+    const auto int_copy = ints;
+    Opm::firstTouch(ints, blocks);
+    BOOST_CHECK(ints == int_copy);
+
+    // Elements that are not trivially copyable.
+    std::vector<std::string> strings(1000);
+    for (std::size_t i = 0; i < strings.size(); ++i) {
+        strings[i] = std::string(i % 40, 'a' + i % 26);
+    }
+    const auto string_copy = strings;
+    Opm::firstTouch(strings, blocks);
+    BOOST_CHECK(strings == string_copy);
+
+    // Blocks shorter than the vector.
+    Opm::firstTouch(strings, Opm::chunkBoundaries(600, 3));
+    BOOST_CHECK(strings == string_copy);
+
+    // Copies that may throw are made after a normal resize.
+    std::vector<std::string, Opm::FirstTouchAllocator<std::string>> placed(string_copy.begin(), string_copy.end());
+    Opm::firstTouch(placed, blocks);
+    BOOST_CHECK(std::equal(placed.begin(), placed.end(), string_copy.begin(), string_copy.end()));
+}
+
+namespace
+{
+
+// Element recording the OpenMP thread that constructed it.
+struct Tagged
+{
+    int value = -1;
+    int writer = -1;
+};
+
+// Counts argument-less constructions and tags copies with the thread.
+template <class T>
+struct TaggingAllocator : std::allocator<T>
+{
+    template <class U>
+    struct rebind
+    {
+        using other = TaggingAllocator<U>;
+    };
+
+    TaggingAllocator() = default;
+
+    template <class U>
+    TaggingAllocator(const TaggingAllocator<U>&)
+    {}
+
+    static inline std::atomic<int> default_constructions{0};
+
+    template <class U>
+    void construct(U* ptr)
+    {
+        ::new (static_cast<void*>(ptr)) U();
+        ++default_constructions;
+    }
+
+    template <class U>
+    void construct(U* ptr, const U& other)
+    {
+        ::new (static_cast<void*>(ptr)) U(other);
+#ifdef _OPENMP
+        ptr->writer = omp_get_thread_num();
+#else
+        ptr->writer = 0;
+#endif
+    }
+};
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(FirstTouchWritesFromTheOwningThread)
+{
+    using Alloc = Opm::FirstTouchAllocator<Tagged, TaggingAllocator<Tagged>>;
+    std::vector<Tagged, Alloc> tagged(1000);
+    for (std::size_t i = 0; i < tagged.size(); ++i) {
+        tagged[i].value = i;
+    }
+    BOOST_CHECK_EQUAL(TaggingAllocator<Tagged>::default_constructions.load(), 1000);
+
+    const auto blocks = Opm::chunkBoundaries(tagged.size(), 4);
+    TaggingAllocator<Tagged>::default_constructions = 0;
+    Opm::firstTouch(tagged, blocks);
+
+    // The new storage was not written by the resize, every element was
+    // first written by the copy from the thread owning its block.
+    BOOST_CHECK_EQUAL(TaggingAllocator<Tagged>::default_constructions.load(), 0);
+    BOOST_REQUIRE_EQUAL(tagged.size(), 1000u);
+    for (int c = 0; c < 4; ++c) {
+        for (std::size_t i = blocks[c]; i < blocks[c + 1]; ++i) {
+            BOOST_CHECK_EQUAL(tagged[i].value, int(i));
+#ifdef _OPENMP
+            BOOST_CHECK_EQUAL(tagged[i].writer, c);
+#else
+            BOOST_CHECK_EQUAL(tagged[i].writer, 0);
+#endif
+        }
+    }
+
+    // Ordinary resizes still construct the new elements.
+    tagged.resize(1010);
+    BOOST_CHECK_EQUAL(TaggingAllocator<Tagged>::default_constructions.load(), 10);
+    BOOST_CHECK_EQUAL(tagged.back().value, -1);
+}
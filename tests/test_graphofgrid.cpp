@@ -659,6 +659,11 @@ namespace {
                    Well::ProducerCMode(),Connection::Order(),UnitSystem(),
                    0.,0.,false,false,0,Well::GasInflowEquation());
     };
+
+    std::vector<int> toVector(const Dune::cpgrid::WellConnections::Cells& cells)
+    {
+        return std::vector<int>(cells.begin(), cells.end());
+    }
 } // end anonymous namespace
 
 #if HAVE_MPI
@@ -698,11 +703,11 @@ BOOST_AUTO_TEST_CASE(addWellConnections)
 
     Dune::cpgrid::WellConnections wellConnections(wells,std::unordered_map<std::string, std::set<int>>(),gog.getGrid());
     BOOST_REQUIRE(wellConnections.size()==3);
-    BOOST_REQUIRE(wellConnections[0]==(std::set<int>{0,2,6}));
+    BOOST_REQUIRE(toVector(wellConnections[0])==(std::vector<int>{0,2,6}));
     BOOST_REQUIRE(wellConnections[1].size()==2);
-    BOOST_REQUIRE(wellConnections[1]==(std::set<int>{3,4}));
+    BOOST_REQUIRE(toVector(wellConnections[1])==(std::vector<int>{3,4}));
     BOOST_REQUIRE(wellConnections[2].size()==2);
-    BOOST_REQUIRE(wellConnections[2]==(std::set<int>{4,5}));
+    BOOST_REQUIRE(toVector(wellConnections[2])==(std::vector<int>{4,5}));
 
     Opm::addWellConnections(gog,wellConnections,true);
     BOOST_REQUIRE(gog.size()==4);
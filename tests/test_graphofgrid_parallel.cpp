@@ -34,11 +34,19 @@
 
 #include <opm/grid/GraphOfGrid.hpp>
 #include <opm/grid/GraphOfGridWrappers.hpp>
+#include <opm/grid/common/WellConnections.hpp>
 
 // #include <opm/grid/utility/OpmWellType.hpp>
 #include <opm/input/eclipse/Schedule/Well/Well.hpp>
 
 #include <algorithm>
+#include <array>
+#include <numeric>
+#include <set>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
 
 #if HAVE_MPI
 BOOST_AUTO_TEST_CASE(ExtendRootExportList)
@@ -365,6 +373,93 @@ BOOST_AUTO_TEST_CASE(SequentialZoltanSupport)
         impCells.swap(importedCells);
     BOOST_REQUIRE(importedCells == importSol);
 }
+// Wells that share cells, directly or via other wells, must end up on
+// one rank: the rank with most of their cells, the lowest one on ties.
+BOOST_AUTO_TEST_CASE(PostProcessPartitioningForWells)
+{
+    const auto& cc = Dune::MPIHelper::getCommunication();
+    if (cc.size() < 3)
+        return;
+    const int root = 0;
+
+    // A stays on rank 0. B and C share cell 5 and have two cells each on
+    // ranks 1 and 2, so they go to rank 1. D and E share no cell but are
+    // joined by F; alone D would stay on rank 0, together they have most
+    // cells on rank 2. G has a single cell and H none.
+    std::vector<Dune::cpgrid::OpmWellType> wells;
+    const std::vector<std::string> names { "A", "B", "C", "D", "E", "F", "G", "H" };
+    for (const auto& name : names) {
+        wells.push_back(createWell(name));
+    }
+    const std::unordered_map<std::string, std::set<int>> wellCells {
+        { "A", { 0, 1 } },
+        { "B", { 2, 3, 5 } },
+        { "C", { 5, 6 } },
+        { "D", { 8, 9 } },
+        { "E", { 10, 11 } },
+        { "F", { 9, 10 } },
+        { "G", { 4 } },
+    };
+    const int numCells = 12;
+    std::vector<int> identity(numCells);
+    std::iota(identity.begin(), identity.end(), 0);
+    const Dune::cpgrid::WellConnections connections(wells, wellCells,
+                                                    std::array<int, 3> { numCells, 1, 1 },
+                                                    identity);
+
+    // Only the root has cells. Every rank imports its cells from the root.
+    const std::vector<int> initialParts { 0, 0, 1, 1, 1, 2, 2, 2, 0, 1, 2, 2 };
+    std::vector<int> parts;
+    std::vector<std::tuple<int, int, char>> exportList;
+    std::vector<std::tuple<int, int, char, int>> importList;
+    const char owner = static_cast<char>(Dune::cpgrid::CpGridData::AttributeSet::owner);
+    if (cc.rank() == root) {
+        parts = initialParts;
+        for (int cell = 0; cell < numCells; ++cell) {
+            exportList.emplace_back(cell, parts[cell], owner);
+        }
+    }
+    for (int cell = 0; cell < numCells; ++cell) {
+        if (initialParts[cell] == cc.rank()) {
+            importList.emplace_back(cell, root, owner, -1);
+        }
+    }
+
+    const auto wellsOnProc =
+        Dune::cpgrid::postProcessPartitioningForWells(parts, [](int cell) { return cell; },
+                                                      wells, connections,
+                                                      exportList, importList, cc);
+
+    const std::vector<int> expectedParts { 0, 0, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2 };
+    if (cc.rank() == root) {
+        BOOST_CHECK(parts == expectedParts);
+        for (int cell = 0; cell < numCells; ++cell) {
+            BOOST_CHECK(std::get<0>(exportList[cell]) == cell);
+            BOOST_CHECK(std::get<1>(exportList[cell]) == expectedParts[cell]);
+        }
+        BOOST_REQUIRE(wellsOnProc.size() == static_cast<std::size_t>(cc.size()));
+        BOOST_CHECK(wellsOnProc[0] == std::vector<int>({ 0 }));
+        BOOST_CHECK(wellsOnProc[1] == std::vector<int>({ 1, 2, 6 }));
+        BOOST_CHECK(wellsOnProc[2] == std::vector<int>({ 3, 4, 5 }));
+        for (int rank = 3; rank < cc.size(); ++rank) {
+            BOOST_CHECK(wellsOnProc[rank].empty());
+        }
+    }
+
+    // The moved cells have been added to and removed from the import
+    // lists of their new and old owners.
+    std::vector<int> imported, expectedImported;
+    for (const auto& entry : importList) {
+        BOOST_CHECK(std::get<1>(entry) == root);
+        imported.push_back(std::get<0>(entry));
+    }
+    for (int cell = 0; cell < numCells; ++cell) {
+        if (expectedParts[cell] == cc.rank()) {
+            expectedImported.push_back(cell);
+        }
+    }
+    BOOST_CHECK(imported == expectedImported);
+}
 #endif // HAVE_MPI
 
 bool init_unit_test_func()
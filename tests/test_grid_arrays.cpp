@@ -0,0 +1,143 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE GridArraysTest
+#include <boost/test/unit_test.hpp>
+#include <boost/version.hpp>
+#if BOOST_VERSION / 100000 == 1 && BOOST_VERSION / 100 % 1000 < 71
+#include <boost/test/floating_point_comparison.hpp>
+#else
+#include <boost/test/tools/floating_point_comparison.hpp>
+#endif
+
+#include <opm/grid/CpGrid.hpp>
+#include <opm/grid/GridArrays.hpp>
+#include <opm/grid/UnstructuredGrid.h>
+#include <opm/grid/cart_grid.h>
+#include <opm/grid/cpgrid/GridHelpers.hpp>
+
+#include <dune/common/parallel/mpihelper.hh>
+
+#include <array>
+#include <vector>
+
+struct MPIFixture
+{
+    MPIFixture()
+    {
+        int m_argc = boost::unit_test::framework::master_test_suite().argc;
+        char** m_argv = boost::unit_test::framework::master_test_suite().argv;
+        Dune::MPIHelper::instance(m_argc, m_argv);
+    }
+};
+
+BOOST_GLOBAL_FIXTURE(MPIFixture);
+
+namespace
+{
+
+    /// Check that forEachCellFace visits the half-faces in order.
+    void checkCellFaceVisits(const Opm::UgGridHelpers::GridArrays& arrays)
+    {
+        int expected = 0;
+        arrays.forEachCellFace([&](int cell, int face, int half_face) {
+            BOOST_CHECK_EQUAL(half_face, expected++);
+            BOOST_CHECK(half_face >= static_cast<int>(arrays.cellFacePos()[cell]));
+            BOOST_CHECK(half_face < static_cast<int>(arrays.cellFacePos()[cell + 1]));
+            BOOST_CHECK_EQUAL(face, arrays.cellFacesData()[half_face]);
+        });
+        BOOST_CHECK_EQUAL(expected, static_cast<int>(arrays.cellFacePos()[arrays.numCells()]));
+    }
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(unstructuredGridIsNotCopied)
+{
+    UnstructuredGrid* g = create_grid_hexa3d(4, 3, 2, 1.0, 1.0, 1.0);
+    const Opm::UgGridHelpers::GridArrays arrays(*g);
+
+    BOOST_CHECK_EQUAL(arrays.numCells(), g->number_of_cells);
+    BOOST_CHECK_EQUAL(arrays.numFaces(), g->number_of_faces);
+    BOOST_CHECK(arrays.cellFacesData() == g->cell_faces);
+    BOOST_CHECK(arrays.faceCells() == g->face_cells);
+    BOOST_CHECK(arrays.faceNormals().data() == g->face_normals);
+    BOOST_CHECK(arrays.cellCentroid(5) == g->cell_centroids + 15);
+    BOOST_CHECK_EQUAL(arrays.cellFaceArity(), 6);
+    BOOST_CHECK_EQUAL(arrays.faceVertexArity(), 4);
+    checkCellFaceVisits(arrays);
+    destroy_grid(g);
+
+    UnstructuredGrid* g2 = create_grid_cart2d(3, 2, 1.0, 1.0);
+    const Opm::UgGridHelpers::GridArrays arrays2(*g2);
+    BOOST_CHECK_EQUAL(arrays2.cellFaceArity(), 4);
+    BOOST_CHECK_EQUAL(arrays2.faceVertexArity(), 2);
+    checkCellFaceVisits(arrays2);
+    destroy_grid(g2);
+}
+
+BOOST_AUTO_TEST_CASE(cpGridMatchesHelpers)
+{
+    Dune::CpGrid grid;
+    grid.createCartesian(std::array<int, 3>{ 4, 3, 2 }, std::array<double, 3>{ 1.0, 2.0, 0.5 });
+    const Opm::UgGridHelpers::GridArrays arrays(grid);
+
+    namespace H = Opm::UgGridHelpers;
+    BOOST_REQUIRE_EQUAL(arrays.numCells(), H::numCells(grid));
+    BOOST_REQUIRE_EQUAL(arrays.numFaces(), H::numFaces(grid));
+    BOOST_CHECK_EQUAL(arrays.cellFaceArity(), 6);
+    BOOST_CHECK_EQUAL(arrays.faceVertexArity(), 4);
+
+    const auto c2f = H::cell2Faces(grid);
+    for (int c = 0; c < arrays.numCells(); ++c) {
+        const auto row = arrays.cellFaces()[c];
+        std::vector<int> expected(c2f[c].begin(), c2f[c].end());
+        BOOST_CHECK_EQUAL_COLLECTIONS(row.begin(), row.end(), expected.begin(), expected.end());
+        for (int d = 0; d < 3; ++d) {
+            BOOST_CHECK_CLOSE(arrays.cellCentroid(c)[d], H::cellCentroid(grid, c)[d], 1.0e-12);
+        }
+    }
+
+    const auto face_cells = H::faceCells(grid);
+    for (int f = 0; f < arrays.numFaces(); ++f) {
+        BOOST_CHECK_EQUAL(arrays.faceCell(f, 0), face_cells(f, 0));
+        BOOST_CHECK_EQUAL(arrays.faceCell(f, 1), face_cells(f, 1));
+        BOOST_CHECK_CLOSE(arrays.faceAreas()[f], H::faceArea(grid, f), 1.0e-12);
+        for (int d = 0; d < 3; ++d) {
+            BOOST_CHECK_CLOSE(arrays.faceCentroid(f)[d], H::faceCentroid(grid, f)[d], 1.0e-12);
+            BOOST_CHECK_CLOSE(arrays.faceNormal(f)[d],
+                              H::faceArea(grid, f) * H::faceNormal(grid, f)[d], 1.0e-12);
+        }
+    }
+    checkCellFaceVisits(arrays);
+
+    // The stored arrays are views of the grid, not copies.
+    const auto& data = *grid.currentData().back();
+    BOOST_CHECK(arrays.faceVerticesData() == data.faceVertices());
+    BOOST_CHECK(static_cast<const void*>(arrays.cellFacePos()) == data.cellFacePos());
+    BOOST_CHECK(arrays.cellCentroid(7) == &grid.cellCentroid(7)[0]);
+    BOOST_CHECK(arrays.faceCentroid(5) == &grid.faceCentroid(5)[0]);
+    BOOST_CHECK(arrays.vertexCoordinates()[3] == &grid.vertexPosition(3)[0]);
+    for (int v = 0; v < arrays.numVertices(); ++v) {
+        for (int d = 0; d < 3; ++d) {
+            BOOST_CHECK_EQUAL(arrays.vertexCoordinates()[v][d], H::vertexCoordinates(grid, v)[d]);
+        }
+    }
+}
@@ -0,0 +1,184 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE GridBinaryIOTest
+#include <boost/test/unit_test.hpp>
+
+#include <opm/grid/GridManager.hpp>
+#include <opm/grid/UnstructuredGrid.h>
+#include <opm/grid/cart_grid.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+namespace
+{
+
+    template <class T>
+    bool sameArray(const T* a, const T* b, std::size_t n)
+    {
+        if (a == nullptr || b == nullptr) {
+            return a == b;
+        }
+        return std::equal(a, a + n, b);
+    }
+
+    // The binary format stores the arrays verbatim, so grids read back
+    // must be bitwise identical to the grid written.
+    bool sameGrid(const UnstructuredGrid& a, const UnstructuredGrid& b)
+    {
+        const std::size_t nd = a.dimensions;
+        const std::size_t nc = a.number_of_cells;
+        const std::size_t nf = a.number_of_faces;
+        const std::size_t nn = a.number_of_nodes;
+        return a.dimensions == b.dimensions
+            && a.number_of_cells == b.number_of_cells
+            && a.number_of_faces == b.number_of_faces
+            && a.number_of_nodes == b.number_of_nodes
+            && std::equal(a.cartdims, a.cartdims + 3, b.cartdims)
+            && sameArray(a.node_coordinates, b.node_coordinates, nd * nn)
+            && sameArray(a.face_nodepos, b.face_nodepos, nf + 1)
+            && sameArray(a.face_nodes, b.face_nodes, a.face_nodepos[nf])
+            && sameArray(a.face_cells, b.face_cells, 2 * nf)
+            && sameArray(a.face_areas, b.face_areas, nf)
+            && sameArray(a.face_centroids, b.face_centroids, nd * nf)
+            && sameArray(a.face_normals, b.face_normals, nd * nf)
+            && sameArray(a.cell_facepos, b.cell_facepos, nc + 1)
+            && sameArray(a.cell_faces, b.cell_faces, a.cell_facepos[nc])
+            && sameArray(a.cell_facetag, b.cell_facetag, a.cell_facepos[nc])
+            && sameArray(a.global_cell, b.global_cell, nc)
+            && sameArray(a.cell_volumes, b.cell_volumes, nc)
+            && sameArray(a.cell_centroids, b.cell_centroids, nd * nc);
+    }
+
+    // Write g to fname, and check that neither reader accepts the file.
+    void checkRejected(const UnstructuredGrid& g, const std::string& fname)
+    {
+        BOOST_REQUIRE(write_grid_binary(&g, fname.c_str()));
+        BOOST_CHECK(read_grid_binary(fname.c_str()) == nullptr);
+        BOOST_CHECK(map_grid_binary(fname.c_str()) == nullptr);
+        std::remove(fname.c_str());
+    }
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE (GridBinaryIO)
+
+BOOST_AUTO_TEST_CASE (roundTrip)
+{
+    UnstructuredGrid* g = create_grid_hexa3d(4, 3, 2, 1.0, 2.0, 3.0);
+    BOOST_REQUIRE(g != nullptr);
+    g->global_cell = static_cast<int*>(std::malloc(g->number_of_cells * sizeof *g->global_cell));
+    for (int c = 0; c < g->number_of_cells; ++c) {
+        g->global_cell[c] = 2 * c;
+    }
+    const std::string fname = "test_grid_binary_io_roundtrip.grid";
+    BOOST_REQUIRE(write_grid_binary(g, fname.c_str()));
+    BOOST_CHECK(is_grid_binary_file(fname.c_str()));
+
+    UnstructuredGrid* read = read_grid_binary(fname.c_str());
+    BOOST_REQUIRE(read != nullptr);
+    BOOST_CHECK(sameGrid(*g, *read));
+    destroy_grid(read);
+
+    UnstructuredGrid* mapped = map_grid_binary(fname.c_str());
+    BOOST_REQUIRE(mapped != nullptr);
+    BOOST_CHECK(sameGrid(*g, *mapped));
+    // The mapping is private, writing must not change the file.
+    mapped->cell_volumes[0] = -1.0;
+    unmap_grid_binary(mapped);
+
+    {
+        Opm::GridManager manager(fname);
+        BOOST_CHECK(sameGrid(*g, *manager.c_grid()));
+    }
+
+    std::remove(fname.c_str());
+    destroy_grid(g);
+}
+
+BOOST_AUTO_TEST_CASE (rejectTextFile)
+{
+    const std::string fname = "test_grid_binary_io_text.grid";
+    {
+        std::ofstream os(fname);
+        os << "2 1 4 4 8 4\n0 0\n1 1\n";
+    }
+    BOOST_CHECK(!is_grid_binary_file(fname.c_str()));
+    BOOST_CHECK(read_grid_binary(fname.c_str()) == nullptr);
+    BOOST_CHECK(map_grid_binary(fname.c_str()) == nullptr);
+    std::remove(fname.c_str());
+}
+
+BOOST_AUTO_TEST_CASE (rejectCorruptTopology)
+{
+    const std::string fname = "test_grid_binary_io_corrupt.grid";
+
+    // Each case corrupts one array of a freshly built grid and writes
+    // it, the writer stores the arrays as they are.
+    auto corrupted = [&fname](auto corrupt)
+    {
+        UnstructuredGrid* g = create_grid_hexa3d(3, 2, 2, 1.0, 1.0, 1.0);
+        BOOST_REQUIRE(g != nullptr);
+        corrupt(*g);
+        checkRejected(*g, fname);
+        destroy_grid(g);
+    };
+
+    corrupted([](UnstructuredGrid& g) { g.face_nodes[1] = g.number_of_nodes; });
+    corrupted([](UnstructuredGrid& g) { g.face_nodes[0] = -1; });
+    corrupted([](UnstructuredGrid& g) { g.face_cells[3] = g.number_of_cells; });
+    corrupted([](UnstructuredGrid& g) { g.face_cells[0] = -2; });
+    corrupted([](UnstructuredGrid& g) { g.cell_faces[2] = g.number_of_faces; });
+    corrupted([](UnstructuredGrid& g) { g.face_nodepos[2] = g.face_nodepos[3] + 1; });
+    corrupted([](UnstructuredGrid& g) { g.cell_facepos[1] = g.cell_facepos[2] + 1; });
+    corrupted([](UnstructuredGrid& g) { g.cell_facepos[0] = 1; });
+}
+
+BOOST_AUTO_TEST_CASE (rejectOversizedCounts)
+{
+    UnstructuredGrid* g = create_grid_hexa3d(2, 2, 2, 1.0, 1.0, 1.0);
+    BOOST_REQUIRE(g != nullptr);
+    const std::string fname = "test_grid_binary_io_oversized.grid";
+    BOOST_REQUIRE(write_grid_binary(g, fname.c_str()));
+
+    // The cell count follows magic, endian tag, version, flags,
+    // dimensions, cartdims and a reserved word in the header.
+    const std::streamoff ncellsOffset = 8 + 4 * 4 + 3 * 4 + 4;
+    const std::uint64_t ncells = std::uint64_t(1) << 32;
+    {
+        std::fstream fs(fname, std::ios::in | std::ios::out | std::ios::binary);
+        fs.seekp(ncellsOffset);
+        fs.write(reinterpret_cast<const char*>(&ncells), sizeof ncells);
+    }
+    BOOST_CHECK(is_grid_binary_file(fname.c_str()));
+    BOOST_CHECK(read_grid_binary(fname.c_str()) == nullptr);
+    BOOST_CHECK(map_grid_binary(fname.c_str()) == nullptr);
+
+    std::remove(fname.c_str());
+    destroy_grid(g);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
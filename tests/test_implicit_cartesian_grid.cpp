@@ -0,0 +1,220 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE ImplicitCartesianGridTest
+#include <boost/test/unit_test.hpp>
+#include <boost/version.hpp>
+#if BOOST_VERSION / 100000 == 1 && BOOST_VERSION / 100 % 1000 < 71
+#include <boost/test/floating_point_comparison.hpp>
+#else
+#include <boost/test/tools/floating_point_comparison.hpp>
+#endif
+
+#include <opm/grid/ImplicitCartesianGrid.hpp>
+#include <opm/grid/ImplicitCartesianGridHelpers.hpp>
+#include <opm/grid/UnstructuredGrid.h>
+#include <opm/grid/cart_grid.h>
+
+#include <array>
+#include <iterator>
+#include <set>
+#include <stdexcept>
+
+BOOST_AUTO_TEST_CASE(matchesMaterialisedGrid)
+{
+    const std::array<int, 3> dims = { 5, 4, 3 };
+    const std::array<double, 3> cellsz = { 1.0, 2.0, 0.5 };
+    const Opm::ImplicitCartesianGrid grid(dims, cellsz);
+    UnstructuredGrid* ug = create_grid_hexa3d(dims[0], dims[1], dims[2],
+                                              cellsz[0], cellsz[1], cellsz[2]);
+
+    BOOST_REQUIRE_EQUAL(grid.numCells(), ug->number_of_cells);
+    BOOST_REQUIRE_EQUAL(grid.numFaces(), ug->number_of_faces);
+    BOOST_REQUIRE_EQUAL(grid.numVertices(), ug->number_of_nodes);
+    BOOST_REQUIRE_EQUAL(grid.numCellFaces(), static_cast<int>(ug->cell_facepos[ug->number_of_cells]));
+
+    for (int c = 0; c < grid.numCells(); ++c) {
+        for (int k = 0; k < 6; ++k) {
+            const int hf = ug->cell_facepos[c] + k;
+            BOOST_CHECK_EQUAL(grid.cellFace(c, k), ug->cell_faces[hf]);
+            BOOST_CHECK_EQUAL(grid.faceTag(c, k), ug->cell_facetag[hf]);
+        }
+        const auto centroid = grid.cellCentroid(c);
+        for (int d = 0; d < 3; ++d) {
+            BOOST_CHECK_CLOSE(centroid[d], ug->cell_centroids[3*c + d], 1.0e-12);
+        }
+        BOOST_CHECK_CLOSE(grid.cellVolume(c), ug->cell_volumes[c], 1.0e-12);
+    }
+
+    for (int f = 0; f < grid.numFaces(); ++f) {
+        BOOST_CHECK_EQUAL(grid.faceCell(f, 0), ug->face_cells[2*f + 0]);
+        BOOST_CHECK_EQUAL(grid.faceCell(f, 1), ug->face_cells[2*f + 1]);
+        for (int n = 0; n < 4; ++n) {
+            BOOST_CHECK_EQUAL(grid.faceVertex(f, n), ug->face_nodes[ug->face_nodepos[f] + n]);
+        }
+        const auto centroid = grid.faceCentroid(f);
+        const auto normal = grid.faceNormal(f);
+        for (int d = 0; d < 3; ++d) {
+            BOOST_CHECK_CLOSE(centroid[d], ug->face_centroids[3*f + d], 1.0e-12);
+            BOOST_CHECK_CLOSE(normal[d], ug->face_normals[3*f + d], 1.0e-12);
+        }
+        BOOST_CHECK_CLOSE(grid.faceArea(f), ug->face_areas[f], 1.0e-12);
+    }
+
+    for (int v = 0; v < grid.numVertices(); ++v) {
+        const auto x = grid.vertexPosition(v);
+        for (int d = 0; d < 3; ++d) {
+            BOOST_CHECK_CLOSE(x[d], ug->node_coordinates[3*v + d], 1.0e-12);
+        }
+    }
+
+    destroy_grid(ug);
+}
+
+BOOST_AUTO_TEST_CASE(cartesianIndexMapper)
+{
+    const Opm::ImplicitCartesianGrid grid({ 3, 4, 5 }, { 1.0, 1.0, 1.0 });
+    const Dune::CartesianIndexMapper<Opm::ImplicitCartesianGrid> mapper(grid);
+    BOOST_CHECK_EQUAL(mapper.cartesianSize(), 60);
+    BOOST_CHECK_EQUAL(mapper.compressedSize(), 60);
+
+    std::array<int, 3> ijk;
+    mapper.cartesianCoordinate(grid.cellIndex(2, 1, 3), ijk);
+    BOOST_CHECK_EQUAL(ijk[0], 2);
+    BOOST_CHECK_EQUAL(ijk[1], 1);
+    BOOST_CHECK_EQUAL(ijk[2], 3);
+    BOOST_CHECK_EQUAL(mapper.cartesianIndex(17), 17);
+}
+
+BOOST_AUTO_TEST_CASE(rejectDimensionsBeyondIntIndices)
+{
+    // 6 * 1000 * 1000 * 357 cell faces still fit an int.
+    const Opm::ImplicitCartesianGrid largest({ 1000, 1000, 357 }, { 1.0, 1.0, 1.0 });
+    BOOST_CHECK_EQUAL(largest.numCells(), 357000000);
+    BOOST_CHECK_EQUAL(largest.numCellFaces(), 2142000000);
+    BOOST_CHECK_EQUAL(largest.numFaces(), 1001 * 1000 * 357 + 1000 * 1001 * 357 + 1000 * 1000 * 358);
+    BOOST_CHECK_EQUAL(largest.cellFace(largest.numCells() - 1, 5), largest.numFaces() - 1);
+
+    BOOST_CHECK_THROW(Opm::ImplicitCartesianGrid({ 1000, 1000, 358 }, { 1.0, 1.0, 1.0 }),
+                      std::invalid_argument);
+    BOOST_CHECK_THROW(Opm::ImplicitCartesianGrid({ 1 << 30, 1 << 30, 1 << 30 }, { 1.0, 1.0, 1.0 }),
+                      std::invalid_argument);
+    BOOST_CHECK_THROW(Opm::ImplicitCartesianGrid({ 0, 10, 10 }, { 1.0, 1.0, 1.0 }),
+                      std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(blockPartition)
+{
+    const Opm::ImplicitCartesianGrid grid({ 40, 10, 10 }, { 1.0, 1.0, 1.0 });
+    const auto blocks = grid.partitionBlocks(4);
+    // Cutting across the long x direction gives the smallest interfaces.
+    BOOST_CHECK_EQUAL(blocks[0], 4);
+    BOOST_CHECK_EQUAL(blocks[1], 1);
+    BOOST_CHECK_EQUAL(blocks[2], 1);
+
+    std::array<int, 4> count = { 0, 0, 0, 0 };
+    for (int c = 0; c < grid.numCells(); ++c) {
+        ++count[grid.cellPart(c, blocks)];
+    }
+    for (int p = 0; p < 4; ++p) {
+        BOOST_CHECK_EQUAL(count[p], 1000);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(blockPartitionFactorsAcrossDirections)
+{
+    // Seven parts cannot be cut along the short directions.
+    const Opm::ImplicitCartesianGrid thin({ 3, 7, 2 }, { 1.0, 1.0, 1.0 });
+    const auto blocks = thin.partitionBlocks(7);
+    BOOST_CHECK_EQUAL(blocks[0], 1);
+    BOOST_CHECK_EQUAL(blocks[1], 7);
+    BOOST_CHECK_EQUAL(blocks[2], 1);
+
+    // More parts than cells along any direction are spread over several.
+    const Opm::ImplicitCartesianGrid cube({ 2, 2, 2 }, { 1.0, 1.0, 1.0 });
+    const auto all = cube.partitionBlocks(8);
+    BOOST_CHECK_EQUAL(all[0] * all[1] * all[2], 8);
+    std::set<int> parts;
+    for (int c = 0; c < cube.numCells(); ++c) {
+        parts.insert(cube.cellPart(c, all));
+    }
+    BOOST_CHECK_EQUAL(parts.size(), 8u);
+
+    BOOST_CHECK_THROW(cube.partitionBlocks(3), std::invalid_argument);
+    BOOST_CHECK_THROW(cube.partitionBlocks(9), std::invalid_argument);
+    BOOST_CHECK_THROW(cube.partitionBlocks(0), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(gridHelpersMatchMaterialisedGrid)
+{
+    const std::array<int, 3> dims = { 4, 3, 2 };
+    const std::array<double, 3> cellsz = { 1.0, 2.0, 0.5 };
+    const Opm::ImplicitCartesianGrid grid(dims, cellsz);
+    UnstructuredGrid* ug = create_grid_hexa3d(dims[0], dims[1], dims[2],
+                                              cellsz[0], cellsz[1], cellsz[2]);
+    const UnstructuredGrid& cug = *ug;
+
+    using namespace Opm::UgGridHelpers;
+    BOOST_REQUIRE_EQUAL(numCells(grid), numCells(cug));
+    BOOST_REQUIRE_EQUAL(numFaces(grid), numFaces(cug));
+    BOOST_CHECK_EQUAL(dimensions(grid), dimensions(cug));
+    BOOST_CHECK_EQUAL(numCellFaces(grid), numCellFaces(cug));
+    BOOST_CHECK(globalCell(grid) == nullptr);
+    for (int d = 0; d < 3; ++d) {
+        BOOST_CHECK_EQUAL(cartDims(grid)[d], dims[d]);
+    }
+
+    const auto c2f = cell2Faces(grid);
+    const auto c2f_ug = cell2Faces(cug);
+    for (int c = 0; c < numCells(grid); ++c) {
+        const auto faces = c2f[c];
+        const auto faces_ug = c2f_ug[c];
+        BOOST_REQUIRE_EQUAL(std::distance(faces.begin(), faces.end()),
+                            std::distance(faces_ug.begin(), faces_ug.end()));
+        auto f_ug = faces_ug.begin();
+        for (auto f = faces.begin(); f != faces.end(); ++f, ++f_ug) {
+            BOOST_CHECK_EQUAL(*f, *f_ug);
+            BOOST_CHECK_EQUAL(faceTag(grid, f), ug->cell_facetag[ug->cell_facepos[c] + f.localIndex()]);
+        }
+        BOOST_CHECK_CLOSE(cellVolume(grid, c), cellVolume(cug, c), 1.0e-12);
+        BOOST_CHECK_CLOSE(cellCentroidCoordinate(grid, c, 2), cellCentroid(cug, c)[2], 1.0e-12);
+    }
+
+    const auto face_cells = faceCells(grid);
+    const auto face_cells_ug = faceCells(cug);
+    const auto f2v = face2Vertices(grid);
+    const auto f2v_ug = face2Vertices(cug);
+    for (int f = 0; f < numFaces(grid); ++f) {
+        BOOST_CHECK_EQUAL(face_cells(f, 0), face_cells_ug(f, 0));
+        BOOST_CHECK_EQUAL(face_cells(f, 1), face_cells_ug(f, 1));
+        int n = 0;
+        for (const int v : f2v[f]) {
+            BOOST_CHECK_EQUAL(v, f2v_ug[f][n++]);
+        }
+        BOOST_CHECK_EQUAL(n, 4);
+        for (int d = 0; d < 3; ++d) {
+            BOOST_CHECK_CLOSE(faceNormal(grid, f)[d], faceNormal(cug, f)[d], 1.0e-12);
+            BOOST_CHECK_CLOSE(faceCentroid(grid, f)[d], faceCentroid(cug, f)[d], 1.0e-12);
+        }
+        BOOST_CHECK_CLOSE(faceArea(grid, f), faceArea(cug, f), 1.0e-12);
+    }
+    destroy_grid(ug);
+}
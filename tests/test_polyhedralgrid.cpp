@@ -20,6 +20,7 @@
 
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 
+#include <cmath>
 #include <iostream>
 
 // two hexahedrons using polygon/polyhedron format
@@ -323,6 +324,42 @@ int main(int argc, char** argv )
             std::cout << std::endl;
         }
 
+        {
+            std::cout <<"Check 3d grid wrapping external arrays" << std::endl << std::endl;
+            UnstructuredGrid* ug = create_grid_hexa3d( 3, 2, 2, 1.0, 2.0, 0.5 );
+            Grid::ExternalGridArrays arrays;
+            arrays.numCells = ug->number_of_cells;
+            arrays.numFaces = ug->number_of_faces;
+            arrays.numNodes = ug->number_of_nodes;
+            arrays.faceNodes = ug->face_nodes;
+            arrays.faceNodePos = ug->face_nodepos;
+            arrays.faceCells = ug->face_cells;
+            arrays.cellFaces = ug->cell_faces;
+            arrays.cellFacePos = ug->cell_facepos;
+            arrays.cellFaceTag = ug->cell_facetag;
+            arrays.nodeCoordinates = ug->node_coordinates;
+            {
+                // geometry is computed by the grid
+                Grid grid( arrays );
+                gridcheck( grid );
+                const UnstructuredGrid& wrapped = grid;
+                if( wrapped.face_nodes != ug->face_nodes || wrapped.cell_volumes == ug->cell_volumes )
+                {
+                    std::cerr << "Error: topology was copied or geometry was not computed" << std::endl;
+                    return 1;
+                }
+                for( int c = 0; c < ug->number_of_cells; ++c )
+                {
+                    if( std::abs( wrapped.cell_volumes[ c ] - ug->cell_volumes[ c ] ) > 1e-12 )
+                    {
+                        std::cerr << "Error: wrong volume for cell " << c << std::endl;
+                        return 1;
+                    }
+                }
+            }
+            destroy_grid( ug );
+            std::cout << std::endl;
+        }
     }
 
     {
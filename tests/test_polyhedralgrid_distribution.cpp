@@ -0,0 +1,283 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <config.h>
+
+#define BOOST_TEST_MODULE PolyhedralGridDistributionTests
+#include <boost/test/unit_test.hpp>
+
+#include <opm/grid/utility/platform_dependent/disable_warnings.h>
+#include <dune/common/parallel/mpihelper.hh>
+#include <dune/grid/common/datahandleif.hh>
+#include <opm/grid/polyhedralgrid.hh>
+#include <opm/grid/utility/platform_dependent/reenable_warnings.h>
+
+#include <opm/grid/common/UnstructuredGridPartitioning.hpp>
+#include <opm/grid/UnstructuredGrid.h>
+#include <opm/grid/cart_grid.h>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+struct MPIFixture
+{
+    MPIFixture()
+    {
+        int m_argc = boost::unit_test::framework::master_test_suite().argc;
+        char** m_argv = boost::unit_test::framework::master_test_suite().argv;
+        Dune::MPIHelper::instance(m_argc, m_argv);
+    }
+};
+
+BOOST_GLOBAL_FIXTURE(MPIFixture);
+
+namespace
+{
+
+using Grid = Dune::PolyhedralGrid<3, 3>;
+
+/// Sends the global id of each entity of codimension codim and checks
+/// that the received value matches the id on the receiving side.
+template<int codim>
+class IdCheckHandle
+    : public Dune::CommDataHandleIF<IdCheckHandle<codim>, std::size_t>
+{
+public:
+    explicit IdCheckHandle(const Grid& grid)
+        : grid_(grid), received_(grid.size(codim), 0)
+    {}
+
+    bool contains(int, int cd) const { return cd == codim; }
+    bool fixedSize(int, int) const { return true; }
+
+    template<class E>
+    std::size_t size(const E&) const { return 1; }
+
+    template<class B, class E>
+    void gather(B& buffer, const E& e) const
+    {
+        buffer.write(grid_.globalIdSet().id(e));
+    }
+
+    template<class B, class E>
+    void scatter(B& buffer, const E& e, std::size_t n)
+    {
+        BOOST_REQUIRE_EQUAL(n, 1);
+        std::size_t id;
+        buffer.read(id);
+        BOOST_CHECK_EQUAL(id, grid_.globalIdSet().id(e));
+        ++received_[grid_.leafIndexSet().index(e)];
+    }
+
+    const std::vector<int>& received() const { return received_; }
+
+private:
+    const Grid& grid_;
+    std::vector<int> received_;
+};
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(extractLocalGrids)
+{
+    std::unique_ptr<UnstructuredGrid, void(*)(UnstructuredGrid*)>
+        global(create_grid_hexa3d(4, 3, 2, 1.0, 1.0, 1.0), &destroy_grid);
+    const int num_parts = 3;
+    const auto part = Opm::partitionUnstructuredGrid(*global, num_parts);
+    BOOST_REQUIRE_EQUAL(part.size(), 24);
+
+    std::vector<Opm::LocalUnstructuredGrid> local;
+    int num_interior = 0;
+    for (int rank = 0; rank < num_parts; ++rank) {
+        local.push_back(Opm::extractLocalUnstructuredGrid(*global, part, rank, 1));
+        BOOST_CHECK(local.back().global_sizes == (std::array<int, 3>{ global->number_of_cells,
+                                                                     global->number_of_faces,
+                                                                     global->number_of_nodes }));
+        for (auto type : local.back().cell_partition_type) {
+            BOOST_CHECK(type == Dune::InteriorEntity || type == Dune::OverlapEntity);
+            num_interior += (type == Dune::InteriorEntity);
+        }
+        // The outer faces of the overlap layer are front faces, unless they
+        // are on the domain boundary.
+        const auto& lg = *local.back().grid;
+        for (int f = 0; f < lg.number_of_faces; ++f) {
+            const bool inner = lg.face_cells[2*f] >= 0 && lg.face_cells[2*f + 1] >= 0;
+            const int gf = local.back().global_face[f];
+            const bool global_inner = global->face_cells[2*gf] >= 0 && global->face_cells[2*gf + 1] >= 0;
+            const auto type = local.back().face_partition_type[f];
+            if (global_inner && !inner) {
+                BOOST_CHECK(type == Dune::FrontEntity || type == Dune::BorderEntity);
+                if (type == Dune::BorderEntity) {
+                    // only without overlap towards that side
+                    BOOST_CHECK(part[global->face_cells[2*gf]] == rank || part[global->face_cells[2*gf + 1]] == rank);
+                }
+            } else if (type == Dune::FrontEntity) {
+                BOOST_ERROR("front face " << gf << " has both neighbours on rank " << rank);
+            }
+        }
+    }
+    BOOST_CHECK_EQUAL(num_interior, global->number_of_cells);
+
+    // Both sides of each shared list must agree on order and attributes.
+    for (int rank = 0; rank < num_parts; ++rank) {
+        for (const auto& [other, cells] : local[rank].shared_cells) {
+            const auto& remote = local[other].shared_cells.at(rank);
+            BOOST_REQUIRE_EQUAL(cells.size(), remote.size());
+            for (std::size_t i = 0; i < cells.size(); ++i) {
+                BOOST_CHECK_EQUAL(local[rank].global_cell[cells[i].local],
+                                  local[other].global_cell[remote[i].local]);
+                BOOST_CHECK_EQUAL(cells[i].other, remote[i].mine);
+            }
+        }
+        for (const auto& [other, nodes] : local[rank].shared_nodes) {
+            const auto& remote = local[other].shared_nodes.at(rank);
+            BOOST_REQUIRE_EQUAL(nodes.size(), remote.size());
+            for (std::size_t i = 0; i < nodes.size(); ++i) {
+                BOOST_CHECK_EQUAL(local[rank].global_node[nodes[i].local],
+                                  local[other].global_node[remote[i].local]);
+                BOOST_CHECK_EQUAL(nodes[i].other, remote[i].mine);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(partitionMethods)
+{
+    std::unique_ptr<UnstructuredGrid, void(*)(UnstructuredGrid*)>
+        global(create_grid_hexa3d(6, 4, 2, 1.0, 1.0, 1.0), &destroy_grid);
+    const int num_parts = 4;
+
+    const auto simple = Opm::partitionUnstructuredGrid(*global, num_parts,
+                                                       Dune::PartitionMethod::simple, 1.1);
+    BOOST_REQUIRE_EQUAL(simple.size(), 48);
+    for (int c = 0; c < 48; ++c) {
+        BOOST_CHECK_EQUAL(simple[c], c / 12);
+    }
+
+    std::vector<Dune::PartitionMethod> methods;
+#if HAVE_MPI && HAVE_ZOLTAN
+    methods.push_back(Dune::PartitionMethod::zoltan);
+#endif
+#if defined(HAVE_METIS) && HAVE_MPI
+    methods.push_back(Dune::PartitionMethod::metis);
+#endif
+    for (const auto method : methods) {
+        const auto part = Opm::partitionUnstructuredGrid(*global, num_parts, method, 1.1);
+        BOOST_REQUIRE_EQUAL(part.size(), 48);
+        std::vector<int> count(num_parts, 0);
+        for (int p : part) {
+            BOOST_REQUIRE(p >= 0 && p < num_parts);
+            ++count[p];
+        }
+        for (int p = 0; p < num_parts; ++p) {
+            BOOST_CHECK_GT(count[p], 0);
+        }
+    }
+}
+
+#if HAVE_MPI
+BOOST_AUTO_TEST_CASE(missingRootGridThrowsEverywhere)
+{
+    // If the root cannot partition, no rank may be left waiting for its grid.
+    const auto& comm = Dune::MPIHelper::getCommunication();
+    BOOST_CHECK_THROW(Opm::distributeUnstructuredGrid(nullptr, 1, comm, 0), std::exception);
+}
+#endif
+
+BOOST_AUTO_TEST_CASE(loadBalanceFromRootOnly)
+{
+    // Only rank 0 provides the global grid.
+    const auto& comm = Dune::MPIHelper::getCommunication();
+    const std::array<int, 3> dims = comm.rank() == 0 ? std::array<int, 3>{ 5, 4, 3 }
+                                                     : std::array<int, 3>{ 1, 1, 1 };
+    Grid grid(dims, { 1.0, 1.0, 1.0 });
+    if (comm.size() == 1) {
+        BOOST_CHECK(!grid.loadBalance());
+        return;
+    }
+    BOOST_CHECK(grid.loadBalance(1));
+    BOOST_CHECK(grid.isDistributed());
+    BOOST_CHECK_EQUAL(grid.globalSize(0), 60);
+    BOOST_CHECK_EQUAL(grid.overlapSize(0), 1);
+
+    const auto gridView = grid.leafGridView();
+    int interior = 0;
+    int globalIndexSum = 0;
+    for (const auto& element : elements(gridView, Dune::Partitions::interior)) {
+        ++interior;
+        globalIndexSum += grid.globalIndex(0, gridView.indexSet().index(element));
+    }
+    BOOST_CHECK_EQUAL(comm.sum(interior), 60);
+    BOOST_CHECK_EQUAL(comm.sum(globalIndexSum), 59 * 60 / 2);
+
+    // Some vertices of the overlap layer are on its outer boundary, and
+    // they are interior or border on the owner of the adjacent overlap cell.
+    int front = 0;
+    for (const auto& vertex : vertices(gridView)) {
+        front += vertex.partitionType() == Dune::FrontEntity;
+    }
+    BOOST_CHECK_GT(comm.sum(front), 0);
+
+    IdCheckHandle<3> vertexHandle(grid);
+    gridView.communicate(vertexHandle, Dune::InteriorBorder_All_Interface,
+                         Dune::ForwardCommunication);
+    for (const auto& vertex : vertices(gridView)) {
+        if (vertex.partitionType() == Dune::FrontEntity) {
+            BOOST_CHECK(vertexHandle.received()[gridView.indexSet().index(vertex)] > 0);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(loadBalanceAndCommunicate)
+{
+    Grid grid({ 6, 5, 4 }, { 1.0, 1.0, 1.0 });
+    const auto& comm = grid.comm();
+    const int globalCells = grid.size(0);
+
+    const bool changed = grid.loadBalance();
+    BOOST_CHECK_EQUAL(changed, comm.size() > 1);
+
+    const auto gridView = grid.leafGridView();
+    int interior = 0;
+    for (const auto& element : elements(gridView, Dune::Partitions::interior)) {
+        BOOST_CHECK(element.partitionType() == Dune::InteriorEntity);
+        ++interior;
+    }
+    BOOST_CHECK_EQUAL(comm.sum(interior), globalCells);
+
+    if (comm.size() == 1) {
+        return;
+    }
+
+    IdCheckHandle<0> cellHandle(grid);
+    gridView.communicate(cellHandle, Dune::InteriorBorder_All_Interface,
+                         Dune::ForwardCommunication);
+    for (const auto& element : elements(gridView)) {
+        const int expected = element.partitionType() == Dune::OverlapEntity ? 1 : 0;
+        BOOST_CHECK(cellHandle.received()[gridView.indexSet().index(element)] >= expected);
+    }
+
+    IdCheckHandle<3> vertexHandle(grid);
+    grid.communicate(vertexHandle, Dune::All_All_Interface, Dune::ForwardCommunication);
+    for (const auto& vertex : vertices(gridView)) {
+        if (vertex.partitionType() == Dune::BorderEntity) {
+            BOOST_CHECK(vertexHandle.received()[gridView.indexSet().index(vertex)] > 0);
+        }
+    }
+}
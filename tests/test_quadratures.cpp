@@ -27,6 +27,7 @@
 
 #include <opm/grid/CellQuadrature.hpp>
 #include <opm/grid/FaceQuadrature.hpp>
+#include <opm/grid/QuadratureTable.hpp>
 #include <opm/grid/GridManager.hpp>
 #include <opm/grid/UnstructuredGrid.h>
 #include <cmath>
@@ -200,3 +201,67 @@ BOOST_AUTO_TEST_CASE(test_quadratures)
     cart2d::test();
     cart3d::test();
 }
+
+
+namespace tables
+{
+    template <class Quadrature>
+    void compare(const UnstructuredGrid& grid, const QuadratureTable& table, const int degree)
+    {
+        const int dim = grid.dimensions;
+        std::vector<double> pt(dim);
+        int q = 0;
+        for (int entity = 0; entity < table.size(); ++entity) {
+            const Quadrature quad(grid, entity, degree);
+            BOOST_REQUIRE_EQUAL(table.numQuadPts(entity), quad.numQuadPts());
+            BOOST_CHECK_EQUAL(table.offset(entity), q);
+            const auto weights = table.weights(entity);
+            for (int i = 0; i < quad.numQuadPts(); ++i, ++q) {
+                quad.quadPtCoord(i, &pt[0]);
+                for (int dd = 0; dd < dim; ++dd) {
+                    BOOST_CHECK(std::fabs(table.coordinates(entity, dd)[i] - pt[dd]) < 1e-12);
+                    BOOST_CHECK_EQUAL(table.coordinates(dd)[q], table.coordinates(entity, dd)[i]);
+                }
+                BOOST_CHECK(std::fabs(weights[i] - quad.quadPtWeight(i)) < 1e-12);
+            }
+        }
+        BOOST_CHECK_EQUAL(table.numQuadPts(), q);
+    }
+
+    static void test(const UnstructuredGrid& grid)
+    {
+        for (int degree = 1; degree <= 2; ++degree) {
+            compare<CellQuadrature>(grid, QuadratureTable::cells(grid, degree), degree);
+            compare<FaceQuadrature>(grid, QuadratureTable::faces(grid, degree), degree);
+        }
+
+        // Integrate x*y + z over all cells.
+        const auto table = QuadratureTable::cells(grid, 2);
+        std::vector<double> values(table.numQuadPts());
+        const double* x = table.coordinates(0);
+        const double* y = table.coordinates(1);
+        const double* z = table.coordinates(2);
+        for (int q = 0; q < table.numQuadPts(); ++q) {
+            values[q] = x[q]*y[q] + z[q];
+        }
+        std::vector<double> integrals(table.size());
+        table.integrate(values.data(), integrals.data());
+        for (int cell = 0; cell < grid.number_of_cells; ++cell) {
+            const double* cc = grid.cell_centroids + 3*cell;
+            BOOST_CHECK(std::fabs(integrals[cell] - (cc[0]*cc[1] + cc[2])) < 1e-12);
+        }
+    }
+} // namespace tables
+
+BOOST_AUTO_TEST_CASE(test_quadrature_tables)
+{
+    GridManager g3(3, 2, 2);
+    tables::test(*g3.c_grid());
+
+    GridManager g2(3, 2);
+    const UnstructuredGrid& grid = *g2.c_grid();
+    for (int degree = 1; degree <= 2; ++degree) {
+        tables::compare<CellQuadrature>(grid, QuadratureTable::cells(grid, degree), degree);
+        tables::compare<FaceQuadrature>(grid, QuadratureTable::faces(grid, degree), degree);
+    }
+}
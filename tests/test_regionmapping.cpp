@@ -25,6 +25,12 @@
 
 #include <opm/common/utility/platform_dependent/disable_warnings.h>
 #include <boost/test/unit_test.hpp>
+#include <boost/version.hpp>
+#if BOOST_VERSION / 100000 == 1 && BOOST_VERSION / 100 % 1000 < 71
+#include <boost/test/floating_point_comparison.hpp>
+#else
+#include <boost/test/tools/floating_point_comparison.hpp>
+#endif
 #include <opm/common/utility/platform_dependent/reenable_warnings.h>
 
 /* --- our own headers --- */
@@ -32,6 +38,7 @@
 #include <opm/grid/utility/RegionMapping.hpp>
 
 #include <algorithm>
+#include <limits>
 #include <map>
 
 BOOST_AUTO_TEST_SUITE (RegionMapping)
@@ -147,4 +154,92 @@ BOOST_AUTO_TEST_CASE (NonConsecutive)
 }
 
 
+BOOST_AUTO_TEST_CASE (DenseAndSparseIds)
+{
+    // Small range of IDs: dense bins, active regions sorted.
+    std::vector<int> regions = { 7, -1, 3, 7, 3, 0 };
+
+    Opm::RegionMapping<> rm(regions);
+
+    const std::vector<int> expect_active = { -1, 0, 3, 7 };
+    BOOST_CHECK_EQUAL_COLLECTIONS(rm.activeRegions().begin(), rm.activeRegions().end(),
+                                  expect_active.begin(), expect_active.end());
+
+    const std::vector<std::size_t> expect_7 = { 0, 3 };
+    const auto cells_7 = rm.cells(7);
+    BOOST_CHECK_EQUAL_COLLECTIONS(cells_7.begin(), cells_7.end(),
+                                  expect_7.begin(), expect_7.end());
+
+    for (const auto& r : { -2, 1, 2, 8, 1000 }) {
+        BOOST_CHECK(rm.cells(r).empty());
+    }
+
+    // Widely spread IDs: hashed bins.
+    std::vector<int> sparse = { 1000000, 5, 1000000, -70000 };
+
+    Opm::RegionMapping<> rs(sparse);
+
+    BOOST_CHECK_EQUAL(rs.activeRegions().size(), std::size_t(3));
+
+    const std::vector<std::size_t> expect_big = { 0, 2 };
+    const auto cells_big = rs.cells(1000000);
+    BOOST_CHECK_EQUAL_COLLECTIONS(cells_big.begin(), cells_big.end(),
+                                  expect_big.begin(), expect_big.end());
+    BOOST_CHECK(rs.cells(6).empty());
+}
+
+
+BOOST_AUTO_TEST_CASE (Reductions)
+{
+    //                           0  1  2  3  4  5  6  7  8
+    std::vector<int> regions = { 2, 5, 2, 4, 2, 7, 6, 3, 6 };
+    const std::vector<double> x = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    const std::vector<double> y = { 9, 8, 7, 6, 5, 4, 3, 2, 1 };
+    const std::vector<double> w = { 1, 1, 2, 1, 1, 1, 3, 1, 1 };
+
+    Opm::RegionMapping<> rm(regions);
+
+    const std::vector<std::vector<double>> fields = { x, y };
+    const std::size_t nf = fields.size();
+    const std::size_t num_regions = 8;
+
+    const auto sum = rm.sum(fields, num_regions);
+    const auto min = rm.minimum(fields, num_regions);
+    const auto max = rm.maximum(fields, num_regions);
+    const auto avg = rm.weightedAverage(fields, w, num_regions);
+
+    BOOST_REQUIRE_EQUAL(sum.size(), num_regions * nf);
+    BOOST_REQUIRE_EQUAL(avg.size(), num_regions * nf);
+
+    for (std::size_t r = 0; r < num_regions; ++r) {
+        for (std::size_t f = 0; f < nf; ++f) {
+            double s = 0.0, lo = std::numeric_limits<double>::max();
+            double hi = std::numeric_limits<double>::lowest();
+            double sw = 0.0, swx = 0.0;
+            for (const auto& c : rm.cells(r)) {
+                const double v = fields[f][c];
+                s += v;
+                lo = std::min(lo, v);
+                hi = std::max(hi, v);
+                sw += w[c];
+                swx += w[c] * v;
+            }
+            BOOST_CHECK_CLOSE(sum[r*nf + f], s, 1.0e-12);
+            BOOST_CHECK_EQUAL(min[r*nf + f], lo);
+            BOOST_CHECK_EQUAL(max[r*nf + f], hi);
+            BOOST_CHECK_CLOSE(avg[r*nf + f], (sw > 0.0) ? swx / sw : 0.0, 1.0e-12);
+        }
+    }
+
+    // Region 2 holds cells 0, 2 and 4.
+    BOOST_CHECK_CLOSE(sum[2*nf + 0], 9.0, 1.0e-12);
+    BOOST_CHECK_CLOSE(avg[2*nf + 1], (9.0 + 2*7.0 + 5.0) / 4.0, 1.0e-12);
+
+    // Regions beyond num_regions are ignored.
+    const auto sum_small = rm.sum(fields, 3);
+    BOOST_CHECK_EQUAL(sum_small.size(), 3 * nf);
+    BOOST_CHECK_CLOSE(sum_small[2*nf + 1], 21.0, 1.0e-12);
+}
+
+
 BOOST_AUTO_TEST_SUITE_END()
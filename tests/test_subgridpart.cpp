@@ -10,6 +10,7 @@
 #include <boost/test/tools/floating_point_comparison.hpp>
 #endif
 
+#include <opm/grid/common/SubDomains.hpp>
 #include <opm/grid/common/SubGridPart.hpp>
 
 // Warning suppression for Dune includes.
@@ -178,6 +179,62 @@ void testGrid(Grid& grid, const std::string& name, const std::size_t nElem, cons
 }
 
 
+// Split a 4x4x4 grid in two halves across x, leaving out the top layer.
+template <class Grid>
+void testSubDomains(const Grid& grid)
+{
+    const auto& gv = grid.leafGridView();
+    const auto& index_set = gv.indexSet();
+    std::vector<int> cell_part(gv.size(0));
+    for (const auto& elem : elements(gv)) {
+        const auto center = elem.geometry().center();
+        cell_part[index_set.index(elem)] = center[2] > 3.0 ? -1 : (center[0] < 2.0 ? 0 : 1);
+    }
+
+    const Dune::SubDomains domains(gv, cell_part);
+    BOOST_REQUIRE_EQUAL(domains.size(), 2);
+    int total = 0;
+    for (int d = 0; d < domains.size(); ++d) {
+        const auto domain = domains[d];
+        BOOST_CHECK_EQUAL(domain.index(), d);
+        BOOST_CHECK_EQUAL(domain.numCells(), 24);
+        // The cells next to the other half or the left-out layer.
+        BOOST_CHECK_EQUAL(domain.numInterior(), 8);
+        BOOST_CHECK_EQUAL(domain.interiorCells().size() + domain.boundaryCells().size(),
+                          std::size_t(domain.numCells()));
+        total += domain.numCells();
+        for (int c = 0; c < domain.numCells(); ++c) {
+            const int cell = domain.cells()[c];
+            BOOST_CHECK_EQUAL(domains.subDomain(cell), d);
+            BOOST_CHECK_EQUAL(domains.localIndex(cell), c);
+            BOOST_CHECK_EQUAL(index_set.index(domain.element(c)), cell);
+            BOOST_CHECK_EQUAL(domain.externalNeighbours(c).empty(), c < domain.numInterior());
+            int num_neighbours = 0;
+            for (const auto& is : intersections(gv, domain.element(c))) {
+                num_neighbours += is.neighbor();
+            }
+            BOOST_CHECK_EQUAL(domain.neighbours(c).size() + domain.externalNeighbours(c).size(),
+                              std::size_t(num_neighbours));
+            for (const int nb : domain.neighbours(c)) {
+                const auto back = domain.neighbours(nb);
+                BOOST_CHECK(std::find(back.begin(), back.end(), c) != back.end());
+            }
+            for (const int nb : domain.externalNeighbours(c)) {
+                BOOST_CHECK(domains.subDomain(nb) != d);
+            }
+        }
+        const auto part = domains.subGridPart(d);
+        BOOST_CHECK_EQUAL(part.size(0) - part.overlapSize(0), domain.numCells());
+    }
+    BOOST_CHECK_EQUAL(total, 48);
+    for (int cell = 0; cell < gv.size(0); ++cell) {
+        if (cell_part[cell] < 0) {
+            BOOST_CHECK_EQUAL(domains.localIndex(cell), -1);
+        }
+    }
+}
+
+
 #if HAVE_ECL_INPUT
 BOOST_AUTO_TEST_CASE(FromDeck)
 {
@@ -225,6 +282,7 @@ BOOST_AUTO_TEST_CASE(dgf)
 
     Dune::GridPtr< Dune::CpGrid > gridPtr( dgfFile );
     testGrid( *gridPtr, "CpGrid_dgf", 64, 125 );
+    testSubDomains( *gridPtr );
 }
 
 
@@ -234,6 +292,73 @@ BOOST_AUTO_TEST_CASE(yasp)
 
     Dune::YaspGrid<3, Dune::EquidistantCoordinates<double, 3>> yaspGrid({4.0, 4.0, 4.0}, {4, 4, 4});
     testGrid(yaspGrid, "YaspGrid", 64, 125);
+    testSubDomains(yaspGrid);
+}
+
+// The factory returns the requested number of subdomains, covering all cells.
+void testMakeSubDomains(const Dune::CpGrid& grid, const int num_domains, const Dune::PartitionMethod method)
+{
+    const auto domains = Dune::makeSubDomains(grid, num_domains, method);
+    BOOST_REQUIRE_EQUAL(domains.size(), num_domains);
+    int total = 0;
+    for (int d = 0; d < domains.size(); ++d) {
+        BOOST_CHECK_GT(domains[d].numCells(), 0);
+        total += domains[d].numCells();
+    }
+    BOOST_CHECK_EQUAL(total, grid.size(0));
+    for (int cell = 0; cell < grid.size(0); ++cell) {
+        BOOST_CHECK_GE(domains.subDomain(cell), 0);
+        BOOST_CHECK_LT(domains.subDomain(cell), num_domains);
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(subDomainsFactory)
+{
+    Dune::CpGrid grid;
+    grid.createCartesian({6, 4, 3}, {1.0, 1.0, 1.0});
+
+    testMakeSubDomains(grid, 1, Dune::PartitionMethod::simple);
+    testMakeSubDomains(grid, 4, Dune::PartitionMethod::simple);
+    testMakeSubDomains(grid, 6, Dune::PartitionMethod::simple);
+#if HAVE_MPI && HAVE_ZOLTAN
+    testMakeSubDomains(grid, 4, Dune::PartitionMethod::zoltan);
+#endif
+#if defined(HAVE_METIS) && HAVE_MPI
+    testMakeSubDomains(grid, 4, Dune::PartitionMethod::metis);
+#endif
+
+    BOOST_CHECK_THROW(Dune::partitionSubDomains(grid, 0, Dune::PartitionMethod::simple), std::invalid_argument);
+    BOOST_CHECK_THROW(Dune::partitionSubDomains(grid, 7, Dune::PartitionMethod::simple), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(subDomainsOfRefinedGrid)
+{
+    // The graph partitioners work on leaf indices, so global ids of
+    // refined cells beyond the number of leaf cells must not matter.
+    Dune::CpGrid grid;
+    grid.createCartesian({4, 3, 3}, {1.0, 1.0, 1.0});
+    grid.addLgrsUpdateLeafView({{2, 2, 2}}, {{1, 1, 1}}, {{3, 2, 2}}, {"LGR1"});
+    BOOST_REQUIRE_EQUAL(grid.size(0), 36 - 2 + 2 * 8);
+
+#if HAVE_MPI && HAVE_ZOLTAN
+    testMakeSubDomains(grid, 3, Dune::PartitionMethod::zoltan);
+#endif
+#if defined(HAVE_METIS) && HAVE_MPI
+    testMakeSubDomains(grid, 3, Dune::PartitionMethod::metis);
+#endif
+
+    // Each connection appears once per shared face on both sides.
+    const Dune::SubDomains<Dune::CpGrid::LeafGridView> domains(grid.leafGridView(),
+                                                               std::vector<int>(grid.size(0), 0));
+    std::vector<int> start;
+    std::vector<int> adj;
+    Dune::SubDomains<Dune::CpGrid::LeafGridView>::cellAdjacency(grid.leafGridView(), nullptr, start, adj);
+    for (int c = 0; c < domains[0].numCells(); ++c) {
+        const int cell = domains[0].cells()[c];
+        BOOST_CHECK_EQUAL(domains[0].neighbours(c).size(),
+                          static_cast<std::size_t>(start[cell + 1] - start[cell]));
+    }
 }
 
 int main(int argc, char** argv)
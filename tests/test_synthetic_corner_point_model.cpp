@@ -0,0 +1,259 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE SyntheticCornerPointModelTests
+#define BOOST_TEST_NO_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <opm/grid/CpGrid.hpp>
+#include <opm/grid/SyntheticCornerPointModel.hpp>
+
+#if HAVE_ECL_INPUT
+#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+#endif
+
+#include <cctype>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+Opm::SyntheticCornerPointParameters faultedModel()
+{
+    Opm::SyntheticCornerPointParameters param;
+    param.dims = { 7, 5, 9 };
+    param.dip = { 0.05, 0.02 };
+    param.pillarSlope = { 0.1, -0.05 };
+    param.faultSpacing = { 3, 2 };
+    param.faultThrow = 5.0;
+    param.pinchOutInterval = 4;
+    param.thinFraction = 0.2;
+    param.inactiveFraction = 0.3;
+    param.seed = 42;
+    return param;
+}
+
+std::size_t zcornIndex(const std::array<int, 3>& dims, int i, int j, int k, int corner)
+{
+    const std::size_t nx = dims[0];
+    const std::size_t ny = dims[1];
+    return k * 8 * nx * ny + (corner / 4) * 4 * nx * ny
+        + j * 4 * nx + ((corner / 2) % 2) * 2 * nx + 2 * i + corner % 2;
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(sizesAndDeterminism)
+{
+    const auto param = faultedModel();
+    const auto arrays = Opm::generateCornerPointModel(param);
+    BOOST_CHECK(arrays.dims == param.dims);
+    BOOST_CHECK_EQUAL(arrays.coord.size(), 6u * 8 * 6);
+    BOOST_CHECK_EQUAL(arrays.zcorn.size(), 8u * 7 * 5 * 9);
+    BOOST_CHECK_EQUAL(arrays.actnum.size(), 7u * 5 * 9);
+
+    const auto again = Opm::generateCornerPointModel(param);
+    BOOST_CHECK(again.coord == arrays.coord);
+    BOOST_CHECK(again.zcorn == arrays.zcorn);
+    BOOST_CHECK(again.actnum == arrays.actnum);
+
+    auto other_seed = param;
+    other_seed.seed = 43;
+    BOOST_CHECK(Opm::generateCornerPointModel(other_seed).actnum != arrays.actnum);
+
+    auto invalid = param;
+    invalid.inactiveFraction = 1.5;
+    BOOST_CHECK_THROW(Opm::generateCornerPointModel(invalid), std::invalid_argument);
+    invalid = param;
+    invalid.dims[2] = 0;
+    BOOST_CHECK_THROW(Opm::generateCornerPointModel(invalid), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(faultsPinchOutsAndThinCells)
+{
+    const auto param = faultedModel();
+    const auto arrays = Opm::generateCornerPointModel(param);
+    const auto& dims = arrays.dims;
+    const double dz = param.cellSize[2];
+
+    // Cells 2 and 3 in a line share a pillar across a fault.
+    for (int k = 0; k < dims[2]; ++k) {
+        BOOST_CHECK_CLOSE(arrays.zcorn[zcornIndex(dims, 3, 0, k, 4)] - arrays.zcorn[zcornIndex(dims, 2, 0, k, 5)],
+                          param.faultThrow, 1e-10);
+    }
+
+    int num_thin = 0;
+    for (int k = 0; k < dims[2]; ++k) {
+        for (int j = 0; j < dims[1]; ++j) {
+            for (int i = 0; i < dims[0]; ++i) {
+                const double thickness = arrays.zcorn[zcornIndex(dims, i, j, k, 4)]
+                    - arrays.zcorn[zcornIndex(dims, i, j, k, 0)];
+                if ((k + 1) % param.pinchOutInterval == 0) {
+                    BOOST_CHECK_EQUAL(thickness, 0.0);
+                } else if (thickness < dz / 2) {
+                    BOOST_CHECK_CLOSE(thickness, param.thinThickness, 1e-6);
+                    ++num_thin;
+                } else {
+                    BOOST_CHECK_CLOSE(thickness, dz, 1e-10);
+                }
+            }
+        }
+    }
+    BOOST_CHECK_GT(num_thin, 0);
+    BOOST_CHECK_LT(num_thin, 7 * 5 * 7 / 2);
+}
+
+BOOST_AUTO_TEST_CASE(inactiveFraction)
+{
+    Opm::SyntheticCornerPointParameters param;
+    param.dims = { 40, 40, 10 };
+    param.inactiveFraction = 0.25;
+    const auto arrays = Opm::generateCornerPointModel(param);
+    const int num_active = std::accumulate(arrays.actnum.begin(), arrays.actnum.end(), 0);
+    BOOST_CHECK_CLOSE(1.0 - double(num_active) / arrays.actnum.size(), 0.25, 10.0);
+}
+
+BOOST_AUTO_TEST_CASE(streamedMatchesGenerated)
+{
+    const auto param = faultedModel();
+    const auto arrays = Opm::generateCornerPointModel(param);
+    std::ostringstream os;
+    Opm::writeCornerPointModel(param, os);
+
+    std::istringstream is(os.str());
+    std::vector<double> coord;
+    std::vector<double> zcorn;
+    std::vector<int> actnum;
+    std::string keyword;
+    std::string line;
+    while (std::getline(is, line)) {
+        if (line.rfind("--", 0) == 0) {
+            continue;
+        }
+        std::istringstream tokens(line);
+        std::string token;
+        while (tokens >> token) {
+            if (token == "/") {
+                keyword.clear();
+            } else if (std::isalpha(token[0])) {
+                keyword = token;
+            } else if (keyword == "COORD") {
+                coord.push_back(std::stod(token));
+            } else if (keyword == "ZCORN") {
+                zcorn.push_back(std::stod(token));
+            } else if (keyword == "ACTNUM") {
+                const auto star = token.find('*');
+                if (star == std::string::npos) {
+                    actnum.push_back(std::stoi(token));
+                } else {
+                    actnum.insert(actnum.end(), std::stoul(token.substr(0, star)), std::stoi(token.substr(star + 1)));
+                }
+            }
+        }
+    }
+    BOOST_CHECK(coord == arrays.coord);
+    BOOST_CHECK(zcorn == arrays.zcorn);
+    BOOST_CHECK(actnum == arrays.actnum);
+}
+
+BOOST_AUTO_TEST_CASE(processedByCpGrid)
+{
+    const auto param = faultedModel();
+    const auto arrays = Opm::generateCornerPointModel(param);
+    const auto& dims = arrays.dims;
+
+    // Inactive cells and cells in pinched-out layers are removed.
+    int expected = 0;
+    for (int k = 0; k < dims[2]; ++k) {
+        for (int c = 0; c < dims[0] * dims[1]; ++c) {
+            expected += arrays.actnum[c + dims[0] * dims[1] * k] && (k + 1) % param.pinchOutInterval != 0;
+        }
+    }
+
+    Dune::CpGrid grid;
+    grid.processEclipseFormat(arrays.asGrdecl(), false);
+    BOOST_CHECK_EQUAL(grid.size(0), expected);
+}
+
+#if HAVE_ECL_INPUT
+BOOST_AUTO_TEST_CASE(minpvRemovesThinCells)
+{
+    auto param = faultedModel();
+    // Thin cells have a pore volume of about 20, the others of about 20000.
+    param.porosity = 0.2;
+    param.minPoreVolume = 1000.0;
+    const auto arrays = Opm::generateCornerPointModel(param);
+    const auto& dims = arrays.dims;
+
+    // Active cells that are neither thin nor pinched out remain.
+    int expected = 0;
+    int num_thin = 0;
+    for (int k = 0; k < dims[2]; ++k) {
+        for (int j = 0; j < dims[1]; ++j) {
+            for (int i = 0; i < dims[0]; ++i) {
+                if (!arrays.actnum[i + dims[0] * (j + dims[1] * k)]) {
+                    continue;
+                }
+                const double thickness = arrays.zcorn[zcornIndex(dims, i, j, k, 4)]
+                    - arrays.zcorn[zcornIndex(dims, i, j, k, 0)];
+                if (thickness > param.cellSize[2] / 2) {
+                    ++expected;
+                } else if (thickness > 0.0) {
+                    ++num_thin;
+                }
+            }
+        }
+    }
+    BOOST_REQUIRE_GT(num_thin, 0);
+
+    std::ostringstream os;
+    os << "RUNSPEC\nDIMENS\n" << dims[0] << ' ' << dims[1] << ' ' << dims[2] << " /\nGRID\n";
+    Opm::writeCornerPointModel(param, os);
+    const auto deck = Opm::Parser{}.parseString(os.str());
+    BOOST_CHECK(deck.hasKeyword("PORO"));
+    BOOST_CHECK(deck.hasKeyword("MINPV"));
+
+    Opm::EclipseState ecl_state(deck);
+    Opm::EclipseGrid ecl_grid = ecl_state.getInputGrid();
+    Dune::CpGrid grid;
+    const auto removed = grid.processEclipseFormat(&ecl_grid, &ecl_state, false, false, false);
+    BOOST_CHECK_EQUAL(grid.size(0), expected);
+    BOOST_CHECK_GE(removed.size(), std::size_t(num_thin));
+}
+#endif // HAVE_ECL_INPUT
+
+bool
+init_unit_test_func()
+{
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    Dune::MPIHelper::instance(argc, argv);
+    boost::unit_test::unit_test_main(&init_unit_test_func, argc, argv);
+}
@@ -0,0 +1,241 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE TransTpfaTest
+#include <boost/test/unit_test.hpp>
+#include <boost/version.hpp>
+#if BOOST_VERSION / 100000 == 1 && BOOST_VERSION / 100 % 1000 < 71
+#include <boost/test/floating_point_comparison.hpp>
+#else
+#include <boost/test/tools/floating_point_comparison.hpp>
+#endif
+
+#include <opm/grid/CpGrid.hpp>
+#include <opm/grid/ImplicitCartesianGrid.hpp>
+#include <opm/grid/UnstructuredGrid.h>
+#include <opm/grid/cart_grid.h>
+#include <opm/grid/transmissibility/TransTpfa.hpp>
+
+#include <dune/common/parallel/mpihelper.hh>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+struct MPIFixture
+{
+    MPIFixture()
+    {
+        int m_argc = boost::unit_test::framework::master_test_suite().argc;
+        char** m_argv = boost::unit_test::framework::master_test_suite().argv;
+        Dune::MPIHelper::instance(m_argc, m_argv);
+    }
+};
+
+BOOST_GLOBAL_FIXTURE(MPIFixture);
+
+namespace
+{
+
+    std::vector<double> diagonalPerm(int num_cells)
+    {
+        std::vector<double> perm(9 * num_cells, 0.0);
+        for (int c = 0; c < num_cells; ++c) {
+            perm[9*c + 0] = 1.0 + 0.1 * (c % 7);
+            perm[9*c + 4] = 2.0;
+            perm[9*c + 8] = 0.5 + 0.2 * (c % 3);
+        }
+        return perm;
+    }
+
+    template <class Grid>
+    std::vector<double> computeTrans(const Grid& grid, const std::vector<double>& perm,
+                                     int num_half_faces, int num_faces)
+    {
+        std::vector<double> htrans(num_half_faces), trans(num_faces);
+        tpfa_htrans_compute(&grid, perm.data(), htrans.data());
+        tpfa_trans_compute(&grid, htrans.data(), trans.data());
+        return trans;
+    }
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(unstructuredGridMatchesCInterface)
+{
+    UnstructuredGrid* ug = create_grid_hexa3d(7, 5, 4, 1.0, 2.0, 0.5);
+    const int nc = ug->number_of_cells;
+    const int nf = ug->number_of_faces;
+    const int nhf = ug->cell_facepos[nc];
+    const auto perm = diagonalPerm(nc);
+    const std::vector<double> totmob(nc, 0.25);
+
+    std::vector<double> htrans_c(nhf), trans_c(nf), eff_c(nf);
+    tpfa_htrans_compute(ug, perm.data(), htrans_c.data());
+    tpfa_trans_compute(ug, htrans_c.data(), trans_c.data());
+    tpfa_eff_trans_compute(ug, totmob.data(), htrans_c.data(), eff_c.data());
+
+    const UnstructuredGrid& cug = *ug;
+    const auto trans = computeTrans(cug, perm, nhf, nf);
+    std::vector<double> htrans(nhf), eff(nf);
+    tpfa_htrans_compute(&cug, perm.data(), htrans.data());
+    tpfa_eff_trans_compute(&cug, totmob.data(), htrans.data(), eff.data());
+
+    for (int f = 0; f < nf; ++f) {
+        BOOST_CHECK_CLOSE(trans[f], trans_c[f], 1.0e-10);
+        BOOST_CHECK_CLOSE(eff[f], eff_c[f], 1.0e-10);
+        BOOST_CHECK_CLOSE(eff[f], 0.25 * trans[f], 1.0e-10);
+    }
+    destroy_grid(ug);
+}
+
+BOOST_AUTO_TEST_CASE(cpGridMatchesUnstructuredGrid)
+{
+    const std::array<int, 3> dims = { 7, 5, 4 };
+    const std::array<double, 3> cellsz = { 1.0, 2.0, 0.5 };
+    UnstructuredGrid* ug = create_grid_hexa3d(dims[0], dims[1], dims[2],
+                                              cellsz[0], cellsz[1], cellsz[2]);
+    Dune::CpGrid cpgrid;
+    cpgrid.createCartesian(dims, cellsz);
+
+    const int nc = ug->number_of_cells;
+    BOOST_REQUIRE_EQUAL(cpgrid.numCells(), nc);
+    BOOST_REQUIRE_EQUAL(cpgrid.numFaces(), ug->number_of_faces);
+    const auto perm = diagonalPerm(nc);
+
+    // Face numbering differs between the grids, compare sorted values.
+    auto trans_ug = computeTrans(*static_cast<const UnstructuredGrid*>(ug), perm,
+                                 ug->cell_facepos[nc], ug->number_of_faces);
+    auto trans_cp = computeTrans(cpgrid, perm,
+                                 cpgrid.numCellFaces(), cpgrid.numFaces());
+    std::sort(trans_ug.begin(), trans_ug.end());
+    std::sort(trans_cp.begin(), trans_cp.end());
+    for (std::size_t f = 0; f < trans_ug.size(); ++f) {
+        BOOST_CHECK_CLOSE(trans_cp[f], trans_ug[f], 1.0e-8);
+    }
+    destroy_grid(ug);
+}
+
+BOOST_AUTO_TEST_CASE(implicitCartesianGridMatchesUnstructuredGrid)
+{
+    const std::array<int, 3> dims = { 7, 5, 4 };
+    const std::array<double, 3> cellsz = { 1.0, 2.0, 0.5 };
+    UnstructuredGrid* ug = create_grid_hexa3d(dims[0], dims[1], dims[2],
+                                              cellsz[0], cellsz[1], cellsz[2]);
+    const Opm::ImplicitCartesianGrid grid(dims, cellsz);
+
+    const int nc = ug->number_of_cells;
+    const int nf = ug->number_of_faces;
+    const int nhf = ug->cell_facepos[nc];
+    const auto perm = diagonalPerm(nc);
+    const std::vector<double> totmob(nc, 0.5);
+
+    // Both grids number cells, faces and half-faces the same way.
+    std::vector<double> htrans_ug(nhf), htrans(nhf), eff_ug(nf), eff(nf);
+    const UnstructuredGrid& cug = *ug;
+    tpfa_htrans_compute(&cug, perm.data(), htrans_ug.data());
+    tpfa_htrans_compute(&grid, perm.data(), htrans.data());
+    const auto trans_ug = computeTrans(cug, perm, nhf, nf);
+    const auto trans = computeTrans(grid, perm, grid.numCellFaces(), grid.numFaces());
+    tpfa_eff_trans_compute(&cug, totmob.data(), htrans_ug.data(), eff_ug.data());
+    tpfa_eff_trans_compute(&grid, totmob.data(), htrans.data(), eff.data());
+
+    for (int hf = 0; hf < nhf; ++hf) {
+        BOOST_CHECK_CLOSE(htrans[hf], htrans_ug[hf], 1.0e-10);
+    }
+    for (int f = 0; f < nf; ++f) {
+        BOOST_CHECK_CLOSE(trans[f], trans_ug[f], 1.0e-10);
+        BOOST_CHECK_CLOSE(eff[f], eff_ug[f], 1.0e-10);
+    }
+    destroy_grid(ug);
+}
+
+BOOST_AUTO_TEST_CASE(uniformBoxMatchesAnalyticTrans)
+{
+    // In a uniform box with diagonal K the transmissibility of an interior
+    // face normal to axis j is k_j*A_j/d_j, and twice that on the boundary
+    // where only one half-cell contributes.
+    const std::array<int, 3> dims = { 4, 3, 2 };
+    const std::array<double, 3> cellsz = { 2.0, 0.5, 3.0 };
+    const std::array<double, 3> k = { 3.0, 0.2, 1.5 };
+    UnstructuredGrid* ug = create_grid_hexa3d(dims[0], dims[1], dims[2],
+                                              cellsz[0], cellsz[1], cellsz[2]);
+    const Opm::ImplicitCartesianGrid grid(dims, cellsz);
+    const int nc = ug->number_of_cells;
+    const int nf = ug->number_of_faces;
+    const int nhf = ug->cell_facepos[nc];
+
+    std::vector<double> perm(9 * nc, 0.0);
+    for (int c = 0; c < nc; ++c) {
+        for (int j = 0; j < 3; ++j) {
+            perm[9*c + 4*j] = k[j];
+        }
+    }
+
+    std::vector<double> htrans_c(nhf), trans_c(nf);
+    tpfa_htrans_compute(ug, perm.data(), htrans_c.data());
+    tpfa_trans_compute(ug, htrans_c.data(), trans_c.data());
+    const auto trans = computeTrans(grid, perm, grid.numCellFaces(), grid.numFaces());
+
+    for (int f = 0; f < nf; ++f) {
+        const double* n = ug->face_normals + 3*f;
+        const int j = std::max_element(n, n + 3, [](double a, double b)
+                                       { return std::abs(a) < std::abs(b); }) - n;
+        const double area = cellsz[0] * cellsz[1] * cellsz[2] / cellsz[j];
+        const bool interior = ug->face_cells[2*f] >= 0 && ug->face_cells[2*f + 1] >= 0;
+        const double expected = (interior ? 1.0 : 2.0) * k[j] * area / cellsz[j];
+        BOOST_CHECK_CLOSE(trans_c[f], expected, 1.0e-10);
+        BOOST_CHECK_CLOSE(trans[f], expected, 1.0e-10);
+    }
+    destroy_grid(ug);
+}
+
+BOOST_AUTO_TEST_CASE(faceListedTwiceByOneCell)
+{
+    // One cell with a boundary face and a face it shares with itself, as
+    // in a periodic connection, listed twice in its faces.
+    UnstructuredGrid* ug = allocate_grid(3, 1, 2, 2, 3, 1);
+    BOOST_REQUIRE(ug != nullptr);
+    ug->cell_facepos[0] = 0;
+    ug->cell_facepos[1] = 3;
+    const int cell_faces[] = { 0, 1, 1 };
+    const int face_cells[] = { 0, -1, 0, 0 };
+    std::copy(cell_faces, cell_faces + 3, ug->cell_faces);
+    std::copy(face_cells, face_cells + 4, ug->face_cells);
+
+    const std::vector<double> htrans = { 4.0, 2.0, 6.0 };
+    const std::vector<double> totmob = { 0.5 };
+    const double expected[] = { 4.0, 1.0 / (1.0/2.0 + 1.0/6.0) };
+
+    std::vector<double> trans_c(2), eff_c(2), trans(2), eff(2);
+    tpfa_trans_compute(ug, htrans.data(), trans_c.data());
+    tpfa_eff_trans_compute(ug, totmob.data(), htrans.data(), eff_c.data());
+    const UnstructuredGrid* cug = ug;
+    tpfa_trans_compute(cug, htrans.data(), trans.data());
+    tpfa_eff_trans_compute(cug, totmob.data(), htrans.data(), eff.data());
+    for (int f = 0; f < 2; ++f) {
+        BOOST_CHECK_CLOSE(trans_c[f], expected[f], 1.0e-12);
+        BOOST_CHECK_CLOSE(trans[f], expected[f], 1.0e-12);
+        BOOST_CHECK_CLOSE(eff_c[f], 0.5 * expected[f], 1.0e-12);
+        BOOST_CHECK_CLOSE(eff[f], 0.5 * expected[f], 1.0e-12);
+    }
+    destroy_grid(ug);
+}
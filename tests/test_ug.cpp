@@ -201,3 +201,48 @@ BOOST_AUTO_TEST_CASE(TOPS_Fully_Specified) {
     for (std::size_t g = 0; g < 300; g++)
         BOOST_CHECK_EQUAL(actnum[g], 1);
 }
+
+
+BOOST_AUTO_TEST_CASE(GridCache) {
+    const std::string filename = "CORNERPOINT_ACTNUM.DATA";
+    Opm::Parser parser;
+    Opm::EclipseState es(parser.parseFile(filename));
+
+    {
+        Opm::GridManager grid1(es.getInputGrid());
+        Opm::GridManager grid2(es.getInputGrid());
+        BOOST_CHECK(grid1.c_grid() != grid2.c_grid());
+    }
+
+    Opm::GridManager::setCacheLimit(std::size_t(1) << 30);
+    {
+        Opm::GridManager grid1(es.getInputGrid());
+        Opm::GridManager grid2(es.getInputGrid());
+        BOOST_CHECK(grid1.c_grid() == grid2.c_grid());
+        BOOST_CHECK(grid_equal(grid1.c_grid(), grid2.c_grid()));
+
+        // Different input is never served from the cache.
+        Opm::EclipseGrid other(es.getInputGrid());
+        auto actnum = other.getACTNUM();
+        actnum[0] = 1 - actnum[0];
+        other.resetACTNUM(actnum);
+        Opm::GridManager grid3(other);
+        BOOST_CHECK(grid3.c_grid() != grid1.c_grid());
+        BOOST_CHECK(!grid_equal(grid1.c_grid(), grid3.c_grid()));
+
+        // Cleared grids stay alive while in use.
+        Opm::GridManager::clearCache();
+        Opm::GridManager grid4(es.getInputGrid());
+        BOOST_CHECK(grid4.c_grid() != grid1.c_grid());
+        BOOST_CHECK(grid_equal(grid1.c_grid(), grid4.c_grid()));
+    }
+
+    // A limit too small for any grid keeps nothing.
+    Opm::GridManager::setCacheLimit(1);
+    {
+        Opm::GridManager grid1(es.getInputGrid());
+        Opm::GridManager grid2(es.getInputGrid());
+        BOOST_CHECK(grid1.c_grid() != grid2.c_grid());
+    }
+    Opm::GridManager::setCacheLimit(0);
+}
@@ -24,10 +24,13 @@
 #define BOOST_TEST_MODULE VelocityInterpolationTest
 #include <boost/test/unit_test.hpp>
 
-#include <opm/core/utility/VelocityInterpolation.hpp>
+#include <opm/grid/utility/VelocityInterpolation.hpp>
 #include <opm/grid/GridManager.hpp>
 #include <opm/grid/UnstructuredGrid.h>
+#include <cassert>
 #include <cmath>
+#include <numeric>
+#include <vector>
 
 using namespace Opm;
 
@@ -144,10 +147,10 @@ namespace
     namespace Pyramid
     {
         static int face_nodes[]   = { 0, 4, 2,    3, 4, 1,    0, 1, 4,    4, 3, 2,    0, 2, 3, 1,       };
-        static int face_nodepos[] = { 0,          3,          6,          9,          12,            16 };
+        static grid_size_t face_nodepos[] = { 0,          3,          6,          9,          12,            16 };
         static int face_cells[]   = { 0, -1,      0, -1,      0, -1,      0, -1,      0, -1             };
         static int cell_faces[]   = { 0, 1, 2, 3, 4 };
-        static int cell_facepos[] = { 0, 5 };
+        static grid_size_t cell_facepos[] = { 0, 5 };
         static double node_coordinates[] = { 0.0, 0.0, 0.0,   1.0, 0.0, 0.0,   0.0, 1.0, 0.0,   1.0, 1.0, 0.0,   0.0, 0.0, 1.0 };
         static double face_centroids[]   = { 0,       1.0/3.0, 1.0/3.0,
                                              2.0/3.0, 1.0/3.0, 1.0/3.0,
@@ -236,10 +239,10 @@ namespace
     namespace Irreg2d
     {
         static int face_nodes[]   = { 0, 1,    1, 2,    2, 3,    3, 4,    4, 0        };
-        static int face_nodepos[] = { 0,       2,       4,       6,       8,       10 };
+        static grid_size_t face_nodepos[] = { 0,       2,       4,       6,       8,       10 };
         static int face_cells[]   = { 0, -1,   0, -1,   0, -1,   0, -1,   0, -1       };
         static int cell_faces[]   = { 0, 1, 2, 3, 4 };
-        static int cell_facepos[] = { 0, 5 };
+        static grid_size_t cell_facepos[] = { 0, 5 };
         static double node_coordinates[] = { 0, 0,    3, 0,    3, 2,    1, 3,    0, 2 };
         static double face_centroids[]   = { 1.5, 0,    3, 1,    2, 2.5,    0.5, 2.5,    0, 1 };
         static double face_areas[] = { 3, 2, std::sqrt(5.0), std::sqrt(2.0), 2 };
@@ -315,10 +318,10 @@ namespace
     namespace IrregPrism
     {
         static int face_nodes[]   = { 0, 4, 2, 1, 3, 5, 0, 1, 5, 4, 2, 4, 5, 3, 2, 3, 0, 1};
-        static int face_nodepos[] = { 0, 3, 6, 10, 14, 18 };
+        static grid_size_t face_nodepos[] = { 0, 3, 6, 10, 14, 18 };
         static int face_cells[]   = { 0, -1,   0, -1,   0, -1,   0, -1,   0, -1 };
         static int cell_faces[]   = { 0, 1, 2, 3, 4 };
-        static int cell_facepos[] = { 0, 5 };
+        static grid_size_t cell_facepos[] = { 0, 5 };
         static double node_coordinates[] = { 0, 0, 0,
                                              2, 0, 0,
                                              0, 1, 0,
@@ -482,3 +485,83 @@ BOOST_AUTO_TEST_CASE(test_VelocityInterpolationECVI)
 }
 
 
+namespace
+{
+
+    // Only implements the per-point interpolation, so the batch
+    // interpolation of the interface is used.
+    class ConstantPointOnly : public VelocityInterpolationInterface
+    {
+    public:
+        explicit ConstantPointOnly(const UnstructuredGrid& grid)
+            : interp_(grid)
+        {
+        }
+        void setupFluxes(const double* flux) override
+        {
+            interp_.setupFluxes(flux);
+        }
+        void interpolate(const int cell, const double* x, double* v) const override
+        {
+            interp_.interpolate(cell, x, v);
+        }
+    private:
+        VelocityInterpolationConstant interp_;
+    };
+
+    template <class VelInterp>
+    void testBatchMatchesPointwise(const UnstructuredGrid& grid)
+    {
+        const int dim = grid.dimensions;
+        std::vector<double> v0(dim, 0.1);
+        std::vector<double> v1(dim, -0.3);
+        v1[0] = 0.7;
+        std::vector<double> flux;
+        computeFluxLinear(grid, v0, v1, flux);
+        VelInterp vi(grid);
+        vi.setupFluxes(flux.data());
+
+        // Points between the centroid and the nodes of each face, as well
+        // as the cell centroids.
+        std::vector<int> cells;
+        std::vector<double> x;
+        for (int cell = 0; cell < grid.number_of_cells; ++cell) {
+            const double* cc = grid.cell_centroids + dim*cell;
+            cells.push_back(cell);
+            x.insert(x.end(), cc, cc + dim);
+            for (unsigned hf = grid.cell_facepos[cell]; hf < grid.cell_facepos[cell + 1]; ++hf) {
+                const int face = grid.cell_faces[hf];
+                const int node = grid.face_nodes[grid.face_nodepos[face]];
+                const double* nc = grid.node_coordinates + dim*node;
+                cells.push_back(cell);
+                for (int dd = 0; dd < dim; ++dd) {
+                    x.push_back(0.3*cc[dd] + 0.7*nc[dd]);
+                }
+            }
+        }
+        const int num_points = cells.size();
+        std::vector<double> v_batch(dim*num_points);
+        vi.interpolateBatch(num_points, dim, cells.data(), x.data(), v_batch.data());
+        std::vector<double> v_point(dim);
+        for (int p = 0; p < num_points; ++p) {
+            vi.interpolate(cells[p], &x[dim*p], v_point.data());
+            for (int dd = 0; dd < dim; ++dd) {
+                BOOST_CHECK_SMALL(v_batch[dim*p + dd] - v_point[dd], 1e-12);
+            }
+        }
+    }
+
+} // anonymous namespace
+
+
+BOOST_AUTO_TEST_CASE(test_interpolateBatch)
+{
+    GridManager g2d(4, 3, 1.0, 0.5);
+    GridManager g3d(4, 3, 2, 1.0, 0.5, 2.0);
+    const UnstructuredGrid prism = makeIrregPrism();
+    for (const UnstructuredGrid* grid : { g2d.c_grid(), g3d.c_grid(), &prism }) {
+        testBatchMatchesPointwise<VelocityInterpolationConstant>(*grid);
+        testBatchMatchesPointwise<VelocityInterpolationECVI>(*grid);
+        testBatchMatchesPointwise<ConstantPointOnly>(*grid);
+    }
+}